@@ -41,6 +41,21 @@ namespace sdl {
       build(icon, TextData{text, font, size});
     }
 
+    bool
+    Button::evictBorders() {
+      // Do not wait for the button if it is busy: the borders can be evicted
+      // later on.
+      std::unique_lock<std::mutex> guard(m_propsLocker, std::try_to_lock);
+      if (!guard.owns_lock()) {
+        return false;
+      }
+
+      clearBorders();
+      m_bordersChanged = true;
+
+      return true;
+    }
+
     void
     Button::drawContentPrivate(const utils::Uuid& uuid,
                                const utils::Boxf& area)
@@ -48,6 +63,9 @@ namespace sdl {
       // Acquire the lock on the attributes of this widget.
       Guard guard(m_propsLocker);
 
+      // The borders are used: prevent them from being evicted.
+      TextureBudget::getInstance().touch(this);
+
       // Load the borders if needed.
       if (bordersChanged()) {
         loadBorders();
@@ -67,8 +85,8 @@ namespace sdl {
       // borders to create a feeling of depth.
       utils::Uuid vl = (m_borders.pressed ? m_borders.vDarkBorder : m_borders.vLightBorder);
       utils::Uuid vr = (m_borders.pressed ? m_borders.vLightBorder : m_borders.vDarkBorder);
-      utils::Uuid ht = (m_borders.pressed ? m_borders.vDarkBorder : m_borders.vLightBorder);
-      utils::Uuid hb = (m_borders.pressed ? m_borders.vLightBorder : m_borders.vDarkBorder);
+      utils::Uuid ht = (m_borders.pressed ? m_borders.hDarkBorder : m_borders.hLightBorder);
+      utils::Uuid hb = (m_borders.pressed ? m_borders.hLightBorder : m_borders.hDarkBorder);
 
       // Compute the position of each border based on its size and the size of this area.
       utils::Boxf vFromL(-thisArea.w() / 2.0f + vSize.w() / 2.0f, 0.0f, vSize);
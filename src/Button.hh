@@ -5,6 +5,7 @@
 # include <memory>
 # include <vector>
 # include <sdl_core/SdlWidget.hh>
+# include "TextureBudget.hh"
 
 namespace sdl {
   namespace graphic {
@@ -210,6 +211,17 @@ namespace sdl {
         void
         clearBorders();
 
+        /**
+         * @brief - Used by the texture budget to release the borders of this button when it
+         *          was not drawn for a while. They are rebuilt upon the next call to the
+         *          `drawContentPrivate` method.
+         *          Acquires the locker if possible.
+         * @return - `true` if the borders could be released and `false` if the button is
+         *           currently busy.
+         */
+        bool
+        evictBorders();
+
         /**
          * @brief - Used whenever a meaningful mouse button release event is detected. We want to
          *          toggle the button if needed and update the borders so that they are accurately
@@ -9,6 +9,7 @@ namespace sdl {
     inline
     Button::~Button() {
       Guard guard(m_propsLocker);
+      TextureBudget::getInstance().discharge(this);
       clearBorders();
     }
 
@@ -51,14 +52,10 @@ namespace sdl {
         bool change = (m_state != State::Toggled && toggled) || (m_state != State::Released && !toggled);
 
         if (change) {
-          // Update the role of the borders.
-          bool old = m_borders.pressed;
+          // Update the role of the borders: both the light and dark versions
+          // are always available so there's no need to reload them.
           m_borders.pressed = toggled;
 
-          if (old != m_borders.pressed) {
-            setBordersChanged();
-          }
-
           // And the state of the button.
           m_state = (toggled ? State::Toggled : State::Released);
 
@@ -292,6 +289,18 @@ namespace sdl {
       getEngine().fillTexture(m_borders.hDarkBorder, getPalette());
       getEngine().fillTexture(m_borders.vLightBorder, getPalette());
       getEngine().fillTexture(m_borders.vDarkBorder, getPalette());
+
+      // Register the borders in the budget.
+      TextureBudget::getInstance().charge(
+        this,
+        TextureBudget::getTextureBytes(getEngine(), m_borders.hLightBorder) +
+        TextureBudget::getTextureBytes(getEngine(), m_borders.hDarkBorder) +
+        TextureBudget::getTextureBytes(getEngine(), m_borders.vLightBorder) +
+        TextureBudget::getTextureBytes(getEngine(), m_borders.vDarkBorder),
+        [this]() {
+          return evictBorders();
+        }
+      );
     }
 
     inline
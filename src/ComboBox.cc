@@ -24,7 +24,16 @@ namespace sdl {
       m_closedBox(),
 
       m_activeItem(-1),
-      m_items()
+      m_items(),
+      m_itemsSorted(true),
+
+      m_firstVisibleItem(0),
+      m_rows(),
+
+      m_searchIndex(),
+      m_search(),
+      m_firstMatch(0),
+      m_lastMatch(0)
     {
       // Assign the z order for this widget: it should be drawn in front of other
       // regular widgets.
@@ -34,7 +43,11 @@ namespace sdl {
       build();
     }
 
-    ComboBox::~ComboBox() {}
+    ComboBox::~ComboBox() {
+      // Hand back the rows if the combobox is still dropped: otherwise they
+      // would be deleted along with the children of this widget.
+      releaseRows();
+    }
 
     void
     ComboBox::insertItem(int index,
@@ -47,30 +60,174 @@ namespace sdl {
       // Check the position of insertion: we want to correctly handle
       // cases where the index is either negative or larger than the
       // current size of the internal `m_items` vector.
-      if (index < 0) {
-        m_items.insert(m_items.cbegin(), item);
-      }
-      else if (index >= getItemsCount()) {
-        m_items.push_back(item);
-      }
-      else {
-        m_items.insert(m_items.cbegin() + index, item);
+      const int pos = std::max(0, std::min(index, getItemsCount()));
+
+      m_items.insert(m_items.cbegin() + pos, item);
+
+      // Check whether the items are still sorted: as they were before the
+      // insertion we only need to compare the new item with its neighbors.
+      if (m_itemsSorted) {
+        m_itemsSorted =
+          (pos == 0 || m_items[pos - 1].text.compare(text) <= 0) &&
+          (pos == getItemsCount() - 1 || text.compare(m_items[pos + 1].text) <= 0)
+        ;
       }
 
+      // Register the new item in the search index.
+      registerInSearchIndex(pos);
+
       // We also need to update the active item if any: indeed if the
       // active item was after the item which has just been inserted
       // we need to increase the value of the `m_activeItem` by one
       // to make it for the newly inserted item.
-      if (hasActiveItem() && m_activeItem >= index) {
+      if (hasActiveItem() && m_activeItem >= pos) {
         ++m_activeItem;
       }
 
+      // Keep the same items displayed in case the new item is inserted before
+      // the first visible one. In case a search is active the new item might
+      // match it so we need to update the matching items.
+      if (isFiltered()) {
+        updateMatches(false);
+        m_firstVisibleItem = clampFirstVisibleItem(m_firstVisibleItem);
+      }
+      else if (m_firstVisibleItem > 0 && pos < m_firstVisibleItem) {
+        ++m_firstVisibleItem;
+      }
+
       // Check whether we need to modify the display for this combobox. This
       // can only be the case if the combobox is dropped, in which case the
-      // new item will be displayed. Otherwise nothing changes in the combobox
+      // new item might be displayed. Otherwise nothing changes in the combobox
       // so we can skip the update part.
       if (isDropped()) {
-        requestRepaint();
+        updateRows();
+      }
+    }
+
+    void
+    ComboBox::insertItems(const std::vector<std::string>& texts,
+                          const std::vector<std::string>& icons)
+    {
+      // Nothing to do if no items are provided.
+      if (texts.empty()) {
+        return;
+      }
+
+      // Build the items to insert.
+      ItemsMap items;
+      items.reserve(texts.size());
+
+      for (unsigned id = 0u ; id < texts.size() ; ++id) {
+        items.push_back(ComboBoxItem{texts[id], id < icons.size() ? icons[id] : std::string()});
+      }
+
+      // Only the policies for which the insertion index does not depend on the
+      // previously inserted items can be handled as a single operation. For the
+      // alphabetical policy this also requires the existing items to be sorted.
+      // In any other case we fall back to inserting the items one at a time.
+      const bool bulk =
+        m_insertPolicy == InsertPolicy::InsertAtTop ||
+        m_insertPolicy == InsertPolicy::InsertAtBottom ||
+        (m_insertPolicy == InsertPolicy::InsertAlphabetically && m_itemsSorted)
+      ;
+
+      if (!bulk) {
+        for (unsigned id = 0u ; id < items.size() ; ++id) {
+          insertItem(items[id].text, items[id].icon);
+        }
+
+        return;
+      }
+
+      const int count = static_cast<int>(items.size());
+
+      switch (m_insertPolicy) {
+        case InsertPolicy::InsertAtTop:
+          // Insert the items as a block: each item goes before the previous
+          // one just like when inserting them one at a time, so the block is
+          // reversed. The active and first visible items are shifted by the
+          // number of items inserted.
+          m_items.insert(m_items.cbegin(), items.crbegin(), items.crend());
+          m_itemsSorted = false;
+
+          if (hasActiveItem()) {
+            m_activeItem += count;
+          }
+          if (!isFiltered() && m_firstVisibleItem > 0) {
+            m_firstVisibleItem += count;
+          }
+          break;
+        case InsertPolicy::InsertAtBottom:
+          // Append the items: the active and first visible items do not change.
+          m_items.insert(m_items.cend(), items.cbegin(), items.cend());
+          m_itemsSorted = false;
+          break;
+        case InsertPolicy::InsertAlphabetically:
+        default:
+          {
+            // Sort the new items and merge them with the existing ones. The
+            // sort is stable and the merge keeps existing items before new
+            // ones with the same text: this produces the same order as when
+            // inserting the items one at a time.
+            auto comp = [](const ComboBoxItem& lhs, const ComboBoxItem& rhs) {
+              return lhs.text.compare(rhs.text) < 0;
+            };
+
+            std::stable_sort(items.begin(), items.end(), comp);
+
+            // The active and first visible items are shifted by the number of
+            // new items inserted before them.
+            auto shift = [&items, &comp](const ComboBoxItem& item) {
+              return static_cast<int>(std::lower_bound(items.cbegin(), items.cend(), item, comp) - items.cbegin());
+            };
+
+            if (hasActiveItem()) {
+              m_activeItem += shift(m_items[m_activeItem]);
+            }
+            if (!isFiltered() && m_firstVisibleItem > 0 && m_firstVisibleItem < getItemsCount()) {
+              m_firstVisibleItem += shift(m_items[m_firstVisibleItem]);
+            }
+
+            ItemsMap merged;
+            merged.reserve(m_items.size() + items.size());
+
+            std::merge(
+              m_items.cbegin(), m_items.cend(),
+              items.cbegin(), items.cend(),
+              std::back_inserter(merged),
+              comp
+            );
+
+            m_items.swap(merged);
+          }
+          break;
+      }
+
+      // The items sorting is only kept by the alphabetical policy: for the
+      // other policies check whether the items still happen to be sorted.
+      if (!m_itemsSorted) {
+        m_itemsSorted = std::is_sorted(
+          m_items.cbegin(),
+          m_items.cend(),
+          [](const ComboBoxItem& lhs, const ComboBoxItem& rhs) {
+            return lhs.text.compare(rhs.text) < 0;
+          }
+        );
+      }
+
+      // Rebuild the search index: this is faster than registering each item
+      // individually. The matching items also need to be updated if a search
+      // is active.
+      rebuildSearchIndex();
+
+      if (isFiltered()) {
+        updateMatches(false);
+        m_firstVisibleItem = clampFirstVisibleItem(m_firstVisibleItem);
+      }
+
+      // Update the display in case the combobox is dropped.
+      if (isDropped()) {
+        updateRows();
       }
     }
 
@@ -85,6 +242,7 @@ namespace sdl {
       }
 
       // Perform the deletion.
+      unregisterFromSearchIndex(index);
       m_items.erase(m_items.cbegin() + index);
 
       bool removedActive = false;
@@ -101,11 +259,24 @@ namespace sdl {
         removedActive = true;
       }
 
+      // Keep the same items displayed if possible and make sure that the rows
+      // do not display past the last item.
+      if (isFiltered()) {
+        updateMatches(false);
+      }
+      else if (index < m_firstVisibleItem) {
+        --m_firstVisibleItem;
+      }
+      m_firstVisibleItem = clampFirstVisibleItem(m_firstVisibleItem);
+
       // We need to update the content if needed. This can happen either is the
       // deleted item was the active one or if the combobox is dropped: in this
       // case as all items are displayed the removal of the item will be directly
       // visible.
-      if (isDropped() || removedActive) {
+      if (isDropped()) {
+        updateRows();
+      }
+      else if (removedActive) {
         requestRepaint();
       }
     }
@@ -289,6 +460,60 @@ namespace sdl {
       return SdlWidget::resizeEvent(e);
     }
 
+    bool
+    ComboBox::mouseWheelEvent(const core::engine::MouseEvent& e) {
+      // Scroll through the items if the combobox is dropped and the mouse is
+      // inside it: otherwise the wheel event is not meant for this widget.
+      if (isClosed() || !isMouseInside()) {
+        return core::SdlWidget::mouseWheelEvent(e);
+      }
+
+      // Positive scroll values correspond to the wheel being rolled up which
+      // should display the items located before the first visible one.
+      utils::Vector2i scroll = e.getScroll();
+
+      scrollRows(-scroll.y());
+
+      // Use the base handler to provide a return value.
+      return core::SdlWidget::mouseWheelEvent(e);
+    }
+
+    bool
+    ComboBox::keyPressEvent(const core::engine::KeyEvent& e) {
+      const bool toReturn = core::SdlWidget::keyPressEvent(e);
+
+      // Remove the last character of the search if any.
+      if (e.getRawKey() == core::engine::RawKey::BackSpace) {
+        if (isFiltered()) {
+          setSearch(m_search.substr(0u, m_search.size() - 1u));
+        }
+
+        return toReturn;
+      }
+
+      // Activate the first item displayed and close the combobox.
+      if (e.getRawKey() == core::engine::RawKey::Return || e.getRawKey() == core::engine::RawKey::KPEnter) {
+        if (isDropped()) {
+          if (getDisplayedItemsCount() > 0) {
+            setActiveItem(getItemFromRow(0));
+          }
+
+          setState(State::Closed);
+        }
+
+        return toReturn;
+      }
+
+      // Only printable characters can be used in the search.
+      if (!e.isPrintable()) {
+        return toReturn;
+      }
+
+      setSearch(m_search + e.getChar());
+
+      return toReturn;
+    }
+
     bool
     ComboBox::filterMouseEvents(const core::engine::EngineObject* watched,
                                 const core::engine::MouseEventShPtr e) const noexcept
@@ -366,28 +591,6 @@ namespace sdl {
 
     std::pair<int, bool>
     ComboBox::getIndexFromInsertPolicy(const std::string& text) const {
-      // Compute the alphabetical position of the input text based on the
-      // existing items already registered in the combobox.
-      // We could retrieve all the keys, add the input `text` then perform
-      // a sort and obtain the id. But we can also just scan all the
-      // existing keys and compare each one to the input `text` and work
-      // out the position of the text from there.
-      int alphabeticalRank = getItemsCount();
-      for (unsigned id = 0u ; id < m_items.size() ; ++id) {
-        if (m_items[id].text.compare(text) < 0) {
-          // The new text should be inserted at least before this item.
-          alphabeticalRank = id - 1;
-        }
-      }
-
-      // We only need to take care of the case where the input `text` should
-      // be inserted before the first registered item. We will end up with an
-      // `alphabeticalRank` of `-1` which we should transform into `0`. This
-      // is not a problem because the `AlphabeticalOrder` does not erase any
-      // existing item.
-      alphabeticalRank = std::max(alphabeticalRank, 0);
-
-
       // Disitnguish according to the insertion policy.
       switch (m_insertPolicy) {
         case InsertPolicy::InsertAtTop:
@@ -401,7 +604,7 @@ namespace sdl {
         case InsertPolicy::InsertBeforeCurrent:
           return std::make_pair(getActiveItem(), false);
         case InsertPolicy::InsertAlphabetically:
-          return std::make_pair(alphabeticalRank, false);
+          return std::make_pair(getAlphabeticalRank(text), false);
         case InsertPolicy::NoInsert:
         default:
           break;
@@ -418,6 +621,30 @@ namespace sdl {
       return std::make_pair(0, false);
     }
 
+    int
+    ComboBox::getAlphabeticalRank(const std::string& text) const noexcept {
+      // Items with the same text as the input one are kept before it so we
+      // are looking for the first item which is strictly greater than the
+      // input `text`.
+      auto comp = [](const std::string& lhs, const ComboBoxItem& rhs) {
+        return lhs.compare(rhs.text) < 0;
+      };
+
+      // In case the items are sorted we can use a binary search.
+      if (m_itemsSorted) {
+        return std::upper_bound(m_items.cbegin(), m_items.cend(), text, comp) - m_items.cbegin();
+      }
+
+      // Otherwise we have to scan all the items.
+      return std::find_if(
+        m_items.cbegin(),
+        m_items.cend(),
+        [&text, &comp](const ComboBoxItem& item) {
+          return comp(text, item);
+        }
+      ) - m_items.cbegin();
+    }
+
     void
     ComboBox::setActiveItem(int index) {
       // Remove the corresponding item if it exists.
@@ -464,8 +691,10 @@ namespace sdl {
 
       log("Old size is " + m_closedBox.toString() + ", new is " + newSize.toString());
 
-      // Update the internal state.
+      // Update the internal state. Any type-ahead search is reset when the
+      // combobox is opened or closed.
       m_state = state;
+      m_search.clear();
 
       // Now proceed to posting a resize event with the new size.
       postEvent(std::make_shared<core::engine::ResizeEvent>(
@@ -473,71 +702,285 @@ namespace sdl {
         LayoutItem::getRenderingArea()
       ));
 
-      // Retrieve the layout so that we can insert new widgets if needed.
-      GridLayout* layout = getLayoutAs<GridLayout>();
+      // Make sure that the active item is visible when the combobox is dropped
+      // and that the rows do not display past the last item.
+      if (m_state == State::Dropped) {
+        const int count = getVisibleItemsCount();
+
+        if (hasActiveItem() && (m_activeItem < m_firstVisibleItem || m_activeItem >= m_firstVisibleItem + count)) {
+          m_firstVisibleItem = m_activeItem;
+        }
 
-      // We also need to either create the needed icon and text widgets
-      // or make them visible/hidden if they already exist. This only
-      // applies if the state to apply is `Dropped`. In the case of a close
-      // event we only need to make all the widgets non visible.
+        m_firstVisibleItem = clampFirstVisibleItem(m_firstVisibleItem);
+      }
+
+      // Rent the rows from the shared popup and bind them to the visible items
+      // or hand them back if the combobox is now closed.
+      if (m_state == State::Dropped) {
+        acquireRows();
+        updateRows();
+      }
+      else {
+        releaseRows();
+      }
+    }
+
+    void
+    ComboBox::updateRows() {
+      // Only a fixed pool of rows is used to represent the items: each row is
+      // bound to the item located at `m_firstVisibleItem` plus the index of the
+      // row. The rows which do not correspond to any item are hidden. Note that
+      // there are no rows when the combobox is closed.
       const int count = getVisibleItemsCount();
-      const bool visible = (m_state == State::Dropped);
-
-      for (int id = 0 ; id < count ; ++id) {
-        // Try to set the icon and the visible status for the picture widget.
-        PictureWidget* icon = getChildOrNull<PictureWidget>(getIconNameFromID(id));
-
-        if (icon == nullptr) {
-          // Create the item.
-          icon = new PictureWidget(
-            getIconNameFromID(id),
-            std::string(),
-            PictureWidget::Mode::Fit,
-            this,
-            core::engine::Color::NamedColor::Silver
-          );
-
-          // Add it to the layout.
-          layout->addItem(icon, 0u, 1u + id, 1u, 1u);
-
-          // Register the click on the icon widget so that we can update the
-          // selected element in this combobox.
-          icon->onClick.connect_member<ComboBox>(this, &ComboBox::onElementClicked);
+
+      for (int row = 0 ; row < static_cast<int>(m_rows.size()) ; ++row) {
+        const bool used = row < count && m_firstVisibleItem + row < getDisplayedItemsCount();
+
+        PictureWidget* icon = m_rows[row].icon;
+        LabelWidget* text = m_rows[row].text;
+
+        if (!used) {
+          icon->setVisible(false);
+          text->setVisible(false);
+
+          continue;
         }
 
-        // Now we either created the icon widget if needed or found it if it
-        // already existed. We can assign properties to the picture widget.
+        // Bind the row to the item it should display.
+        const int id = getItemFromRow(row);
+
         icon->setImagePath(m_items[id].icon);
-        icon->setVisible(visible);
-
-        // Try to set the text and the visible status for the label widget.
-        LabelWidget* text = getChildOrNull<LabelWidget>(getTextNameFromID(id));
-
-        if (text == nullptr) {
-          // Create the item.
-          text = new LabelWidget(
-            getTextNameFromID(id),
-            std::string(),
-            std::string("data/fonts/times.ttf"),
-            15,
-            LabelWidget::HorizontalAlignment::Left,
-            LabelWidget::VerticalAlignment::Center,
-            this,
-            core::engine::Color::NamedColor::Silver
-          );
-
-          // Add it to the layout.
-          layout->addItem(text, 1u, 1u + id, 1u, 1u);
-
-          // Register the click on the icon widget so that we can update the
-          // selected element in this combobox.
-          text->onClick.connect_member<ComboBox>(this, &ComboBox::onElementClicked);
-        }
+        icon->setVisible(true);
 
-        // Now we either created the label widget if needed or found it if it
-        // already existed. We can assign properties to the label widget.
         text->setText(m_items[id].text);
-        text->setVisible(visible);
+        text->setVisible(true);
+      }
+    }
+
+    ComboBoxPopup::Row
+    ComboBox::createRow(int row) const {
+      PictureWidget* icon = new PictureWidget(
+        getIconNameFromID(row),
+        std::string(),
+        PictureWidget::Mode::Fit,
+        nullptr,
+        core::engine::Color::NamedColor::Silver
+      );
+
+      LabelWidget* text = new LabelWidget(
+        getTextNameFromID(row),
+        std::string(),
+        std::string("data/fonts/times.ttf"),
+        15,
+        LabelWidget::HorizontalAlignment::Left,
+        LabelWidget::VerticalAlignment::Center,
+        nullptr,
+        core::engine::Color::NamedColor::Silver
+      );
+
+      return ComboBoxPopup::Row{icon, text, -1, -1};
+    }
+
+    void
+    ComboBox::acquireRows() {
+      // Nothing to do if the rows are already rented.
+      if (!m_rows.empty()) {
+        return;
+      }
+
+      // Rent the rows from the shared popup and create the missing ones.
+      m_rows = ComboBoxPopup::getInstance().rent(this, m_maxVisibleItems);
+
+      for (int row = m_rows.size() ; row < m_maxVisibleItems ; ++row) {
+        m_rows.push_back(createRow(row));
+      }
+
+      // Insert the rows in the layout and register the clicks on each one so
+      // that we can update the selected element in this combobox.
+      GridLayout* layout = getLayoutAs<GridLayout>();
+
+      for (unsigned row = 0u ; row < m_rows.size() ; ++row) {
+        ComboBoxPopup::Row& r = m_rows[row];
+
+        r.icon->setParent(this);
+        r.text->setParent(this);
+
+        layout->addItem(r.icon, 0u, 1u + row, 1u, 1u);
+        layout->addItem(r.text, 1u, 1u + row, 1u, 1u);
+
+        r.iconClickID = r.icon->onClick.connect_member<ComboBox>(this, &ComboBox::onElementClicked);
+        r.textClickID = r.text->onClick.connect_member<ComboBox>(this, &ComboBox::onElementClicked);
+      }
+    }
+
+    void
+    ComboBox::releaseRows() {
+      // Nothing to do if no rows are rented.
+      if (m_rows.empty()) {
+        return;
+      }
+
+      // Detach the rows from this combobox.
+      GridLayout* layout = getLayoutAs<GridLayout>();
+
+      for (unsigned row = 0u ; row < m_rows.size() ; ++row) {
+        ComboBoxPopup::Row& r = m_rows[row];
+
+        r.icon->onClick.disconnect(r.iconClickID);
+        r.text->onClick.disconnect(r.textClickID);
+
+        r.icon->setVisible(false);
+        r.text->setVisible(false);
+
+        layout->removeItem(r.icon);
+        layout->removeItem(r.text);
+
+        removeWidget(r.icon);
+        removeWidget(r.text);
+      }
+
+      // Hand back the rows to the shared popup.
+      ComboBoxPopup::getInstance().giveBack(this, m_rows);
+    }
+
+    void
+    ComboBox::revokeRows() {
+      setState(State::Closed);
+    }
+
+    void
+    ComboBox::registerInSearchIndex(int index) {
+      // Shift the indices of the items located after the new one. There is
+      // no such item when appending: this keeps the insertion of items at the
+      // end of the list logarithmic. Otherwise this costs about as much as the
+      // insertion in the list of items itself.
+      if (index < getItemsCount() - 1) {
+        for (unsigned id = 0u ; id < m_searchIndex.size() ; ++id) {
+          if (m_searchIndex[id] >= index) {
+            ++m_searchIndex[id];
+          }
+        }
+      }
+
+      // Insert the new item at its alphabetical position.
+      SearchIndex::const_iterator it = std::lower_bound(
+        m_searchIndex.cbegin(),
+        m_searchIndex.cend(),
+        index,
+        [this](int lhs, int rhs) {
+          return compareSearchEntries(lhs, rhs);
+        }
+      );
+
+      m_searchIndex.insert(it, index);
+    }
+
+    void
+    ComboBox::unregisterFromSearchIndex(int index) {
+      // Find the entry of the item: as entries are unique this is the first
+      // entry which is not before it.
+      SearchIndex::const_iterator it = std::lower_bound(
+        m_searchIndex.cbegin(),
+        m_searchIndex.cend(),
+        index,
+        [this](int lhs, int rhs) {
+          return compareSearchEntries(lhs, rhs);
+        }
+      );
+
+      if (it != m_searchIndex.cend() && *it == index) {
+        m_searchIndex.erase(it);
+      }
+
+      // Shift the indices of the items located after the removed one if it
+      // is not the last one.
+      if (index < getItemsCount() - 1) {
+        for (unsigned id = 0u ; id < m_searchIndex.size() ; ++id) {
+          if (m_searchIndex[id] > index) {
+            --m_searchIndex[id];
+          }
+        }
+      }
+    }
+
+    void
+    ComboBox::rebuildSearchIndex() {
+      m_searchIndex.resize(m_items.size());
+      std::iota(m_searchIndex.begin(), m_searchIndex.end(), 0);
+
+      // No need to sort the index if the items are already sorted.
+      if (m_itemsSorted) {
+        return;
+      }
+
+      std::sort(
+        m_searchIndex.begin(),
+        m_searchIndex.end(),
+        [this](int lhs, int rhs) {
+          return compareSearchEntries(lhs, rhs);
+        }
+      );
+    }
+
+    void
+    ComboBox::updateMatches(bool narrow) {
+      // The items starting with the search form a range of the search index:
+      // as truncating the texts to the length of the search preserves their
+      // order we can find the bounds of this range with a binary search.
+      const std::size_t len = m_search.size();
+
+      SearchIndex::const_iterator begin = m_searchIndex.cbegin() + (narrow ? m_firstMatch : 0);
+      SearchIndex::const_iterator end = (narrow ? m_searchIndex.cbegin() + m_lastMatch : m_searchIndex.cend());
+
+      SearchIndex::const_iterator lower = std::lower_bound(
+        begin,
+        end,
+        m_search,
+        [this, len](int item, const std::string& search) {
+          return m_items[item].text.compare(0u, len, search) < 0;
+        }
+      );
+
+      SearchIndex::const_iterator upper = std::upper_bound(
+        lower,
+        end,
+        m_search,
+        [this, len](const std::string& search, int item) {
+          return m_items[item].text.compare(0u, len, search) > 0;
+        }
+      );
+
+      m_firstMatch = lower - m_searchIndex.cbegin();
+      m_lastMatch = upper - m_searchIndex.cbegin();
+    }
+
+    void
+    ComboBox::setSearch(const std::string& search) {
+      // In case the new search only appends characters to the current one the
+      // matching items are necessarily part of the current matches.
+      const bool narrow =
+        isFiltered() &&
+        search.size() > m_search.size() &&
+        search.compare(0u, m_search.size(), m_search) == 0
+      ;
+
+      m_search = search;
+
+      if (isFiltered()) {
+        updateMatches(narrow);
+      }
+
+      m_firstVisibleItem = 0;
+
+      // Display the matching items if the combobox is dropped.
+      if (isDropped()) {
+        updateRows();
+        return;
+      }
+
+      // Otherwise activate the first matching item if any.
+      if (isFiltered() && m_lastMatch > m_firstMatch) {
+        setActiveItem(m_searchIndex[m_firstMatch]);
       }
     }
 
@@ -566,8 +1009,9 @@ namespace sdl {
     void
     ComboBox::onElementClicked(const std::string& name) {
       // Retrieve the index of the element based on the name of the widget
-      // which has been clicked.
-      const int id = getIDFromWidgetName(name);
+      // which has been clicked: the rows are recycled while scrolling so we
+      // need to account for the first visible item and the search if any.
+      const int id = getItemFromRow(getIDFromWidgetName(name));
 
       log("Clicked on element " + name + ", id: " + std::to_string(id));
 
@@ -3,12 +3,18 @@
 
 # include <memory>
 # include <vector>
+# include <iterator>
+# include <numeric>
+# include <algorithm>
 # include <sdl_core/SdlWidget.hh>
+# include "ComboBoxPopup.hh"
 
 namespace sdl {
   namespace graphic {
 
     class ComboBox: public core::SdlWidget {
+      friend class ComboBoxPopup;
+
       public:
 
         /**
@@ -55,6 +61,10 @@ namespace sdl {
          *          Note that if the `InsertPolicy` does not allow insertion, an error is raised.
          *          Also note that this widget will take ownership of the provided `icon` and proceed
          *          to remove it at most appropriate time.
+         *          With the alphabetical policy only the computation of the rank of the item is in
+         *          `O(log(n))` (when the items are sorted): inserting it in the internal vector and
+         *          registering it in the search index are both linear in the number of items. The
+         *          `insertItems` method should be used to insert many items.
          * @param text - the text to insert using a position derived from the insert policy.
          * @param icon - a string representing the path to reach the icon to associate to this `text`
          *               entry. Note that if the provided value is null (default) this parameter is
@@ -86,6 +96,25 @@ namespace sdl {
                    const std::string& text,
                    const std::string& icon = std::string());
 
+        /**
+         * @brief - Inserts all the provided `texts` in this combobox in a single operation. Each
+         *          text is assigned the icon at the same position in `icons` if any. The position
+         *          of the items is computed from the internal `InsertPolicy` just like for the
+         *          `insertItem` method.
+         *          This method should be preferred when many items need to be inserted: in the
+         *          case of the alphabetical policy the new items are sorted and merged with the
+         *          existing ones in `O(n log(n))` instead of being inserted one at a time.
+         *          The resulting order is the same as when inserting the items one at a time: in
+         *          the case of the `InsertAtTop` policy the items thus appear in reverse order.
+         *          Note that if the `InsertPolicy` does not allow insertion, an error is raised.
+         * @param texts - the texts to insert in this combobox.
+         * @param icons - the icons to associate to each text. If this vector is shorter than the
+         *                `texts` the remaining texts are not associated to any icon.
+         */
+        void
+        insertItems(const std::vector<std::string>& texts,
+                    const std::vector<std::string>& icons = std::vector<std::string>());
+
         void
         removeItem(int index);
 
@@ -128,6 +157,28 @@ namespace sdl {
         bool
         resizeEvent(core::engine::ResizeEvent& e) override;
 
+        /**
+         * @brief - Reimplementation of the base `SdlWidget` method to allow scrolling through the
+         *          items of the combobox when it is dropped. Only the rows currently displayed are
+         *          updated to represent the new visible items.
+         * @param e - the mouse event describing the wheel motion.
+         * @return - `true` if the event was recognized, `false` otherwise.
+         */
+        bool
+        mouseWheelEvent(const core::engine::MouseEvent& e) override;
+
+        /**
+         * @brief - Reimplementation of the base `SdlWidget` method to provide type-ahead search
+         *          in the items of the combobox. Printable characters are appended to the current
+         *          search and `BackSpace` removes the last one. When dropped only the items which
+         *          start with the search are displayed and `Return` activates the first one. When
+         *          closed the first matching item is directly activated.
+         * @param e - the key event to process.
+         * @return - `true` if the event was recognized, `false` otherwise.
+         */
+        bool
+        keyPressEvent(const core::engine::KeyEvent& e) override;
+
         /**
          * @brief - Reimplementation of the base `SdlWidget` method to provide custom behavior
          *          upon clicking on the main icon and text element when the combobox has a
@@ -191,6 +242,18 @@ namespace sdl {
         std::pair<int, bool>
         getIndexFromInsertPolicy(const std::string& text) const;
 
+        /**
+         * @brief - Used to determine the index at which the input `text` should be inserted so
+         *          that the items stay in alphabetical order. Items with the same text as the
+         *          input one are kept before it.
+         *          In case the items are known to be sorted (see `m_itemsSorted`) a binary search
+         *          is used, otherwise all the items are scanned.
+         * @param text - the text for which the alphabetical rank should be computed.
+         * @return - the index at which the `text` should be inserted.
+         */
+        int
+        getAlphabeticalRank(const std::string& text) const noexcept;
+
         /**
          * @brief - Assign a new active item to the combobox. The item is checked against internal
          *          data to determine whether it actually exists and the corresponding display is
@@ -227,6 +290,155 @@ namespace sdl {
         void
         setState(const State& state);
 
+        /**
+         * @brief - Used to update the rows displaying the items of the combobox. The rows are
+         *          rented from the shared popup when the combobox is dropped and are never more
+         *          than `m_maxVisibleItems`: each one is bound to the item located at the index
+         *          `m_firstVisibleItem` plus its index. Rows which do not correspond to any item
+         *          are hidden.
+         *          This means that the cost of this method only depends on the number of visible
+         *          items and not on the total number of items in the combobox.
+         */
+        void
+        updateRows();
+
+        /**
+         * @brief - Used to create the widgets representing the row at the specified index. The
+         *          widgets are not attached to any parent: this is handled when the row is rented
+         *          by a combobox.
+         * @param row - the index of the row to create.
+         * @return - the row created.
+         */
+        ComboBoxPopup::Row
+        createRow(int row) const;
+
+        /**
+         * @brief - Used to rent the rows needed to display the items from the shared popup when
+         *          the combobox is dropped. The missing rows are created if needed. All the rows
+         *          are inserted in the layout and connected so that a click on one of them will
+         *          activate the item it currently represents.
+         */
+        void
+        acquireRows();
+
+        /**
+         * @brief - Used to detach the rows rented from the shared popup and hand them back when
+         *          the combobox is closed.
+         */
+        void
+        releaseRows();
+
+        /**
+         * @brief - Called by the shared popup when another combobox needs the rows rented by this
+         *          one: the combobox is closed which hands back the rows.
+         */
+        void
+        revokeRows();
+
+        /**
+         * @brief - Used to clamp the index of the first visible item so that the rows always
+         *          display existing items: the last row should not be scrolled past the last
+         *          item of the combobox.
+         * @param first - the desired index of the first visible item.
+         * @return - the index of the first visible item to use.
+         */
+        int
+        clampFirstVisibleItem(int first) const noexcept;
+
+        /**
+         * @brief - Used to scroll the list of items by the specified amount of rows. Positive
+         *          values display items further in the list. The rows are updated if the scroll
+         *          actually changed the first visible item.
+         * @param delta - the number of rows to scroll by.
+         */
+        void
+        scrollRows(int delta);
+
+        /**
+         * @brief - Returns `true` if a type-ahead search is active, in which case only the items
+         *          matching the search are displayed.
+         * @return - `true` if the items are filtered by a search.
+         */
+        bool
+        isFiltered() const noexcept;
+
+        /**
+         * @brief - Used to retrieve the number of items which can be displayed in the rows of the
+         *          combobox: this is either all the items or only the ones matching the current
+         *          search if any.
+         * @return - the number of items that can be displayed.
+         */
+        int
+        getDisplayedItemsCount() const noexcept;
+
+        /**
+         * @brief - Used to retrieve the index of the item displayed by the input row, accounting
+         *          for both the scrolling and the current search if any.
+         *          Note that no check is performed to verify that the row actually displays an
+         *          item.
+         * @param row - the index of the row.
+         * @return - the index of the item displayed by the row.
+         */
+        int
+        getItemFromRow(int row) const noexcept;
+
+        /**
+         * @brief - Compares the items at the input indices in the order used by the search index:
+         *          items are sorted alphabetically and items with the same text are sorted based
+         *          on their index.
+         * @param lhs - the index of the first item.
+         * @param rhs - the index of the second item.
+         * @return - `true` if the item at `lhs` comes before the item at `rhs`.
+         */
+        bool
+        compareSearchEntries(int lhs,
+                             int rhs) const noexcept;
+
+        /**
+         * @brief - Used to register the item which has just been inserted at `index` in the search
+         *          index. The indices of the items located after it are shifted accordingly: this
+         *          is linear in the number of items unless the item is the last one, in which case
+         *          the registration is logarithmic (plus the insertion in the index).
+         * @param index - the index of the item inserted.
+         */
+        void
+        registerInSearchIndex(int index);
+
+        /**
+         * @brief - Used to remove the item at `index` from the search index. This method should be
+         *          called before the item is actually removed. The indices of the items located
+         *          after it are shifted accordingly, which is skipped for the last item.
+         * @param index - the index of the item which will be removed.
+         */
+        void
+        unregisterFromSearchIndex(int index);
+
+        /**
+         * @brief - Used to rebuild the search index from scratch, typically after a large amount
+         *          of items have been inserted in a single operation.
+         */
+        void
+        rebuildSearchIndex();
+
+        /**
+         * @brief - Used to compute the range of the search index containing the items starting with
+         *          the current search. The range is computed with a binary search: if `narrow` is
+         *          `true` only the current range is searched, which is the case when a character
+         *          has just been appended to the search.
+         * @param narrow - `true` if the search should be restricted to the current matches.
+         */
+        void
+        updateMatches(bool narrow);
+
+        /**
+         * @brief - Assigns a new type-ahead search to this combobox and updates the display of the
+         *          items accordingly: if the combobox is dropped only the matching items are shown,
+         *          otherwise the first matching item is activated.
+         * @param search - the new search. An empty string displays all the items.
+         */
+        void
+        setSearch(const std::string& search);
+
         /**
          * @brief - Used to retrieve the size of this combobox when it is dropped. We use the box
          *          describing the size of the box when closed (held in the internal `m_closedBox`
@@ -272,10 +484,13 @@ namespace sdl {
         onElementClicked(const std::string& name);
 
         /**
-         * @brief - Retrieves the identifier of the item corresponding to the widget's
-         *          name. We assume that the name comes from one of the children that
-         *          has been inserted in this combobox and should look something like
+         * @brief - Retrieves the index of the row corresponding to the widget's name.
+         *          We assume that the name comes from one of the children that has
+         *          been inserted in this combobox and should look something like
          *          `icon_widget_ID` or `text_widget_ID`.
+         *          Note that the rows are recycled while scrolling so the returned
+         *          value should be offset by `m_firstVisibleItem` to get the index of
+         *          the item.
          *          Error is raised if the name does not seem to match this convention
          *          otherwise the id is returned.
          *          Note that if the name matches the convention but the retrieved id
@@ -303,6 +518,12 @@ namespace sdl {
 
         using ItemsMap = std::vector<ComboBoxItem>;
 
+        /**
+         * @brief - Convenience define for the search index: holds the indices of the items sorted
+         *          alphabetically so that the items starting with a given prefix form a range.
+         */
+        using SearchIndex = std::vector<int>;
+
         /**
          * @brief - Convenience value describing the defautl z order to apply to combo boxes. This
          *          value is larger than the default one provided for widgets in general which is
@@ -329,6 +550,38 @@ namespace sdl {
 
         int m_activeItem;
         ItemsMap m_items;
+
+        /**
+         * @brief - Whether the items are currently sorted in alphabetical order. This is always the
+         *          case when only the alphabetical policy is used to insert items but inserting at
+         *          a specific index might break it. This allows to use a binary search to find the
+         *          alphabetical rank of an item whenever possible.
+         */
+        bool m_itemsSorted;
+
+        /**
+         * @brief - The index of the item displayed in the first row of the combobox when it is
+         *          dropped. Only a fixed number of rows is created and they are bound to the items
+         *          starting at this index.
+         */
+        int m_firstVisibleItem;
+
+        /**
+         * @brief - The rows rented from the shared popup while the combobox is dropped. This is
+         *          empty when the combobox is closed so that only the combobox currently dropped
+         *          holds widgets to display its items.
+         */
+        ComboBoxPopup::Rows m_rows;
+
+        /**
+         * @brief - The index of the items sorted alphabetically, along with the current type-ahead
+         *          search and the range of the index containing the items matching it. The index
+         *          is maintained each time an item is inserted or removed.
+         */
+        SearchIndex m_searchIndex;
+        std::string m_search;
+        int m_firstMatch;
+        int m_lastMatch;
     };
 
     using ComboBoxShPtr = std::shared_ptr<ComboBox>;
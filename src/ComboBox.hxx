@@ -89,6 +89,56 @@ namespace sdl {
       return std::max(1, std::min(getItemsCount(), m_maxVisibleItems));
     }
 
+    inline
+    int
+    ComboBox::clampFirstVisibleItem(int first) const noexcept {
+      return std::max(0, std::min(first, getDisplayedItemsCount() - getVisibleItemsCount()));
+    }
+
+    inline
+    void
+    ComboBox::scrollRows(int delta) {
+      const int first = clampFirstVisibleItem(m_firstVisibleItem + delta);
+
+      if (first == m_firstVisibleItem) {
+        return;
+      }
+
+      m_firstVisibleItem = first;
+
+      updateRows();
+    }
+
+    inline
+    bool
+    ComboBox::isFiltered() const noexcept {
+      return !m_search.empty();
+    }
+
+    inline
+    int
+    ComboBox::getDisplayedItemsCount() const noexcept {
+      return (isFiltered() ? m_lastMatch - m_firstMatch : getItemsCount());
+    }
+
+    inline
+    int
+    ComboBox::getItemFromRow(int row) const noexcept {
+      const int id = m_firstVisibleItem + row;
+
+      return (isFiltered() ? m_searchIndex[m_firstMatch + id] : id);
+    }
+
+    inline
+    bool
+    ComboBox::compareSearchEntries(int lhs,
+                                   int rhs) const noexcept
+    {
+      const int comp = m_items[lhs].text.compare(m_items[rhs].text);
+
+      return comp < 0 || (comp == 0 && lhs < rhs);
+    }
+
     inline
     std::string
     ComboBox::getIconNameFromID(int id) const noexcept {
@@ -134,12 +184,12 @@ namespace sdl {
         );
       }
 
-      // Check whether this item is valid (i.e. is within the acceptable id
+      // Check whether this row is valid (i.e. is within the acceptable id
       // range).
-      if (val < 0 || val >= getItemsCount()) {
+      if (val < 0 || val >= getVisibleItemsCount()) {
         error(
           std::string("Could not determine id from name \"") + name + "\"",
-          std::string("Identifier ") + std::to_string(val) + " is not in acceptable range [0; " + std::to_string(getItemsCount()) + "]"
+          std::string("Identifier ") + std::to_string(val) + " is not in acceptable range [0; " + std::to_string(getVisibleItemsCount()) + "]"
         );
       }
 
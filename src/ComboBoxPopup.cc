@@ -0,0 +1,112 @@
+# include "ComboBoxPopup.hh"
+# include "ComboBox.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    ComboBoxPopup::ComboBoxPopup():
+      utils::CoreObject(std::string("combobox_popup")),
+
+      m_locker(),
+
+      m_owner(nullptr),
+
+      m_rows()
+    {
+      setService(std::string("combobox"));
+    }
+
+    ComboBoxPopup&
+    ComboBoxPopup::getInstance() {
+      static ComboBoxPopup popup;
+
+      return popup;
+    }
+
+    ComboBoxPopup::Rows
+    ComboBoxPopup::rent(ComboBox* owner,
+                        int count)
+    {
+      // Close the combobox currently renting the rows if any: this will hand
+      // them back. We can't keep the locker while doing so as the combobox
+      // will call `giveBack`.
+      ComboBox* previous = nullptr;
+      {
+        std::lock_guard<std::mutex> guard(m_locker);
+        previous = m_owner;
+      }
+
+      if (previous != nullptr && previous != owner) {
+        log(
+          std::string("Revoking rows of \"") + previous->getName() + "\" for \"" + owner->getName() + "\"",
+          utils::Level::Warning
+        );
+
+        previous->revokeRows();
+      }
+
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      // Hand out as many rows as possible: the rows are kept in the popup as
+      // they will be handed back when the combobox closes.
+      const unsigned taken = std::min(static_cast<unsigned>(std::max(0, count)), static_cast<unsigned>(m_rows.size()));
+
+      m_owner = owner;
+
+      return Rows(m_rows.cbegin(), m_rows.cbegin() + taken);
+    }
+
+    void
+    ComboBoxPopup::giveBack(ComboBox* owner,
+                            Rows& rows)
+    {
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      // Keep the rows for future rentals: this includes the rows created by
+      // the combobox itself if the popup did not have enough of them.
+      for (unsigned id = 0u ; id < rows.size() ; ++id) {
+        if (id < m_rows.size()) {
+          m_rows[id] = rows[id];
+        }
+        else {
+          m_rows.push_back(rows[id]);
+        }
+      }
+
+      rows.clear();
+
+      if (owner == m_owner) {
+        m_owner = nullptr;
+      }
+    }
+
+    void
+    ComboBoxPopup::clear() {
+      // Close the combobox currently renting the rows if any so that they are
+      // handed back before being deleted.
+      ComboBox* previous = nullptr;
+      {
+        std::lock_guard<std::mutex> guard(m_locker);
+        previous = m_owner;
+      }
+
+      if (previous != nullptr) {
+        previous->revokeRows();
+      }
+
+      // The rows are deleted outside of the locker: they are not attached to
+      // any widget at this point.
+      Rows rows;
+      {
+        std::lock_guard<std::mutex> guard(m_locker);
+        rows.swap(m_rows);
+      }
+
+      for (unsigned id = 0u ; id < rows.size() ; ++id) {
+        delete rows[id].icon;
+        delete rows[id].text;
+      }
+    }
+
+  }
+}
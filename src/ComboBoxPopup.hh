@@ -0,0 +1,126 @@
+#ifndef    COMBO_BOX_POPUP_HH
+# define   COMBO_BOX_POPUP_HH
+
+# include <mutex>
+# include <vector>
+# include <algorithm>
+# include <core_utils/CoreObject.hh>
+# include "LabelWidget.hh"
+# include "PictureWidget.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    class ComboBox;
+
+    class ComboBoxPopup: public utils::CoreObject {
+      public:
+
+        /**
+         * @brief - Describes a row of the popup: it is composed of an icon and a text
+         *          widget along with the identifiers of the connections registered by
+         *          the combobox currently renting the row.
+         */
+        struct Row {
+          PictureWidget* icon;
+          LabelWidget* text;
+          int iconClickID;
+          int textClickID;
+        };
+
+        using Rows = std::vector<Row>;
+
+      public:
+
+        /**
+         * @brief - Retrieves the popup shared by all the comboboxes of the library.
+         * @return - the shared popup.
+         */
+        static
+        ComboBoxPopup&
+        getInstance();
+
+        /**
+         * @brief - Note that the rows still available in the popup when it is destroyed
+         *          are not deleted: this happens upon terminating the process at which
+         *          point the engine may not be available anymore. The `clear` method is
+         *          used to delete them beforehand.
+         */
+        ~ComboBoxPopup();
+
+        /**
+         * @brief - Used by a combobox to rent the rows of the popup when it is dropped.
+         *          Only a single combobox can rent the rows at any time: if another one
+         *          currently holds them it is closed first so that it hands them back.
+         *          The rows returned are not attached to any widget and the renter is
+         *          responsible for inserting them in its hierarchy. The rows are always
+         *          returned in the same order so that the row at index `i` is always
+         *          the same. The popup might not have enough rows, in which case the
+         *          renter should create the missing ones and hand them back along with
+         *          the others.
+         * @param owner - the combobox renting the rows.
+         * @param count - the number of rows needed by the combobox.
+         * @return - at most `count` rows available for the combobox.
+         */
+        Rows
+        rent(ComboBox* owner,
+             int count);
+
+        /**
+         * @brief - Used by a combobox to hand back the rows it rented when it closes.
+         *          The rows should already be detached from the combobox's hierarchy
+         *          and be provided in the order in which they were rented.
+         * @param owner - the combobox handing back the rows.
+         * @param rows - the rows to hand back. This vector is emptied by this method.
+         */
+        void
+        giveBack(ComboBox* owner,
+                 Rows& rows);
+
+        /**
+         * @brief - Retrieves the number of rows handed back to the popup so far: this is
+         *          the size of the largest list displayed by a combobox.
+         * @return - the number of rows owned by the popup.
+         */
+        unsigned
+        getRowsCount();
+
+        /**
+         * @brief - Deletes the rows owned by the popup. The combobox currently renting
+         *          them if any is closed first so that it hands them back. This should
+         *          be called while the engine is still alive: this is done when it is
+         *          detached (see `EngineHandle::detach`). The popup can still be used
+         *          afterwards, new rows being created as needed.
+         */
+        void
+        clear();
+
+      private:
+
+        ComboBoxPopup();
+
+      private:
+
+        /**
+         * @brief - Protects concurrent accesses to the popup.
+         */
+        std::mutex m_locker;
+
+        /**
+         * @brief - The combobox currently renting the rows if any.
+         */
+        ComboBox* m_owner;
+
+        /**
+         * @brief - The rows of the popup. They are kept in the order in which they were
+         *          rented: this allows a renter to name its rows based on their index.
+         */
+        Rows m_rows;
+    };
+
+  }
+}
+
+# include "ComboBoxPopup.hxx"
+
+#endif    /* COMBO_BOX_POPUP_HH */
@@ -0,0 +1,23 @@
+#ifndef    COMBO_BOX_POPUP_HXX
+# define   COMBO_BOX_POPUP_HXX
+
+# include "ComboBoxPopup.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    inline
+    ComboBoxPopup::~ComboBoxPopup() {}
+
+    inline
+    unsigned
+    ComboBoxPopup::getRowsCount() {
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      return m_rows.size();
+    }
+
+  }
+}
+
+#endif    /* COMBO_BOX_POPUP_HXX */
@@ -0,0 +1,86 @@
+#ifndef    DEFERRED_NOTIFIER_HH
+# define   DEFERRED_NOTIFIER_HH
+
+# include <memory>
+# include <sdl_core/SdlWidget.hh>
+
+namespace sdl {
+  namespace graphic {
+
+    class DeferredNotifier {
+      public:
+
+        /**
+         * @brief - Describes how a repaint event relates to the notification.
+         */
+        enum class Reception {
+          None,   //<!- The event is not the notification.
+          Alone,  //<!- The event is the notification and can be consumed.
+          Merged  //<!- The notification was merged with other repaint events.
+        };
+
+      public:
+
+        /**
+         * @brief - Creates a notifier with no pending notification. A notifier allows a
+         *          widget to be called back from the events loop, typically once a frame
+         *          has been drawn or to report changes happening on another thread: the
+         *          widget posts the event provided by `request` and handles it in its
+         *          `repaintEvent` method through `receive`.
+         *          At most one notification is pending at any time so that requesting
+         *          several ones before the first is received results in a single call.
+         *          The notifier does not provide any locking mechanism: it should be
+         *          protected by the locker of the widget if needed.
+         */
+        DeferredNotifier();
+
+        ~DeferredNotifier() = default;
+
+        /**
+         * @brief - Determines whether a notification has been requested and not received
+         *          yet.
+         * @return - `true` if a notification is pending.
+         */
+        bool
+        pending() const noexcept;
+
+        /**
+         * @brief - Requests a notification for the input widget. The returned event should
+         *          be posted by the widget. Nothing happens if a notification is already
+         *          pending, in which case a null event is returned.
+         * @param widget - the widget to notify.
+         * @return - the event to post or `null` if a notification is already pending.
+         */
+        std::shared_ptr<core::engine::PaintEvent>
+        request(core::SdlWidget* widget);
+
+        /**
+         * @brief - Determines whether the input repaint event is the pending notification
+         *          for the widget. The events loop may merge the posted event with other
+         *          repaint events of the widget: in this case the notification is still
+         *          received but the event should be processed as a regular repaint too.
+         *          Receiving the notification makes it possible to request a new one.
+         * @param e - the repaint event received by the widget.
+         * @param widget - the widget receiving the event.
+         * @return - whether the event carries the notification and if it was merged with
+         *           other events.
+         */
+        Reception
+        receive(const core::engine::PaintEvent& e,
+                core::SdlWidget* widget);
+
+      private:
+
+        /**
+         * @brief - The event posted for the pending notification if any. It is kept until
+         *          received so that it can be told apart from other repaint events.
+         */
+        std::shared_ptr<core::engine::PaintEvent> m_event;
+    };
+
+  }
+}
+
+# include "DeferredNotifier.hxx"
+
+#endif    /* DEFERRED_NOTIFIER_HH */
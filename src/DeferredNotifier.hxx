@@ -0,0 +1,55 @@
+#ifndef    DEFERRED_NOTIFIER_HXX
+# define   DEFERRED_NOTIFIER_HXX
+
+# include "DeferredNotifier.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    inline
+    DeferredNotifier::DeferredNotifier():
+      m_event()
+    {}
+
+    inline
+    bool
+    DeferredNotifier::pending() const noexcept {
+      return m_event != nullptr;
+    }
+
+    inline
+    std::shared_ptr<core::engine::PaintEvent>
+    DeferredNotifier::request(core::SdlWidget* widget) {
+      if (m_event != nullptr) {
+        return nullptr;
+      }
+
+      // The event does not carry any update region: it concerns the whole
+      // widget but is only meant to be recognized when received.
+      m_event = std::make_shared<core::engine::PaintEvent>(widget);
+      m_event->setEmitter(widget);
+
+      return m_event;
+    }
+
+    inline
+    DeferredNotifier::Reception
+    DeferredNotifier::receive(const core::engine::PaintEvent& e,
+                              core::SdlWidget* widget)
+    {
+      if (m_event == nullptr || !e.isEmittedBy(widget)) {
+        return Reception::None;
+      }
+
+      // The event received is a different object when the posted one was
+      // merged with other repaint events.
+      const bool alone = (&e == m_event.get());
+      m_event.reset();
+
+      return (alone ? Reception::Alone : Reception::Merged);
+    }
+
+  }
+}
+
+#endif    /* DEFERRED_NOTIFIER_HXX */
@@ -0,0 +1,178 @@
+# include "DirtyRegion.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    void
+    DirtyRegion::add(const utils::Boxf& box) {
+      if (box.w() <= 0.0f || box.h() <= 0.0f) {
+        return;
+      }
+
+      // Remove from the input box the parts already covered by the region so
+      // that the boxes stay disjoint.
+      std::vector<utils::Boxf> pieces(1u, box);
+
+      for (unsigned id = 0u ; id < m_boxes.size() && !pieces.empty() ; ++id) {
+        std::vector<utils::Boxf> remaining;
+
+        for (unsigned p = 0u ; p < pieces.size() ; ++p) {
+          std::vector<utils::Boxf> split = subtract(pieces[p], m_boxes[id]);
+          remaining.insert(remaining.end(), split.begin(), split.end());
+        }
+
+        pieces.swap(remaining);
+      }
+
+      m_boxes.insert(m_boxes.end(), pieces.begin(), pieces.end());
+
+      // Many overlapping boxes fragment the region: past a certain count it
+      // is cheaper to repaint a single larger box.
+      if (m_boxes.size() > getMaximumBoxes()) {
+        collapse();
+      }
+    }
+
+    void
+    DirtyRegion::subtract(const utils::Boxf& box) {
+      std::vector<utils::Boxf> remaining;
+
+      for (unsigned id = 0u ; id < m_boxes.size() ; ++id) {
+        std::vector<utils::Boxf> split = subtract(m_boxes[id], box);
+        remaining.insert(remaining.end(), split.begin(), split.end());
+      }
+
+      m_boxes.swap(remaining);
+    }
+
+    void
+    DirtyRegion::simplify() {
+      // Repeatedly merge the pair of boxes which adds the smallest area when
+      // replaced by its bounding box, as long as this area is worth less than
+      // the cost of keeping a separate box. The bounding box also absorbs the
+      // other boxes it contains: as boxes are disjoint the area added is the
+      // part of the bounding box not covered by any of them.
+      // Candidates partially overlapping other boxes are ignored: this makes
+      // sure that each merge reduces the number of boxes.
+      // Only the boxes which are close in the order of their left bound are
+      // considered for a merge so that the number of pairs stays linear in
+      // the number of boxes.
+      bool merged = true;
+
+      while (merged && m_boxes.size() > 1u) {
+        merged = false;
+
+        std::sort(
+          m_boxes.begin(),
+          m_boxes.end(),
+          [](const utils::Boxf& lhs, const utils::Boxf& rhs) {
+            return lhs.getLeftBound() < rhs.getLeftBound();
+          }
+        );
+
+        float best = m_regionCost;
+        unsigned bestI = 0u, bestJ = 0u;
+
+        for (unsigned i = 0u ; i < m_boxes.size() ; ++i) {
+          const unsigned last = std::min(static_cast<unsigned>(m_boxes.size()), i + 1u + getMergeCandidates());
+
+          for (unsigned j = i + 1u ; j < last ; ++j) {
+            utils::Boxf bbox = bounding(m_boxes[i], m_boxes[j]);
+
+            float covered = 0.0f;
+            bool partial = false;
+
+            for (unsigned k = 0u ; k < m_boxes.size() && !partial ; ++k) {
+              if (!overlap(bbox, m_boxes[k])) {
+                continue;
+              }
+
+              if (!contains(bbox, m_boxes[k])) {
+                partial = true;
+              }
+
+              covered += m_boxes[k].w() * m_boxes[k].h();
+            }
+
+            const float waste = bbox.w() * bbox.h() - covered;
+
+            if (!partial && waste <= best) {
+              best = waste;
+              bestI = i;
+              bestJ = j;
+              merged = true;
+            }
+          }
+        }
+
+        if (!merged) {
+          continue;
+        }
+
+        // Replace the boxes contained in the bounding box by the bounding box.
+        utils::Boxf bbox = bounding(m_boxes[bestI], m_boxes[bestJ]);
+
+        std::vector<utils::Boxf> remaining(1u, bbox);
+
+        for (unsigned id = 0u ; id < m_boxes.size() ; ++id) {
+          if (!overlap(bbox, m_boxes[id])) {
+            remaining.push_back(m_boxes[id]);
+          }
+        }
+
+        m_boxes.swap(remaining);
+      }
+    }
+
+    void
+    DirtyRegion::collapse() {
+      if (m_boxes.empty()) {
+        return;
+      }
+
+      utils::Boxf bbox = m_boxes.front();
+
+      for (unsigned id = 1u ; id < m_boxes.size() ; ++id) {
+        bbox = bounding(bbox, m_boxes[id]);
+      }
+
+      m_boxes.assign(1u, bbox);
+    }
+
+    std::vector<utils::Boxf>
+    DirtyRegion::subtract(const utils::Boxf& from,
+                          const utils::Boxf& box)
+    {
+      std::vector<utils::Boxf> out;
+
+      if (!overlap(from, box)) {
+        out.push_back(from);
+        return out;
+      }
+
+      // Compute the intersection of both boxes: the remaining parts are the
+      // full height strips on the left and right of the intersection and the
+      // strips above and below it.
+      const float left = std::max(from.getLeftBound(), box.getLeftBound());
+      const float right = std::min(from.getRightBound(), box.getRightBound());
+      const float bottom = std::max(from.getBottomBound(), box.getBottomBound());
+      const float top = std::min(from.getTopBound(), box.getTopBound());
+
+      if (from.getLeftBound() < left) {
+        out.push_back(fromBounds(from.getLeftBound(), left, from.getBottomBound(), from.getTopBound()));
+      }
+      if (right < from.getRightBound()) {
+        out.push_back(fromBounds(right, from.getRightBound(), from.getBottomBound(), from.getTopBound()));
+      }
+      if (from.getBottomBound() < bottom) {
+        out.push_back(fromBounds(left, right, from.getBottomBound(), bottom));
+      }
+      if (top < from.getTopBound()) {
+        out.push_back(fromBounds(left, right, top, from.getTopBound()));
+      }
+
+      return out;
+    }
+
+  }
+}
@@ -0,0 +1,191 @@
+#ifndef    DIRTY_REGION_HH
+# define   DIRTY_REGION_HH
+
+# include <vector>
+# include <algorithm>
+# include <maths_utils/Box.hh>
+# include <maths_utils/Vector2.hh>
+
+namespace sdl {
+  namespace graphic {
+
+    class DirtyRegion {
+      public:
+
+        /**
+         * @brief - Creates an empty region. A region is a set of disjoint boxes which
+         *          describes the areas to repaint. Boxes can be added and subtracted
+         *          and the region can be simplified so that it contains only a few
+         *          boxes while not covering too much area which doesn't need to be
+         *          repainted.
+         * @param regionCost - the cost of an additional box in the region expressed
+         *                     as an area. It is used when simplifying the region: two
+         *                     boxes are merged whenever the area their bounding box
+         *                     adds is less than this cost.
+         */
+        DirtyRegion(float regionCost = getDefaultRegionCost());
+
+        ~DirtyRegion() = default;
+
+        /**
+         * @brief - Adds the input box to the region. Only the parts of the box which
+         *          are not already covered by the region are added. In case the region
+         *          gets split into too many boxes it is replaced by its bounding box:
+         *          this keeps the cost of the operations on the region bounded.
+         * @param box - the box to add.
+         */
+        void
+        add(const utils::Boxf& box);
+
+        /**
+         * @brief - Removes the input box from the region. Boxes partially covered by
+         *          the input box are split.
+         * @param box - the box to remove.
+         */
+        void
+        subtract(const utils::Boxf& box);
+
+        /**
+         * @brief - Merges boxes of the region as long as the area added by replacing
+         *          two boxes by their bounding box is smaller than the cost of a box.
+         *          Only the boxes close to each other along the horizontal axis are
+         *          considered for a merge (see `getMergeCandidates`).
+         *          The area covered by the region can only grow in the process.
+         */
+        void
+        simplify();
+
+        /**
+         * @brief - Removes all the boxes from the region.
+         */
+        void
+        clear() noexcept;
+
+        bool
+        empty() const noexcept;
+
+        /**
+         * @brief - Retrieves the disjoint boxes composing the region.
+         * @return - the boxes of the region.
+         */
+        const std::vector<utils::Boxf>&
+        getBoxes() const noexcept;
+
+        /**
+         * @brief - Computes the parts of the `from` box which are not covered by the
+         *          `box`. At most four boxes are produced.
+         * @param from - the box to subtract from.
+         * @param box - the box to subtract.
+         * @return - the disjoint boxes covering `from` minus `box`.
+         */
+        static
+        std::vector<utils::Boxf>
+        subtract(const utils::Boxf& from,
+                 const utils::Boxf& box);
+
+      private:
+
+        /**
+         * @brief - The default cost of a box, expressed as an area: repainting a box
+         *          has a fixed overhead roughly equivalent to repainting this many
+         *          pixels.
+         * @return - the default cost of a box.
+         */
+        static
+        float
+        getDefaultRegionCost() noexcept;
+
+        /**
+         * @brief - The maximum number of boxes of the region: past this count the region
+         *          is replaced by its bounding box.
+         * @return - the maximum number of boxes of the region.
+         */
+        static
+        unsigned
+        getMaximumBoxes() noexcept;
+
+        /**
+         * @brief - The number of boxes following a box in the order of their left bound
+         *          with which it can be merged when simplifying the region. This avoids
+         *          considering all the pairs of boxes.
+         * @return - the number of merge candidates for each box.
+         */
+        static
+        unsigned
+        getMergeCandidates() noexcept;
+
+        /**
+         * @brief - Replaces the boxes of the region by their bounding box.
+         */
+        void
+        collapse();
+
+        /**
+         * @brief - Creates a box from its bounds.
+         * @param left - the left bound of the box.
+         * @param right - the right bound of the box.
+         * @param bottom - the bottom bound of the box.
+         * @param top - the top bound of the box.
+         * @return - the corresponding box.
+         */
+        static
+        utils::Boxf
+        fromBounds(float left,
+                   float right,
+                   float bottom,
+                   float top) noexcept;
+
+        /**
+         * @brief - Determines whether both boxes overlap, i.e. have an intersection
+         *          with a strictly positive area.
+         * @param lhs - the first box.
+         * @param rhs - the second box.
+         * @return - `true` if both boxes overlap.
+         */
+        static
+        bool
+        overlap(const utils::Boxf& lhs,
+                const utils::Boxf& rhs) noexcept;
+
+        /**
+         * @brief - Determines whether the `inner` box is entirely contained in the
+         *          `outer` box.
+         * @param outer - the containing box.
+         * @param inner - the box which should be contained.
+         * @return - `true` if `inner` is inside `outer`.
+         */
+        static
+        bool
+        contains(const utils::Boxf& outer,
+                 const utils::Boxf& inner) noexcept;
+
+        /**
+         * @brief - Computes the bounding box of both input boxes.
+         * @param lhs - the first box.
+         * @param rhs - the second box.
+         * @return - the smallest box containing both boxes.
+         */
+        static
+        utils::Boxf
+        bounding(const utils::Boxf& lhs,
+                 const utils::Boxf& rhs) noexcept;
+
+      private:
+
+        /**
+         * @brief - The cost of a box, used to simplify the region.
+         */
+        float m_regionCost;
+
+        /**
+         * @brief - The disjoint boxes composing the region.
+         */
+        std::vector<utils::Boxf> m_boxes;
+    };
+
+  }
+}
+
+# include "DirtyRegion.hxx"
+
+#endif    /* DIRTY_REGION_HH */
@@ -0,0 +1,104 @@
+#ifndef    DIRTY_REGION_HXX
+# define   DIRTY_REGION_HXX
+
+# include "DirtyRegion.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    inline
+    DirtyRegion::DirtyRegion(float regionCost):
+      m_regionCost(regionCost),
+
+      m_boxes()
+    {}
+
+    inline
+    void
+    DirtyRegion::clear() noexcept {
+      m_boxes.clear();
+    }
+
+    inline
+    bool
+    DirtyRegion::empty() const noexcept {
+      return m_boxes.empty();
+    }
+
+    inline
+    const std::vector<utils::Boxf>&
+    DirtyRegion::getBoxes() const noexcept {
+      return m_boxes;
+    }
+
+    inline
+    float
+    DirtyRegion::getDefaultRegionCost() noexcept {
+      return 1024.0f;
+    }
+
+    inline
+    unsigned
+    DirtyRegion::getMaximumBoxes() noexcept {
+      return 32u;
+    }
+
+    inline
+    unsigned
+    DirtyRegion::getMergeCandidates() noexcept {
+      return 4u;
+    }
+
+    inline
+    utils::Boxf
+    DirtyRegion::fromBounds(float left,
+                            float right,
+                            float bottom,
+                            float top) noexcept
+    {
+      return utils::Boxf(
+        utils::Vector2f((left + right) / 2.0f, (bottom + top) / 2.0f),
+        right - left,
+        top - bottom
+      );
+    }
+
+    inline
+    bool
+    DirtyRegion::overlap(const utils::Boxf& lhs,
+                         const utils::Boxf& rhs) noexcept
+    {
+      return
+        std::max(lhs.getLeftBound(), rhs.getLeftBound()) < std::min(lhs.getRightBound(), rhs.getRightBound()) &&
+        std::max(lhs.getBottomBound(), rhs.getBottomBound()) < std::min(lhs.getTopBound(), rhs.getTopBound())
+      ;
+    }
+
+    inline
+    bool
+    DirtyRegion::contains(const utils::Boxf& outer,
+                          const utils::Boxf& inner) noexcept
+    {
+      return
+        outer.getLeftBound() <= inner.getLeftBound() && inner.getRightBound() <= outer.getRightBound() &&
+        outer.getBottomBound() <= inner.getBottomBound() && inner.getTopBound() <= outer.getTopBound()
+      ;
+    }
+
+    inline
+    utils::Boxf
+    DirtyRegion::bounding(const utils::Boxf& lhs,
+                          const utils::Boxf& rhs) noexcept
+    {
+      return fromBounds(
+        std::min(lhs.getLeftBound(), rhs.getLeftBound()),
+        std::max(lhs.getRightBound(), rhs.getRightBound()),
+        std::min(lhs.getBottomBound(), rhs.getBottomBound()),
+        std::max(lhs.getTopBound(), rhs.getTopBound())
+      );
+    }
+
+  }
+}
+
+#endif    /* DIRTY_REGION_HXX */
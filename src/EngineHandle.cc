@@ -0,0 +1,109 @@
+
+# include "EngineHandle.hh"
+# include "TextCache.hh"
+# include "ImageCache.hh"
+# include "FontRegistry.hh"
+# include "GradientCache.hh"
+# include "ComboBoxPopup.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    EngineHandle::EngineHandle(Releaser texture,
+                               Releaser font):
+      m_locker(),
+
+      m_texture(texture),
+      m_font(font)
+    {}
+
+    void
+    EngineHandle::destroyTexture(const utils::Uuid& texture) {
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      if (m_texture) {
+        m_texture(texture);
+      }
+    }
+
+    void
+    EngineHandle::destroyColoredFont(const utils::Uuid& font) {
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      if (m_font) {
+        m_font(font);
+      }
+    }
+
+    EngineHandleShPtr
+    EngineHandle::registerEngine(const void* engine,
+                                 Releaser texture,
+                                 Releaser font)
+    {
+      std::lock_guard<std::mutex> guard(getHandlesLocker());
+
+      HandlesMap& handles = getHandles();
+      HandlesMap::const_iterator it = handles.find(engine);
+
+      if (it != handles.cend()) {
+        return it->second;
+      }
+
+      EngineHandleShPtr handle(new EngineHandle(texture, font));
+      handles[engine] = handle;
+
+      return handle;
+    }
+
+    void
+    EngineHandle::unregisterEngine(const void* engine) {
+      EngineHandleShPtr handle;
+
+      {
+        std::lock_guard<std::mutex> guard(getHandlesLocker());
+
+        HandlesMap& handles = getHandles();
+        HandlesMap::iterator it = handles.find(engine);
+
+        if (it == handles.end()) {
+          return;
+        }
+
+        handle = it->second;
+        handles.erase(it);
+      }
+
+      // Delete the rows pooled by the comboboxes first: they hold resources
+      // obtained from the caches.
+      ComboBoxPopup::getInstance().clear();
+
+      // Release the resources cached for this engine: the texts are purged
+      // before the fonts used to render them.
+      TextCache::getInstance().purge(*handle);
+      ImageCache::getInstance().purge(*handle);
+      GradientCache::getInstance().purge(*handle);
+      FontRegistry::getInstance().purge(*handle);
+
+      // Any resource still referencing the handle cannot be released anymore.
+      std::lock_guard<std::mutex> guard(handle->m_locker);
+
+      handle->m_texture = nullptr;
+      handle->m_font = nullptr;
+    }
+
+    EngineHandle::HandlesMap&
+    EngineHandle::getHandles() {
+      static HandlesMap handles;
+
+      return handles;
+    }
+
+    std::mutex&
+    EngineHandle::getHandlesLocker() {
+      static std::mutex locker;
+
+      return locker;
+    }
+
+  }
+}
@@ -0,0 +1,148 @@
+#ifndef    ENGINE_HANDLE_HH
+# define   ENGINE_HANDLE_HH
+
+# include <map>
+# include <mutex>
+# include <memory>
+# include <functional>
+# include <core_utils/Uuid.hh>
+
+namespace sdl {
+  namespace graphic {
+
+    class EngineHandle;
+    using EngineHandleShPtr = std::shared_ptr<EngineHandle>;
+
+    class EngineHandle {
+      public:
+
+        /**
+         * @brief - Retrieves the handle representing the input engine, creating it if
+         *          needed. The process-wide caches of the library (fonts, texts, images
+         *          and gradients) keep such a handle rather than the engine itself: it
+         *          is used to release the resources they evict.
+         *          The handle stays valid until `detach` is called for the engine.
+         * @param engine - the engine for which a handle should be retrieved.
+         * @return - the handle of the engine.
+         */
+        template <typename Engine>
+        static
+        EngineHandleShPtr
+        attach(Engine& engine);
+
+        /**
+         * @brief - Releases all the resources cached by the library which were created
+         *          through the input engine and invalidates its handle: any resource
+         *          released afterwards through the handle is ignored. The rows pooled
+         *          by the comboboxes are deleted as well.
+         *          This should be called while the engine is still alive, typically
+         *          right before destroying it. Resources still used by some widgets at
+         *          this point cannot be released and are reported.
+         *          Note that nothing in the library calls this method: the application
+         *          owning the engine is responsible for it (see the README). Otherwise
+         *          the caches keep resources that can no longer be released.
+         * @param engine - the engine to detach.
+         */
+        template <typename Engine>
+        static
+        void
+        detach(Engine& engine);
+
+        ~EngineHandle() = default;
+
+        /**
+         * @brief - Determines whether the engine represented by this handle is still
+         *          attached.
+         * @return - `true` if resources can still be released through this handle.
+         */
+        bool
+        valid();
+
+        /**
+         * @brief - Destroys the input texture through the engine if it is still
+         *          attached. Nothing happens otherwise.
+         * @param texture - the texture to destroy.
+         */
+        void
+        destroyTexture(const utils::Uuid& texture);
+
+        /**
+         * @brief - Destroys the input font through the engine if it is still attached.
+         *          Nothing happens otherwise.
+         * @param font - the font to destroy.
+         */
+        void
+        destroyColoredFont(const utils::Uuid& font);
+
+      private:
+
+        using Releaser = std::function<void(const utils::Uuid&)>;
+        using HandlesMap = std::map<const void*, EngineHandleShPtr>;
+
+        /**
+         * @brief - Creates a handle releasing resources with the input methods.
+         * @param texture - the method to use to destroy a texture.
+         * @param font - the method to use to destroy a font.
+         */
+        EngineHandle(Releaser texture,
+                     Releaser font);
+
+        /**
+         * @brief - Retrieves the handle registered for the engine at the input address
+         *          or registers a new one using the provided methods.
+         * @param engine - the address of the engine.
+         * @param texture - the method to use to destroy a texture.
+         * @param font - the method to use to destroy a font.
+         * @return - the handle of the engine.
+         */
+        static
+        EngineHandleShPtr
+        registerEngine(const void* engine,
+                       Releaser texture,
+                       Releaser font);
+
+        /**
+         * @brief - Unregisters the handle of the engine at the input address, purges
+         *          the caches from the resources created through it and invalidates
+         *          it. Nothing happens if no handle is registered for this engine.
+         * @param engine - the address of the engine.
+         */
+        static
+        void
+        unregisterEngine(const void* engine);
+
+        /**
+         * @brief - Retrieves the handles currently registered along with the locker
+         *          protecting them.
+         * @return - the registered handles.
+         */
+        static
+        HandlesMap&
+        getHandles();
+
+        static
+        std::mutex&
+        getHandlesLocker();
+
+      private:
+
+        /**
+         * @brief - Protects the methods below from being reset while a resource is
+         *          being released.
+         */
+        std::mutex m_locker;
+
+        /**
+         * @brief - The methods used to release the resources of the engine: they are
+         *          reset when the engine is detached.
+         */
+        Releaser m_texture;
+        Releaser m_font;
+    };
+
+  }
+}
+
+# include "EngineHandle.hxx"
+
+#endif    /* ENGINE_HANDLE_HH */
@@ -0,0 +1,44 @@
+#ifndef    ENGINE_HANDLE_HXX
+# define   ENGINE_HANDLE_HXX
+
+# include "EngineHandle.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    template <typename Engine>
+    inline
+    EngineHandleShPtr
+    EngineHandle::attach(Engine& engine) {
+      // The methods only capture the engine as a reference: this is safe as
+      // they are reset when the engine gets detached.
+      return registerEngine(
+        &engine,
+        [&engine](const utils::Uuid& uuid) {
+          engine.destroyTexture(uuid);
+        },
+        [&engine](const utils::Uuid& uuid) {
+          engine.destroyColoredFont(uuid);
+        }
+      );
+    }
+
+    template <typename Engine>
+    inline
+    void
+    EngineHandle::detach(Engine& engine) {
+      unregisterEngine(&engine);
+    }
+
+    inline
+    bool
+    EngineHandle::valid() {
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      return m_texture != nullptr;
+    }
+
+  }
+}
+
+#endif    /* ENGINE_HANDLE_HXX */
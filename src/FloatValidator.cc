@@ -1,7 +1,7 @@
 
 # include "FloatValidator.hh"
-# include <cmath>
 # include <string>
+# include "NumericText.hh"
 # include "Validator_utils.hxx"
 
 namespace sdl {
@@ -15,8 +15,9 @@ namespace sdl {
       // https://code.woboq.org/qt5/qtbase/src/gui/util/qvalidator.cpp.html.
       // Try to convert the input string to a float value: if this cannot be done
       // we have a trivial case of an invalid input.
-      bool ok = false;
-      float val = utils::convert(input, 0.0f, ok);
+      // The conversion is performed in place without allocating memory.
+      float val = 0.0f;
+      bool ok = number::parseFloat(input.data(), input.size(), val);
 
       // Trivial case of the empty string which allows to safely access at least the
       // first characters in later tests.
@@ -42,7 +43,7 @@ namespace sdl {
         int leading = 0;
         bool hasLeading = false;
         extractComponents(input, &leading, &hasLeading);
-        int digits = (std::abs(leading) == 0 ? 1 : static_cast<int>(std::log10(std::abs(leading)) + 1));
+        int digits = number::countDigits(leading);
 
         if (hasLeading && digits > 1) {
           return State::Invalid;
@@ -74,8 +75,8 @@ namespace sdl {
 
       // Compute the number of digits used by the number to analyze. Unlike for the
       // integer case we can't really rely on the size of the input string to count
-      // the number of digits so we should use the logarithm approach.
-      int digits = (std::abs(val) < std::numeric_limits<float>::min() ? 1 : static_cast<int>(std::log10(std::abs(val)) + 1));
+      // the number of digits so we count the digits of the integral part.
+      int digits = number::countIntegralDigits(val);
 
       switch (m_notation) {
         case number::Notation::Standard:
@@ -106,8 +107,8 @@ namespace sdl {
       float lower, upper;
       accountForDecimals(lower, upper);
 
-      int lowerDigits = (lower == 0 ? 1 : static_cast<int>(std::log10(std::abs(lower)) + 1));
-      int upperDigits = (upper == 0 ? 1 : static_cast<int>(std::log10(std::abs(upper)) + 1));
+      int lowerDigits = number::countIntegralDigits(lower);
+      int upperDigits = number::countIntegralDigits(upper);
 
       // The input value is obviously not valid (otherwise we would have already validated it
       // in the main `validate` function) so we will either return `Invalid` or `Intermediate`.
@@ -204,9 +205,9 @@ namespace sdl {
 
       // We want to detect valuies which are clearly too big or too large and which cannot
       // be made valid by adding digits and decimal separator or exponent if possible.
-      int leadingDigits = (leading == 0 ? 1 : static_cast<int>(std::log10(std::abs(leading)) + 1));
-      int decDigits = (decimals == 0 ? 1 : static_cast<int>(std::log10(std::abs(decimals)) + 1));
-      int expDigits = (exponent == 0 ? 1 : static_cast<int>(std::log10(std::abs(exponent)) + 1));
+      int leadingDigits = number::countDigits(leading);
+      int decDigits = number::countDigits(decimals);
+      int expDigits = number::countDigits(exponent);
 
       log("Number \"" + digits + " parsed to l: " + std::to_string(leading) + ", d: " + std::to_string(decimals) + ", e: " + std::to_string(exponent));
       log("Digits: (" + std::to_string(leadingDigits) + ", " + std::to_string(decDigits) + ", " + std::to_string(expDigits) + ")");
@@ -0,0 +1,244 @@
+# include "FontRegistry.hh"
+# include "TextCache.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    FontRegistry::FontRegistry():
+      utils::CoreObject(std::string("font_registry")),
+
+      m_locker(),
+
+      m_fonts(),
+
+      m_maxUnused(getDefaultMaxUnusedFonts()),
+
+      m_unused(),
+
+      m_metrics(Metrics{0u, 0u, 0u, 0u, 0u})
+    {
+      setService(std::string("fonts"));
+    }
+
+    FontRegistry&
+    FontRegistry::getInstance() {
+      static FontRegistry registry;
+
+      return registry;
+    }
+
+    void
+    FontRegistry::release(const utils::Uuid& font) {
+      // Nothing to do for invalid fonts.
+      if (!font.valid()) {
+        return;
+      }
+
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      FontsMap::iterator it;
+      unsigned id = 0u;
+
+      if (!locate(font, it, id)) {
+        log(
+          std::string("Could not release font, font is not registered"),
+          utils::Level::Warning
+        );
+
+        return;
+      }
+
+      Variant& v = it->second[id];
+
+      if (v.refs == 0u) {
+        log(
+          std::string("Releasing font \"") + it->first.first + "\" (size: " +
+          std::to_string(it->first.second) + ") which is not used",
+          utils::Level::Warning
+        );
+
+        return;
+      }
+
+      --v.refs;
+
+      // The font is kept loaded for future uses unless too many unused
+      // fonts are already loaded.
+      if (v.refs == 0u) {
+        --m_metrics.referenced;
+        m_unused.touch(v.font);
+
+        evict(m_maxUnused);
+      }
+    }
+
+    void
+    FontRegistry::purge(EngineHandle& engine) {
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      FontsMap::iterator it = m_fonts.begin();
+
+      while (it != m_fonts.end()) {
+        std::vector<Variant>& variants = it->second;
+        unsigned id = 0u;
+
+        while (id < variants.size()) {
+          Variant& v = variants[id];
+
+          if (v.engine.get() != &engine) {
+            ++id;
+            continue;
+          }
+
+          if (v.refs > 0u) {
+            log(
+              std::string("Font \"") + it->first.first + "\" (size: " + std::to_string(it->first.second) +
+              ") is still used while its engine is detached",
+              utils::Level::Warning
+            );
+
+            v.engine.reset();
+            ++id;
+
+            continue;
+          }
+
+          m_unused.remove(v.font);
+          TextCache::getInstance().purgeFont(v.font);
+          engine.destroyColoredFont(v.font);
+
+          variants.erase(variants.begin() + id);
+
+          --m_metrics.open;
+          ++m_metrics.evictions;
+        }
+
+        if (variants.empty()) {
+          it = m_fonts.erase(it);
+        }
+        else {
+          ++it;
+        }
+      }
+    }
+
+    utils::Uuid
+    FontRegistry::reuse(const std::string& name,
+                        unsigned size,
+                        const core::engine::Palette& palette)
+    {
+      FontsMap::iterator it = m_fonts.find(std::make_pair(name, size));
+
+      if (it == m_fonts.end()) {
+        return utils::Uuid();
+      }
+
+      for (unsigned id = 0u ; id < it->second.size() ; ++id) {
+        Variant& v = it->second[id];
+
+        if (!compatible(v.palette, palette)) {
+          continue;
+        }
+
+        if (v.refs == 0u) {
+          ++m_metrics.referenced;
+          m_unused.remove(v.font);
+        }
+
+        ++v.refs;
+
+        ++m_metrics.hits;
+
+        return v.font;
+      }
+
+      return utils::Uuid();
+    }
+
+    void
+    FontRegistry::registerFont(const std::string& name,
+                               unsigned size,
+                               const core::engine::Palette& palette,
+                               const utils::Uuid& font,
+                               EngineHandleShPtr engine)
+    {
+      m_fonts[std::make_pair(name, size)].push_back(
+        Variant{palette, font, 1u, engine}
+      );
+
+      ++m_metrics.open;
+      ++m_metrics.referenced;
+      ++m_metrics.loads;
+
+      log(
+        std::string("Loaded font \"") + name + "\" (size: " + std::to_string(size) + "), " +
+        std::to_string(m_metrics.open) + " font(s) open",
+        utils::Level::Verbose
+      );
+    }
+
+    bool
+    FontRegistry::locate(const utils::Uuid& font,
+                         FontsMap::iterator& it,
+                         unsigned& id)
+    {
+      // Fonts are few so we can afford a linear search.
+      for (it = m_fonts.begin() ; it != m_fonts.end() ; ++it) {
+        for (id = 0u ; id < it->second.size() ; ++id) {
+          if (it->second[id].font == font) {
+            return true;
+          }
+        }
+      }
+
+      return false;
+    }
+
+    unsigned
+    FontRegistry::evict(unsigned keep) {
+      unsigned evicted = 0u;
+
+      while (m_unused.size() > keep) {
+        // The least recently released font is the one to evict.
+        utils::Uuid font = m_unused.oldest();
+        m_unused.pop();
+
+        FontsMap::iterator it;
+        unsigned id = 0u;
+
+        if (!locate(font, it, id)) {
+          // Should not happen as unused fonts are registered.
+          log(
+            std::string("Could not find unused font to evict (open: ") + std::to_string(m_metrics.open) +
+            ", referenced: " + std::to_string(m_metrics.referenced) + ")",
+            utils::Level::Error
+          );
+
+          continue;
+        }
+
+        // Release the font and remove it from the registry.
+        Variant v = it->second[id];
+
+        it->second.erase(it->second.begin() + id);
+        if (it->second.empty()) {
+          m_fonts.erase(it);
+        }
+
+        // The texts measured or rendered with this font are not useful anymore.
+        TextCache::getInstance().purgeFont(v.font);
+
+        if (v.engine != nullptr) {
+          v.engine->destroyColoredFont(v.font);
+        }
+
+        --m_metrics.open;
+        ++m_metrics.evictions;
+        ++evicted;
+      }
+
+      return evicted;
+    }
+
+  }
+}
@@ -0,0 +1,243 @@
+#ifndef    FONT_REGISTRY_HH
+# define   FONT_REGISTRY_HH
+
+# include <map>
+# include <mutex>
+# include <string>
+# include <vector>
+# include <core_utils/Uuid.hh>
+# include <core_utils/CoreObject.hh>
+# include <sdl_engine/Palette.hh>
+# include "LruIndex.hh"
+# include "EngineHandle.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    class FontRegistry: public utils::CoreObject {
+      public:
+
+        /**
+         * @brief - Describes the counters maintained by the registry. They can be used
+         *          to monitor the number of fonts opened by the library and the amount
+         *          of sharing between widgets.
+         */
+        struct Metrics {
+          unsigned open;       //<!- The number of fonts currently loaded.
+          unsigned referenced; //<!- The number of loaded fonts with at least one user.
+          unsigned loads;      //<!- The total number of fonts loaded.
+          unsigned hits;       //<!- The number of requests served with a loaded font.
+          unsigned evictions;  //<!- The number of unused fonts released.
+        };
+
+      public:
+
+        /**
+         * @brief - Retrieves the process-wide registry shared by all the widgets of
+         *          the library.
+         * @return - the font registry.
+         */
+        static
+        FontRegistry&
+        getInstance();
+
+        /**
+         * @brief - Note that the fonts still loaded when the registry is destroyed are
+         *          not released: this happens upon terminating the process at which
+         *          point the engine may not be available anymore. Use the `detach`
+         *          method of the `EngineHandle` to release them beforehand.
+         */
+        ~FontRegistry();
+
+        /**
+         * @brief - Retrieves a font with the specified name and size, loading it through
+         *          the engine if no compatible font is available yet. A font is shared
+         *          between all the requests with the same name and size and the same
+         *          text colors in their palettes (as the engine bakes these colors in
+         *          the font). Each successful call should be matched by a call to the
+         *          `release` method.
+         *          The font is released through the handle of the engine when it gets
+         *          evicted so the engine should be detached before being destroyed.
+         * @param engine - the engine to use to load the font if needed.
+         * @param name - the name of the font.
+         * @param size - the size of the font.
+         * @param palette - the palette to use to render text with this font.
+         * @return - the identifier of the font or an invalid identifier if the font
+         *           could not be loaded.
+         */
+        template <typename Engine>
+        utils::Uuid
+        acquire(Engine& engine,
+                const std::string& name,
+                unsigned size,
+                const core::engine::Palette& palette);
+
+        /**
+         * @brief - Indicates that a user of the input font does not need it anymore.
+         *          The font is kept loaded for future requests until the number of
+         *          unused fonts exceeds the allowed maximum, in which case the least
+         *          recently used ones are evicted.
+         * @param font - the font to release.
+         */
+        void
+        release(const utils::Uuid& font);
+
+        /**
+         * @brief - Defines the maximum number of fonts which can stay loaded while not
+         *          being used by any widget. Reducing this value may trigger evictions.
+         * @param count - the maximum number of unused fonts to keep.
+         */
+        void
+        setMaxUnusedFonts(unsigned count);
+
+        /**
+         * @brief - Releases all the fonts which are not used anymore.
+         * @return - the number of fonts released.
+         */
+        unsigned
+        evictUnused();
+
+        /**
+         * @brief - Releases the unused fonts loaded through the input engine and forgets
+         *          about the engine for the fonts still in use: they will be discarded
+         *          without being released once they are not used anymore. This is used
+         *          when the engine is detached.
+         * @param engine - the handle of the engine being detached.
+         */
+        void
+        purge(EngineHandle& engine);
+
+        /**
+         * @brief - Retrieves the current counters of this registry.
+         * @return - the metrics of the registry.
+         */
+        Metrics
+        getMetrics();
+
+      private:
+
+        /**
+         * @brief - Describes a font loaded for a given palette. The `engine` is used
+         *          to release the font when it is evicted.
+         */
+        struct Variant {
+          core::engine::Palette palette;
+          utils::Uuid font;
+          unsigned refs;
+          EngineHandleShPtr engine;
+        };
+
+        using FontKey = std::pair<std::string, unsigned>;
+        using FontsMap = std::map<FontKey, std::vector<Variant>>;
+
+        FontRegistry();
+
+        /**
+         * @brief - Defines the default maximum number of unused fonts kept loaded.
+         * @return - the default number of unused fonts to keep.
+         */
+        static
+        unsigned
+        getDefaultMaxUnusedFonts() noexcept;
+
+        /**
+         * @brief - Determines whether fonts created with both palettes can be shared,
+         *          which is the case when the colors used to render text are the same.
+         * @param lhs - the first palette.
+         * @param rhs - the second palette.
+         * @return - `true` if both palettes render text with the same colors.
+         */
+        static
+        bool
+        compatible(const core::engine::Palette& lhs,
+                   const core::engine::Palette& rhs) noexcept;
+
+        /**
+         * @brief - Attempts to find a loaded font matching the input properties and
+         *          registers a new user for it.
+         *          Assumes that the locker is already acquired.
+         * @param name - the name of the font.
+         * @param size - the size of the font.
+         * @param palette - the palette of the font.
+         * @return - the identifier of the font or an invalid identifier if none is
+         *           loaded yet.
+         */
+        utils::Uuid
+        reuse(const std::string& name,
+              unsigned size,
+              const core::engine::Palette& palette);
+
+        /**
+         * @brief - Registers a newly loaded font with a single user.
+         *          Assumes that the locker is already acquired.
+         * @param name - the name of the font.
+         * @param size - the size of the font.
+         * @param palette - the palette of the font.
+         * @param font - the identifier of the font.
+         * @param engine - the handle of the engine to use to release the font.
+         */
+        void
+        registerFont(const std::string& name,
+                     unsigned size,
+                     const core::engine::Palette& palette,
+                     const utils::Uuid& font,
+                     EngineHandleShPtr engine);
+
+        /**
+         * @brief - Finds the variant describing the input font.
+         *          Assumes that the locker is already acquired.
+         * @param font - the identifier of the font.
+         * @param it - output argument receiving the fonts with the name and size of
+         *             the font.
+         * @param id - output argument receiving the index of the variant among them.
+         * @return - `true` if the font is registered.
+         */
+        bool
+        locate(const utils::Uuid& font,
+               FontsMap::iterator& it,
+               unsigned& id);
+
+        /**
+         * @brief - Evicts the least recently used unused fonts until at most `keep` of
+         *          them remain loaded.
+         *          Assumes that the locker is already acquired.
+         * @param keep - the number of unused fonts which can stay loaded.
+         * @return - the number of fonts evicted.
+         */
+        unsigned
+        evict(unsigned keep);
+
+      private:
+
+        /**
+         * @brief - Protects concurrent accesses to the registry.
+         */
+        std::mutex m_locker;
+
+        /**
+         * @brief - The fonts loaded so far, organized by name and size. Each entry holds
+         *          the variants loaded for incompatible palettes: there are usually very
+         *          few of them.
+         */
+        FontsMap m_fonts;
+
+        /**
+         * @brief - The maximum number of fonts kept loaded while not being used.
+         */
+        unsigned m_maxUnused;
+
+        /**
+         * @brief - The fonts which are not used anymore, sorted by order of release so
+         *          that the least recently used one can be evicted first.
+         */
+        LruIndex<utils::Uuid> m_unused;
+
+        Metrics m_metrics;
+    };
+
+  }
+}
+
+# include "FontRegistry.hxx"
+
+#endif    /* FONT_REGISTRY_HH */
@@ -0,0 +1,92 @@
+#ifndef    FONT_REGISTRY_HXX
+# define   FONT_REGISTRY_HXX
+
+# include "FontRegistry.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    inline
+    FontRegistry::~FontRegistry() {}
+
+    template <typename Engine>
+    inline
+    utils::Uuid
+    FontRegistry::acquire(Engine& engine,
+                          const std::string& name,
+                          unsigned size,
+                          const core::engine::Palette& palette)
+    {
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      // Try to reuse an existing font.
+      utils::Uuid font = reuse(name, size, palette);
+      if (font.valid()) {
+        return font;
+      }
+
+      // Load the font and register it. Only valid fonts are kept.
+      font = engine.createColoredFont(name, palette, size);
+
+      if (font.valid()) {
+        registerFont(
+          name,
+          size,
+          palette,
+          font,
+          EngineHandle::attach(engine)
+        );
+      }
+
+      return font;
+    }
+
+    inline
+    void
+    FontRegistry::setMaxUnusedFonts(unsigned count) {
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      m_maxUnused = count;
+      evict(m_maxUnused);
+    }
+
+    inline
+    unsigned
+    FontRegistry::evictUnused() {
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      return evict(0u);
+    }
+
+    inline
+    FontRegistry::Metrics
+    FontRegistry::getMetrics() {
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      return m_metrics;
+    }
+
+    inline
+    unsigned
+    FontRegistry::getDefaultMaxUnusedFonts() noexcept {
+      return 8u;
+    }
+
+    inline
+    bool
+    FontRegistry::compatible(const core::engine::Palette& lhs,
+                             const core::engine::Palette& rhs) noexcept
+    {
+      // Text is only ever rendered with these roles in the library.
+      return
+        lhs.getColorForRole(core::engine::Palette::ColorRole::WindowText) ==
+          rhs.getColorForRole(core::engine::Palette::ColorRole::WindowText) &&
+        lhs.getColorForRole(core::engine::Palette::ColorRole::HighlightedText) ==
+          rhs.getColorForRole(core::engine::Palette::ColorRole::HighlightedText)
+      ;
+    }
+
+  }
+}
+
+#endif    /* FONT_REGISTRY_HXX */
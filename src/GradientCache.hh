@@ -0,0 +1,204 @@
+#ifndef    GRADIENT_CACHE_HH
+# define   GRADIENT_CACHE_HH
+
+# include <map>
+# include <mutex>
+# include <vector>
+# include <maths_utils/Size.hh>
+# include <core_utils/Uuid.hh>
+# include <core_utils/CoreObject.hh>
+# include <sdl_engine/Brush.hh>
+# include <sdl_engine/Palette.hh>
+# include <sdl_engine/Gradient.hh>
+# include "LruIndex.hh"
+# include "EngineHandle.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    class GradientCache: public utils::CoreObject {
+      public:
+
+        /**
+         * @brief - Describes the counters maintained by the cache.
+         */
+        struct Metrics {
+          unsigned long hits;      //<!- Number of textures served from the cache.
+          unsigned long misses;    //<!- Number of textures rasterised by the cache.
+          unsigned long evictions; //<!- Number of entries evicted from the cache.
+          std::size_t entries;     //<!- Number of entries currently cached.
+          std::size_t bytes;       //<!- Estimated size of the cached data.
+          std::size_t budget;      //<!- Maximum size of the cached data.
+        };
+
+      public:
+
+        /**
+         * @brief - Retrieves the process-wide cache shared by all the widgets of the
+         *          library.
+         * @return - the gradient cache.
+         */
+        static
+        GradientCache&
+        getInstance();
+
+        /**
+         * @brief - Similarly to the `TextCache` the textures still cached when the
+         *          cache is destroyed are not released as the engine may already be
+         *          gone by then. Use the `detach` method of the `EngineHandle` to
+         *          release them beforehand.
+         */
+        ~GradientCache();
+
+        /**
+         * @brief - Retrieves a texture representing the input gradient rasterised at
+         *          the specified size. Gradients are identified by their address so
+         *          that widgets willing to share a texture should use the same gradient
+         *          object. The texture is shared and should thus not be modified: it
+         *          should be given back with `release` rather than destroyed.
+         *          The texture is destroyed through the handle of the engine when it
+         *          gets evicted so the engine should be detached before being
+         *          destroyed.
+         * @param engine - the engine to use to create the texture if needed.
+         * @param gradient - the gradient to rasterise.
+         * @param size - the size of the texture.
+         * @param palette - the palette to use to fill the texture. Textures created
+         *                  from a brush are filled with the `Background` role so
+         *                  that only this color is part of the key of the entry.
+         * @return - the identifier of the texture.
+         */
+        template <typename Engine>
+        utils::Uuid
+        acquire(Engine& engine,
+                core::engine::GradientShPtr gradient,
+                const utils::Sizef& size,
+                const core::engine::Palette& palette);
+
+        /**
+         * @brief - Gives back a texture obtained through `acquire`. The texture stays
+         *          in the cache until it gets evicted.
+         * @param texture - the texture to release.
+         */
+        void
+        release(const utils::Uuid& texture);
+
+        /**
+         * @brief - Defines the maximum amount of memory in bytes that the cache can
+         *          use. Reducing the budget may trigger evictions. Note that textures
+         *          in use cannot be evicted so the budget can be exceeded temporarily.
+         * @param bytes - the budget of the cache.
+         */
+        void
+        setBudget(std::size_t bytes);
+
+        /**
+         * @brief - Destroys the unused textures created through the input engine and
+         *          forgets about the engine for the textures still in use: they will
+         *          be discarded without being destroyed once released. This is used
+         *          when the engine is detached.
+         * @param engine - the handle of the engine being detached.
+         */
+        void
+        purge(EngineHandle& engine);
+
+        /**
+         * @brief - Retrieves the counters of this cache.
+         * @return - the metrics of the cache.
+         */
+        Metrics
+        getMetrics();
+
+      private:
+
+        /**
+         * @brief - The key of an entry: the gradient (which also defines the mode of
+         *          the gradient) along with the size of the texture and the color used
+         *          to fill it. The color is represented by its index in the list of the
+         *          fill colors met by the cache.
+         */
+        struct Key {
+          const core::engine::Gradient* gradient;
+          float w;
+          float h;
+          unsigned fill;
+
+          bool
+          operator<(const Key& rhs) const noexcept;
+        };
+
+        /**
+         * @brief - The entry keeps the gradient alive so that its address can not be
+         *          reused by another gradient while the entry exists. Only the entries
+         *          which are not in use are registered in the usage index.
+         */
+        struct Entry {
+          core::engine::GradientShPtr gradient;
+          utils::Uuid texture;
+          unsigned refs;
+          std::size_t bytes;
+          EngineHandleShPtr engine;
+        };
+
+        using EntriesMap = std::map<Key, Entry>;
+        using TexturesMap = std::map<utils::Uuid, EntriesMap::iterator>;
+
+        GradientCache();
+
+        /**
+         * @brief - Defines the default budget of the cache in bytes.
+         * @return - the default budget of the cache.
+         */
+        static
+        std::size_t
+        getDefaultBudget() noexcept;
+
+        /**
+         * @brief - Retrieves the index of the input color in the list of the fill
+         *          colors, registering it if needed. Colors are only compared for
+         *          equality so this list is searched linearly: it is expected to be
+         *          small as there are usually few palettes in an application.
+         *          Assumes that the locker is already acquired.
+         * @param color - the color to index.
+         * @return - the index of the color.
+         */
+        unsigned
+        getFillIndex(const core::engine::Color& color);
+
+        /**
+         * @brief - Evicts the least recently used entries which are not in use until
+         *          the size of the cache fits in the budget.
+         *          Assumes that the locker is already acquired.
+         */
+        void
+        evict();
+
+      private:
+
+        /**
+         * @brief - Protects concurrent accesses to the cache.
+         */
+        std::mutex m_locker;
+
+        /**
+         * @brief - The cached entries along with the order of use of the ones which
+         *          can be evicted and an index of the textures to speed up the release
+         *          operation.
+         */
+        EntriesMap m_entries;
+        LruIndex<Key> m_lru;
+        TexturesMap m_textures;
+
+        /**
+         * @brief - The fill colors met by the cache, used to build the keys.
+         */
+        std::vector<core::engine::Color> m_fills;
+
+        Metrics m_metrics;
+    };
+
+  }
+}
+
+# include "GradientCache.hxx"
+
+#endif    /* GRADIENT_CACHE_HH */
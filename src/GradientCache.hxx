@@ -0,0 +1,135 @@
+#ifndef    GRADIENT_CACHE_HXX
+# define   GRADIENT_CACHE_HXX
+
+# include <tuple>
+# include "GradientCache.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    inline
+    GradientCache::~GradientCache() {}
+
+    template <typename Engine>
+    inline
+    utils::Uuid
+    GradientCache::acquire(Engine& engine,
+                           core::engine::GradientShPtr gradient,
+                           const utils::Sizef& size,
+                           const core::engine::Palette& palette)
+    {
+      if (gradient == nullptr || !size.valid()) {
+        return utils::Uuid();
+      }
+
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      // The texture is filled with the palette once rasterised: widgets using
+      // the same gradient with different palettes can't share it.
+      Key key{
+        gradient.get(),
+        size.w(),
+        size.h(),
+        getFillIndex(palette.getColorForRole(core::engine::Palette::ColorRole::Background))
+      };
+
+      EntriesMap::iterator it = m_entries.find(key);
+      if (it != m_entries.end()) {
+        ++m_metrics.hits;
+
+        // The entry cannot be evicted while it is in use.
+        if (it->second.refs == 0u) {
+          m_lru.remove(key);
+        }
+        ++it->second.refs;
+
+        return it->second.texture;
+      }
+
+      ++m_metrics.misses;
+
+      // Use a brush to paint the texture representing the gradient.
+      core::engine::BrushShPtr brush = std::make_shared<core::engine::Brush>("grad_brush", size);
+      brush->drawGradient(*gradient);
+
+      utils::Uuid tex = engine.createTextureFromBrush(brush);
+      if (!tex.valid()) {
+        return tex;
+      }
+
+      engine.fillTexture(tex, palette);
+
+      // Register the entry: it is in use so it cannot be evicted yet. The
+      // footprint is dominated by the pixels of the texture, assuming four
+      // bytes per pixel.
+
+      it = m_entries.insert(
+        std::make_pair(
+          key,
+          Entry{
+            gradient,
+            tex,
+            1u,
+            sizeof(Entry) + static_cast<std::size_t>(size.w() * size.h() * 4.0f),
+            EngineHandle::attach(engine)
+          }
+        )
+      ).first;
+
+      m_textures[tex] = it;
+
+      m_metrics.bytes += it->second.bytes;
+      ++m_metrics.entries;
+
+      evict();
+
+      return tex;
+    }
+
+    inline
+    void
+    GradientCache::setBudget(std::size_t bytes) {
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      m_metrics.budget = bytes;
+      evict();
+    }
+
+    inline
+    GradientCache::Metrics
+    GradientCache::getMetrics() {
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      return m_metrics;
+    }
+
+    inline
+    bool
+    GradientCache::Key::operator<(const Key& rhs) const noexcept {
+      return std::tie(gradient, w, h, fill) < std::tie(rhs.gradient, rhs.w, rhs.h, rhs.fill);
+    }
+
+    inline
+    unsigned
+    GradientCache::getFillIndex(const core::engine::Color& color) {
+      for (unsigned id = 0u ; id < m_fills.size() ; ++id) {
+        if (m_fills[id] == color) {
+          return id;
+        }
+      }
+
+      m_fills.push_back(color);
+
+      return static_cast<unsigned>(m_fills.size() - 1u);
+    }
+
+    inline
+    std::size_t
+    GradientCache::getDefaultBudget() noexcept {
+      return 4u * 1024u * 1024u;
+    }
+
+  }
+}
+
+#endif    /* GRADIENT_CACHE_HXX */
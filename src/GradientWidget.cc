@@ -7,15 +7,19 @@ namespace sdl {
     GradientWidget::GradientWidget(const std::string& name,
                                    core::engine::GradientShPtr gradient,
                                    core::SdlWidget* parent,
-                                   const utils::Sizef& hint):
-      core::SdlWidget(name, hint, parent, core::engine::Color::NamedColor::Olive),
+                                   const utils::Sizef& hint,
+                                   const core::engine::Color& color):
+      core::SdlWidget(name, hint, parent, color),
 
       m_propsLocker(),
 
       m_gradient(gradient),
 
       m_gradientChanged(true),
-      m_gradientTex()
+      m_gradientTex(),
+
+      m_fraction(1.0f),
+      m_repaintPending(false)
     {
       if (m_gradient == nullptr) {
         log(std::string("Gradient widget has null gradient"), utils::Level::Warning);
@@ -24,6 +28,21 @@ namespace sdl {
       build();
     }
 
+    bool
+    GradientWidget::evictGradientTex() {
+      // Do not wait for the widget if it is busy: the texture can be evicted
+      // later on.
+      std::unique_lock<std::mutex> guard(m_propsLocker, std::try_to_lock);
+      if (!guard.owns_lock()) {
+        return false;
+      }
+
+      clearGradientTex();
+      m_gradientChanged = true;
+
+      return true;
+    }
+
     void
     GradientWidget::drawContentPrivate(const utils::Uuid& uuid,
                                        const utils::Boxf& area)
@@ -31,7 +50,14 @@ namespace sdl {
       // Protect from concurrent accesses.
       Guard guard(m_propsLocker);
 
-      // Recreate the gradient's texture if needed.
+      // The texture is used: prevent it from being evicted.
+      TextureBudget::getInstance().touch(this);
+
+      // Any change of the fraction is handled by this repaint.
+      m_repaintPending = false;
+
+      // Recreate the gradient's texture if needed. Note that resizing the
+      // widget does not require to do so as the texture is stretched.
       if (gradientTexChanged()) {
         loadGradientTex();
         m_gradientChanged = false;
@@ -48,14 +74,39 @@ namespace sdl {
       utils::Sizef gradArea = getEngine().queryTexture(m_gradientTex);
       utils::Sizef sizeEnv = getEngine().queryTexture(uuid);
 
-      utils::Boxf dst = thisArea.intersect(area);
-      utils::Boxf src = thisArea.intersect(area);
+      // Only the visible fraction of the gradient is drawn: the source area is
+      // clipped accordingly so the rest of the widget is left untouched.
+      const float visible = thisArea.w() * m_fraction;
+      utils::Boxf clip(
+        utils::Vector2f(thisArea.getLeftBound() + visible / 2.0f, thisArea.y()),
+        visible,
+        thisArea.h()
+      );
+
+      utils::Boxf dst = thisArea.intersect(area).intersect(clip);
 
-      if (!dst.valid()) {
+      if (m_fraction <= 0.0f || !dst.valid()) {
         // Nothing to draw.
         return;
       }
 
+      // The texture is stretched to cover the widget: scale the area to draw
+      // to find the corresponding part of the texture. In the case of a strip
+      // we always use its whole height as it spans the whole widget anyway.
+      const float wScale = gradArea.w() / thisArea.w();
+      const float hScale = gradArea.h() / thisArea.h();
+
+      utils::Boxf src(
+        dst.x() * wScale,
+        dst.y() * hScale,
+        dst.w() * wScale,
+        dst.h() * hScale
+      );
+
+      if (gradArea.h() <= 1.0f) {
+        src = utils::Boxf(src.x(), 0.0f, src.w(), gradArea.h());
+      }
+
       utils::Boxf dstEngine = convertToEngineFormat(dst, sizeEnv);
       utils::Boxf srcEngine = convertToEngineFormat(src, gradArea);
 
@@ -2,10 +2,13 @@
 # define   GRADIENT_WIDGET_HH
 
 # include <mutex>
+# include <algorithm>
 # include <memory>
 # include <string>
 # include <sdl_core/SdlWidget.hh>
 # include <sdl_engine/Gradient.hh>
+# include "GradientCache.hh"
+# include "TextureBudget.hh"
 
 namespace sdl {
   namespace graphic {
@@ -20,11 +23,14 @@ namespace sdl {
          * @param gradient - the gradient to represent for this widget.
          * @param parent - the parent widget for this element.
          * @param hint - the size hint for this widget.
+         * @param color - the background color of the widget, visible in the part
+         *                of the widget where the gradient is not displayed.
          */
         GradientWidget(const std::string& name,
                        core::engine::GradientShPtr gradient,
                        core::SdlWidget* parent = nullptr,
-                       const utils::Sizef& hint = utils::Sizef());
+                       const utils::Sizef& hint = utils::Sizef(),
+                       const core::engine::Color& color = core::engine::Color::NamedColor::Olive);
 
         virtual ~GradientWidget();
 
@@ -36,8 +42,31 @@ namespace sdl {
         void
         setGradient(core::engine::GradientShPtr gradient);
 
+        /**
+         * @brief - Defines the fraction of the gradient which should be displayed,
+         *          starting from the left of the widget. The rest of the widget only
+         *          displays the background color. The gradient keeps its scale so
+         *          that only a part of its colors is visible.
+         *          This method can be called at high rates from any thread: the
+         *          repaint requests are coalesced so that at most one is pending.
+         * @param fraction - the fraction of the gradient to display, clamped in the
+         *                   range `[0; 1]`.
+         */
+        void
+        setFraction(float fraction);
+
       protected:
 
+        /**
+         * @brief - Reimplementation of the base class method to forget about pending
+         *          repaint requests: the widget is repainted after being updated so the
+         *          requests issued by `setFraction` while it was hidden or resized are
+         *          not needed anymore.
+         * @param window - the available size to perform the update.
+         */
+        void
+        updatePrivate(const utils::Boxf& window) override;
+
         /**
          * @brief - Reimplementation of the base `SdlWidget` method to represent the
          *          internal gradient object. Basically represents it using a texture
@@ -52,6 +81,27 @@ namespace sdl {
 
       private:
 
+        /**
+         * @brief - Defines the number of samples used to rasterise a gradient along
+         *          each axis where its color varies.
+         * @return - the resolution of the gradient textures.
+         */
+        static
+        float
+        getResolution() noexcept;
+
+        /**
+         * @brief - Computes the size of the texture used to represent the gradient:
+         *          it does not depend on the size of the widget as the texture is
+         *          stretched upon drawing. A linear gradient only needs a strip of
+         *          a single row while other gradients are represented by a square.
+         * @param gradient - the gradient for which the texture size is computed.
+         * @return - the size of the texture representing the gradient.
+         */
+        static
+        utils::Sizef
+        getTextureSize(const core::engine::Gradient& gradient) noexcept;
+
         /**
          * @brief - Used to create the internal layout for this progress bar.
          */
@@ -77,6 +127,17 @@ namespace sdl {
         void
         clearGradientTex();
 
+        /**
+         * @brief - Used by the texture budget to release the texture of the gradient when
+         *          this widget was not drawn for a while. It is retrieved again from the
+         *          gradient cache upon the next call to `drawContentPrivate`.
+         *          Acquires the `m_propsLocker` if possible.
+         * @return - `true` if the texture could be released and `false` if the widget is
+         *           currently busy.
+         */
+        bool
+        evictGradientTex();
+
         /**
          * @brief - Return `true` if the gradient has changed since the `m_tex` has been
          *          created. Typically allows to detect whether the texture should be
@@ -122,8 +183,25 @@ namespace sdl {
          * @brief - An identifier returned by the engine when creating the texture
          *          representing the gradient. This texture is assumed valid as long
          *          as the `m_gradientChanged` boolean is set to `false`.
+         *          The texture is obtained from the gradient cache and is thus shared
+         *          with other widgets displaying the same gradient.
          */
         utils::Uuid m_gradientTex;
+
+        /**
+         * @brief - The fraction of the gradient displayed, starting from the left of
+         *          the widget.
+         */
+        float m_fraction;
+
+        /**
+         * @brief - Whether a repaint has been requested since the last draw operation
+         *          in response to a change of the fraction. Allows to avoid flooding
+         *          the event queue when the fraction is updated at high rates. This
+         *          is reset when the widget is drawn or updated, and never set while
+         *          the widget is hidden as the request would not be honored.
+         */
+        bool m_repaintPending;
     };
 
     using GradientWidgetShPtr = std::shared_ptr<GradientWidget>;
@@ -10,6 +10,7 @@ namespace sdl {
     GradientWidget::~GradientWidget() {
       Guard guard(m_propsLocker);
 
+      TextureBudget::getInstance().discharge(this);
       clearGradientTex();
     }
 
@@ -19,16 +20,52 @@ namespace sdl {
       // Protect from concurrent accesses.
       Guard guard(m_propsLocker);
 
-      // Assign the new gradient and request a repaint operation.
+      // Assign the new gradient and request a repaint operation: the texture
+      // needs to be recreated.
       m_gradient = gradient;
-      requestRepaint();
+      setGradientTexChanged();
+    }
+
+    inline
+    void
+    GradientWidget::setFraction(float fraction) {
+      // Protect from concurrent accesses.
+      Guard guard(m_propsLocker);
+
+      float clamped = std::max(0.0f, std::min(1.0f, fraction));
+
+      if (clamped == m_fraction) {
+        return;
+      }
+
+      m_fraction = clamped;
+
+      // Only request a repaint if none is pending already: the pending one
+      // will use the latest fraction anyway. Requests are not honored while
+      // the widget is hidden so we should not wait for them in this case.
+      if (!m_repaintPending) {
+        m_repaintPending = isVisible();
+        requestRepaint();
+      }
+    }
+
+    inline
+    void
+    GradientWidget::updatePrivate(const utils::Boxf& window) {
+      // Use the base handler.
+      core::SdlWidget::updatePrivate(window);
+
+      // Protect from concurrent accesses.
+      Guard guard(m_propsLocker);
+
+      m_repaintPending = false;
     }
 
     inline
     void
     GradientWidget::clearGradientTex() {
       if (m_gradientTex.valid()) {
-        getEngine().destroyTexture(m_gradientTex);
+        GradientCache::getInstance().release(m_gradientTex);
         m_gradientTex.invalidate();
       }
     }
@@ -41,14 +78,13 @@ namespace sdl {
 
       // Create the gradient texture if needed.
       if (m_gradient != nullptr) {
-        // Use a brush to paint the texture representing the gradient.
-        // To do so we will sample the gradient at various percentages
-        // and report the corresponding color in the brush's canvas.
-        utils::Sizef area = LayoutItem::getRenderingArea().toSize();
-        core::engine::BrushShPtr brush = std::make_shared<core::engine::Brush>("grad_brush", area);
-        brush->drawGradient(*m_gradient);
+        // The texture is retrieved from the gradient cache so that widgets
+        // displaying the same gradient share it: it is only rasterised if no
+        // such texture exists yet. Its size does not depend on the size of
+        // the widget as it is stretched when drawn.
+        utils::Sizef area = getTextureSize(*m_gradient);
 
-        m_gradientTex = getEngine().createTextureFromBrush(brush);
+        m_gradientTex = GradientCache::getInstance().acquire(getEngine(), m_gradient, area, getPalette());
 
         if (!m_gradientTex.valid()) {
           error(
@@ -56,9 +92,35 @@ namespace sdl {
             std::string("Unable to create texture for \"") + m_gradient->getName() + "\""
           );
         }
+      }
 
-        getEngine().fillTexture(m_gradientTex, getPalette());
+      // Register the texture in the budget: it is charged to this widget even
+      // though it may be shared with others through the cache.
+      TextureBudget::getInstance().charge(
+        this,
+        TextureBudget::getTextureBytes(getEngine(), m_gradientTex),
+        [this]() {
+          return evictGradientTex();
+        }
+      );
+    }
+
+    inline
+    float
+    GradientWidget::getResolution() noexcept {
+      return 256.0f;
+    }
+
+    inline
+    utils::Sizef
+    GradientWidget::getTextureSize(const core::engine::Gradient& gradient) noexcept {
+      // A linear gradient only varies along the horizontal axis so a single
+      // row of pixels describes it entirely.
+      if (gradient.getMode() == core::engine::gradient::Mode::Linear) {
+        return utils::Sizef(getResolution(), 1.0f);
       }
+
+      return utils::Sizef(getResolution(), getResolution());
     }
 
     inline
@@ -0,0 +1,371 @@
+# include "ImageCache.hh"
+# include <cstdint>
+# include <fstream>
+# include <sys/stat.h>
+
+namespace sdl {
+  namespace graphic {
+
+    ImageCache::ImageCache():
+      utils::CoreObject(std::string("image_cache")),
+
+      m_locker(),
+
+      m_entries(),
+      m_lru(),
+      m_images(),
+      m_textures(),
+
+      m_pending(),
+
+      m_hashContent(false),
+
+      m_metrics(Metrics{0u, 0u, 0u, 0u, 0u, getDefaultBudget()})
+    {
+      setService(std::string("images"));
+    }
+
+    ImageCache&
+    ImageCache::getInstance() {
+      static ImageCache cache;
+
+      return cache;
+    }
+
+    core::engine::ImageShPtr
+    ImageCache::acquire(const std::string& path) {
+      // Querying the attributes of the file is much cheaper than decoding it:
+      // this allows to detect modifications of the file.
+      bool hash = false;
+      {
+        std::lock_guard<std::mutex> guard(m_locker);
+        hash = m_hashContent;
+      }
+
+      Key key = makeKey(path, hash);
+
+      std::promise<core::engine::ImageShPtr> decoding;
+      std::shared_future<core::engine::ImageShPtr> pending;
+
+      {
+        std::lock_guard<std::mutex> guard(m_locker);
+
+        core::engine::ImageShPtr img = reuse(key);
+        if (img != nullptr) {
+          return img;
+        }
+
+        // Either wait for the decoding performed by another thread or register
+        // this one so that other threads can wait for it.
+        PendingMap::const_iterator it = m_pending.find(key);
+
+        if (it != m_pending.cend()) {
+          pending = it->second;
+        }
+        else {
+          m_pending[key] = decoding.get_future().share();
+        }
+      }
+
+      if (pending.valid()) {
+        // This rethrows the error raised while decoding the image if any.
+        core::engine::ImageShPtr img = pending.get();
+
+        std::lock_guard<std::mutex> guard(m_locker);
+
+        if (img == nullptr || !img->hasData()) {
+          return img;
+        }
+
+        // The entry may have been evicted since the decoding completed.
+        core::engine::ImageShPtr cached = reuse(key);
+        return cached != nullptr ? cached : insert(key, img);
+      }
+
+      // Decode the image without holding the lock: this is the expensive part
+      // and other images can be served in the meantime.
+      core::engine::ImageShPtr img;
+
+      try {
+        img = std::make_shared<core::engine::Image>(path);
+      }
+      catch (...) {
+        std::lock_guard<std::mutex> guard(m_locker);
+
+        m_pending.erase(key);
+        decoding.set_exception(std::current_exception());
+
+        throw;
+      }
+
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      ++m_metrics.misses;
+      m_pending.erase(key);
+
+      // Images which could not be decoded are not cached: the next request
+      // will try again.
+      if (img->hasData()) {
+        insert(key, img);
+      }
+
+      decoding.set_value(img);
+
+      return img;
+    }
+
+    bool
+    ImageCache::contains(const std::string& path) {
+      bool hash = false;
+      {
+        std::lock_guard<std::mutex> guard(m_locker);
+        hash = m_hashContent;
+      }
+
+      Key key = makeKey(path, hash);
+
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      return m_entries.find(key) != m_entries.end();
+    }
+
+    void
+    ImageCache::release(const core::engine::ImageShPtr& image) {
+      // Nothing to do for invalid images: images without data are not cached.
+      if (image == nullptr || !image->hasData()) {
+        return;
+      }
+
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      ImagesMap::iterator it = m_images.find(image.get());
+
+      if (it == m_images.end()) {
+        log(
+          std::string("Could not release image, image is not registered"),
+          utils::Level::Warning
+        );
+
+        return;
+      }
+
+      Entry& entry = it->second->second;
+
+      if (entry.refs == 0u) {
+        log(
+          std::string("Releasing image \"") + it->second->first.path + "\" which is not used",
+          utils::Level::Warning
+        );
+
+        return;
+      }
+
+      --entry.refs;
+
+      // The image can now be evicted if needed.
+      if (entry.refs == 0u && entry.textureRefs == 0u) {
+        m_lru.touch(it->second->first);
+        evict();
+      }
+    }
+
+    void
+    ImageCache::releaseTexture(const utils::Uuid& texture) {
+      // Nothing to do for invalid textures.
+      if (!texture.valid()) {
+        return;
+      }
+
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      TexturesMap::iterator it = m_textures.find(texture);
+
+      if (it == m_textures.end()) {
+        log(
+          std::string("Could not release image texture, texture is not registered"),
+          utils::Level::Warning
+        );
+
+        return;
+      }
+
+      Entry& entry = it->second->second;
+
+      if (entry.textureRefs == 0u) {
+        log(
+          std::string("Releasing texture for image \"") + it->second->first.path + "\" which is not used",
+          utils::Level::Warning
+        );
+
+        return;
+      }
+
+      --entry.textureRefs;
+
+      // The texture can now be evicted if needed.
+      if (entry.refs == 0u && entry.textureRefs == 0u) {
+        m_lru.touch(it->second->first);
+        evict();
+      }
+    }
+
+    void
+    ImageCache::purge(EngineHandle& engine) {
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      EntriesMap::iterator it = m_entries.begin();
+
+      while (it != m_entries.end()) {
+        Entry& entry = it->second;
+
+        if (entry.engine.get() != &engine) {
+          ++it;
+          continue;
+        }
+
+        if (entry.refs > 0u || entry.textureRefs > 0u) {
+          log(
+            std::string("Image \"") + it->first.path + "\" is still used while its engine is detached",
+            utils::Level::Warning
+          );
+
+          entry.engine.reset();
+          ++it;
+
+          continue;
+        }
+
+        m_textures.erase(entry.texture);
+        engine.destroyTexture(entry.texture);
+
+        m_images.erase(entry.image.get());
+
+        m_metrics.bytes -= entry.bytes;
+        --m_metrics.entries;
+        ++m_metrics.evictions;
+
+        m_lru.remove(it->first);
+        it = m_entries.erase(it);
+      }
+    }
+
+    ImageCache::Key
+    ImageCache::makeKey(const std::string& path,
+                        bool hash)
+    {
+      Key key{path, 0, 0, 0, 0u};
+
+      struct stat attributes;
+      if (::stat(path.c_str(), &attributes) == 0) {
+        key.size = static_cast<long long>(attributes.st_size);
+        key.seconds = static_cast<long long>(attributes.st_mtim.tv_sec);
+        key.nanoseconds = static_cast<long long>(attributes.st_mtim.tv_nsec);
+      }
+
+      if (hash) {
+        key.hash = hashFile(path);
+      }
+
+      return key;
+    }
+
+    std::size_t
+    ImageCache::hashFile(const std::string& path) {
+      std::ifstream in(path, std::ios::binary);
+      if (!in) {
+        return 0u;
+      }
+
+      // Use the FNV-1a hash on the content of the file.
+      std::uint64_t hash = 14695981039346656037ull;
+      char buffer[4096];
+
+      while (in.read(buffer, sizeof(buffer)) || in.gcount() > 0) {
+        const std::streamsize count = in.gcount();
+
+        for (std::streamsize id = 0 ; id < count ; ++id) {
+          hash ^= static_cast<unsigned char>(buffer[id]);
+          hash *= 1099511628211ull;
+        }
+      }
+
+      return static_cast<std::size_t>(hash);
+    }
+
+    core::engine::ImageShPtr
+    ImageCache::reuse(const Key& key) {
+      EntriesMap::iterator it = m_entries.find(key);
+
+      if (it == m_entries.end()) {
+        return nullptr;
+      }
+
+      ++m_metrics.hits;
+      ++it->second.refs;
+
+      // The entry cannot be evicted while it is in use.
+      m_lru.remove(key);
+
+      return it->second.image;
+    }
+
+    core::engine::ImageShPtr
+    ImageCache::insert(const Key& key,
+                       core::engine::ImageShPtr image)
+    {
+      // The entry is in use so it is not registered in the usage index yet.
+      const std::size_t bytes = sizeof(Entry) + key.path.size() + getBytes(image->getSize());
+
+      EntriesMap::iterator it = m_entries.insert(
+        std::make_pair(
+          key,
+          Entry{image, 1u, utils::Uuid(), 0u, bytes, nullptr}
+        )
+      ).first;
+
+      m_images[image.get()] = it;
+
+      m_metrics.bytes += bytes;
+      ++m_metrics.entries;
+
+      evict();
+
+      return image;
+    }
+
+    void
+    ImageCache::evict() {
+      // Release the least recently used entries which are not in use until
+      // we fit in the budget.
+      while (m_metrics.bytes > m_metrics.budget && !m_lru.empty()) {
+        EntriesMap::iterator entry = m_entries.find(m_lru.oldest());
+
+        if (entry == m_entries.end()) {
+          error(
+            std::string("Could not evict image cache entry \"") + m_lru.oldest().path + "\"",
+            std::string("Inconsistent cache")
+          );
+        }
+
+        m_lru.pop();
+
+        if (entry->second.texture.valid()) {
+          m_textures.erase(entry->second.texture);
+
+          if (entry->second.engine != nullptr) {
+            entry->second.engine->destroyTexture(entry->second.texture);
+          }
+        }
+
+        m_images.erase(entry->second.image.get());
+
+        m_metrics.bytes -= entry->second.bytes;
+        --m_metrics.entries;
+        ++m_metrics.evictions;
+
+        m_entries.erase(entry);
+      }
+    }
+
+  }
+}
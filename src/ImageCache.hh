@@ -0,0 +1,295 @@
+#ifndef    IMAGE_CACHE_HH
+# define   IMAGE_CACHE_HH
+
+# include <map>
+# include <mutex>
+# include <future>
+# include <string>
+# include <maths_utils/Size.hh>
+# include <core_utils/Uuid.hh>
+# include <core_utils/CoreObject.hh>
+# include <sdl_engine/Image.hh>
+# include <sdl_engine/Palette.hh>
+# include "LruIndex.hh"
+# include "EngineHandle.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    class ImageCache: public utils::CoreObject {
+      public:
+
+        /**
+         * @brief - Describes the counters maintained by the cache.
+         */
+        struct Metrics {
+          unsigned long hits;      //<!- Number of images served from the cache.
+          unsigned long misses;    //<!- Number of images decoded by the cache.
+          unsigned long evictions; //<!- Number of entries evicted from the cache.
+          std::size_t entries;     //<!- Number of entries currently cached.
+          std::size_t bytes;       //<!- Estimated size of the cached data.
+          std::size_t budget;      //<!- Maximum size of the cached data.
+        };
+
+      public:
+
+        /**
+         * @brief - Retrieves the process-wide cache shared by all the widgets of the
+         *          library.
+         * @return - the image cache.
+         */
+        static
+        ImageCache&
+        getInstance();
+
+        /**
+         * @brief - Similarly to the `TextCache` the textures still cached when the
+         *          cache is destroyed are not released as the engine may already be
+         *          gone by then. Use the `detach` method of the `EngineHandle` to
+         *          release them beforehand.
+         */
+        ~ImageCache();
+
+        /**
+         * @brief - Retrieves the image at the specified path. The image is identified by
+         *          its path along with the size and modification time of the file, so that
+         *          several versions of the same file can be cached. The content of the file
+         *          is also used if `setContentHashing` is enabled. It is decoded only if it is not already cached
+         *          or being decoded by another thread, in which case the result of that
+         *          operation is shared. The image is shared with any other user of the
+         *          same file and should thus not be modified. It should be given back with
+         *          `release` once it is not needed anymore.
+         *          Images which could not be decoded (i.e. without data) are returned but
+         *          not cached so that a later request tries to decode them again.
+         * @param path - the path of the image.
+         * @return - the image.
+         */
+        core::engine::ImageShPtr
+        acquire(const std::string& path);
+
+        /**
+         * @brief - Determines whether the image at the specified path is cached, in
+         *          which case `acquire` will not need to decode it.
+         * @param path - the path of the image.
+         * @return - `true` if the image is cached.
+         */
+        bool
+        contains(const std::string& path);
+
+        /**
+         * @brief - Gives back an image obtained through `acquire`. The image stays in
+         *          the cache until it gets evicted.
+         * @param image - the image to release.
+         */
+        void
+        release(const core::engine::ImageShPtr& image);
+
+        /**
+         * @brief - Retrieves a texture created from the input image, which must have
+         *          been obtained through `acquire`. The texture is shared by all the
+         *          users of the image and should thus not be modified: it should be
+         *          given back with `releaseTexture` rather than destroyed.
+         *          The texture is destroyed through the handle of the engine when it
+         *          gets evicted so the engine should be detached before being
+         *          destroyed.
+         * @param engine - the engine to use to create the texture if needed.
+         * @param image - the image for which a texture should be retrieved.
+         * @return - the identifier of the texture or an invalid identifier if the
+         *           image does not have any data.
+         */
+        template <typename Engine>
+        utils::Uuid
+        acquireTexture(Engine& engine,
+                       const core::engine::ImageShPtr& image);
+
+        /**
+         * @brief - Gives back a texture obtained through `acquireTexture`.
+         * @param texture - the texture to release.
+         */
+        void
+        releaseTexture(const utils::Uuid& texture);
+
+        /**
+         * @brief - Defines whether the content of the files is hashed to identify the images
+         *          in addition to the size and modification time of the files. This allows to
+         *          detect modifications which preserve both but requires to read the whole file
+         *          on each call to `acquire`, even when the image is cached. This is disabled
+         *          by default.
+         * @param enabled - `true` if the content of the files should be hashed.
+         */
+        void
+        setContentHashing(bool enabled);
+
+        /**
+         * @brief - Defines the maximum amount of memory in bytes that the cache can
+         *          use. Reducing the budget may trigger evictions. Note that images
+         *          in use cannot be evicted so the budget can be exceeded temporarily.
+         * @param bytes - the budget of the cache.
+         */
+        void
+        setBudget(std::size_t bytes);
+
+        /**
+         * @brief - Evicts the unused entries holding a texture created through the input
+         *          engine and forgets about the engine for the entries still in use: their
+         *          texture will be discarded without being destroyed once released. This
+         *          is used when the engine is detached.
+         * @param engine - the handle of the engine being detached.
+         */
+        void
+        purge(EngineHandle& engine);
+
+        /**
+         * @brief - Retrieves the counters of this cache.
+         * @return - the metrics of the cache.
+         */
+        Metrics
+        getMetrics();
+
+      private:
+
+        /**
+         * @brief - The key of an entry: the size and modification time of the file allow
+         *          to distinguish between several versions of the file at a given path. The
+         *          hash of its content is `0` unless the content hashing is enabled.
+         */
+        struct Key {
+          std::string path;
+          long long size;
+          long long seconds;
+          long long nanoseconds;
+          std::size_t hash;
+
+          bool
+          operator<(const Key& rhs) const noexcept;
+        };
+
+        /**
+         * @brief - An entry can only be evicted when neither its image nor its texture
+         *          are used: only such entries are registered in the usage index. The
+         *          `engine` is used to destroy the texture of the entry if any.
+         */
+        struct Entry {
+          core::engine::ImageShPtr image;
+          unsigned refs;
+          utils::Uuid texture;
+          unsigned textureRefs;
+          std::size_t bytes;
+          EngineHandleShPtr engine;
+        };
+
+        using EntriesMap = std::map<Key, Entry>;
+        using PendingMap = std::map<Key, std::shared_future<core::engine::ImageShPtr>>;
+        using ImagesMap = std::map<const core::engine::Image*, EntriesMap::iterator>;
+        using TexturesMap = std::map<utils::Uuid, EntriesMap::iterator>;
+
+        ImageCache();
+
+        /**
+         * @brief - Defines the default budget of the cache in bytes.
+         * @return - the default budget of the cache.
+         */
+        static
+        std::size_t
+        getDefaultBudget() noexcept;
+
+        /**
+         * @brief - Builds the key identifying the current version of the file at the input
+         *          path. Only the attributes of the file are queried unless the content is
+         *          to be hashed as well. A file which cannot be found has a null size and
+         *          modification time.
+         * @param path - the path of the file.
+         * @param hash - `true` if the content of the file should be hashed.
+         * @return - the key of the file.
+         */
+        static
+        Key
+        makeKey(const std::string& path,
+                bool hash);
+
+        /**
+         * @brief - Computes a hash of the content of the file at the specified path. The
+         *          file is read by chunks so that no large buffer is needed.
+         * @param path - the path of the file.
+         * @return - the hash of the content of the file or `0` if it cannot be read.
+         */
+        static
+        std::size_t
+        hashFile(const std::string& path);
+
+        /**
+         * @brief - Registers a new user for the entry with the specified key if it exists.
+         *          Assumes that the locker is already acquired.
+         * @param key - the key of the entry.
+         * @return - the image of the entry or `null` if the entry does not exist.
+         */
+        core::engine::ImageShPtr
+        reuse(const Key& key);
+
+        /**
+         * @brief - Registers a new entry for the input image with a single user and evicts
+         *          the least recently used entries if needed.
+         *          Assumes that the locker is already acquired.
+         * @param key - the key of the entry.
+         * @param image - the decoded image.
+         * @return - the image.
+         */
+        core::engine::ImageShPtr
+        insert(const Key& key,
+               core::engine::ImageShPtr image);
+
+        /**
+         * @brief - Estimates the memory used by the pixels of an image of the specified
+         *          size, assuming four bytes per pixel.
+         * @param size - the size of the image.
+         * @return - the estimated memory used by the image.
+         */
+        static
+        std::size_t
+        getBytes(const utils::Sizef& size) noexcept;
+
+        /**
+         * @brief - Evicts the least recently used entries which are not in use until
+         *          the size of the cache fits in the budget.
+         *          Assumes that the locker is already acquired.
+         */
+        void
+        evict();
+
+      private:
+
+        /**
+         * @brief - Protects concurrent accesses to the cache.
+         */
+        std::mutex m_locker;
+
+        /**
+         * @brief - The cached entries along with the order of use of the ones which can
+         *          be evicted and indices of the images and textures to speed up the
+         *          release operations.
+         */
+        EntriesMap m_entries;
+        LruIndex<Key> m_lru;
+        ImagesMap m_images;
+        TexturesMap m_textures;
+
+        /**
+         * @brief - The images currently being decoded by `acquire`: other requests for
+         *          the same image wait for the result instead of decoding it as well.
+         */
+        PendingMap m_pending;
+
+        /**
+         * @brief - Whether the content of the files is hashed to build the keys.
+         */
+        bool m_hashContent;
+
+        Metrics m_metrics;
+    };
+
+  }
+}
+
+# include "ImageCache.hxx"
+
+#endif    /* IMAGE_CACHE_HH */
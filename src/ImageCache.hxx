@@ -0,0 +1,104 @@
+#ifndef    IMAGE_CACHE_HXX
+# define   IMAGE_CACHE_HXX
+
+# include <tuple>
+# include "ImageCache.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    inline
+    ImageCache::~ImageCache() {}
+
+    template <typename Engine>
+    inline
+    utils::Uuid
+    ImageCache::acquireTexture(Engine& engine,
+                               const core::engine::ImageShPtr& image)
+    {
+      if (image == nullptr || !image->hasData()) {
+        return utils::Uuid();
+      }
+
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      ImagesMap::iterator it = m_images.find(image.get());
+
+      if (it == m_images.end()) {
+        error(
+          std::string("Could not create texture for image"),
+          std::string("Image was not acquired from the cache")
+        );
+      }
+
+      Entry& entry = it->second->second;
+
+      // Create the texture if it does not exist yet.
+      if (!entry.texture.valid()) {
+        entry.texture = engine.createTextureFromFile(image, core::engine::Palette::ColorRole::Base);
+        entry.engine = EngineHandle::attach(engine);
+
+        const std::size_t bytes = getBytes(image->getSize());
+        entry.bytes += bytes;
+        m_metrics.bytes += bytes;
+
+        m_textures[entry.texture] = it->second;
+      }
+
+      // The entry cannot be evicted while its texture is in use.
+      if (entry.refs == 0u && entry.textureRefs == 0u) {
+        m_lru.remove(it->second->first);
+      }
+      ++entry.textureRefs;
+
+      return entry.texture;
+    }
+
+    inline
+    void
+    ImageCache::setContentHashing(bool enabled) {
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      m_hashContent = enabled;
+    }
+
+    inline
+    void
+    ImageCache::setBudget(std::size_t bytes) {
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      m_metrics.budget = bytes;
+      evict();
+    }
+
+    inline
+    ImageCache::Metrics
+    ImageCache::getMetrics() {
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      return m_metrics;
+    }
+
+    inline
+    bool
+    ImageCache::Key::operator<(const Key& rhs) const noexcept {
+      return std::tie(path, size, seconds, nanoseconds, hash) <
+             std::tie(rhs.path, rhs.size, rhs.seconds, rhs.nanoseconds, rhs.hash);
+    }
+
+    inline
+    std::size_t
+    ImageCache::getDefaultBudget() noexcept {
+      return 32u * 1024u * 1024u;
+    }
+
+    inline
+    std::size_t
+    ImageCache::getBytes(const utils::Sizef& size) noexcept {
+      return static_cast<std::size_t>(size.w() * size.h() * 4.0f);
+    }
+
+  }
+}
+
+#endif    /* IMAGE_CACHE_HXX */
@@ -0,0 +1,192 @@
+# include "ImageDecoder.hh"
+# include <fstream>
+
+namespace sdl {
+  namespace graphic {
+
+    ImageDecoder::ImageDecoder():
+      utils::CoreObject(std::string("image_decoder")),
+
+      m_locker(),
+      m_waiter(),
+
+      m_tasks(),
+
+      m_running(true),
+
+      m_workers()
+    {
+      setService(std::string("images"));
+
+      // The tasks give their image back to the image cache when destroyed: make
+      // sure that the cache is created first so that it outlives the decoder.
+      ImageCache::getInstance();
+
+      // Start the decoding threads.
+      const unsigned count = getWorkersCount();
+
+      for (unsigned id = 0u ; id < count ; ++id) {
+        m_workers.push_back(std::thread(&ImageDecoder::run, this));
+      }
+    }
+
+    ImageDecoder::~ImageDecoder() {
+      {
+        std::lock_guard<std::mutex> guard(m_locker);
+
+        m_running = false;
+        m_tasks.clear();
+      }
+
+      m_waiter.notify_all();
+
+      for (unsigned id = 0u ; id < m_workers.size() ; ++id) {
+        m_workers[id].join();
+      }
+    }
+
+    ImageDecoder&
+    ImageDecoder::getInstance() {
+      static ImageDecoder decoder;
+
+      return decoder;
+    }
+
+    ImageDecoder::TaskShPtr
+    ImageDecoder::decode(const std::string& path,
+                         Task::Callback callback)
+    {
+      TaskShPtr task = std::make_shared<Task>(path, callback);
+
+      {
+        std::lock_guard<std::mutex> guard(m_locker);
+        m_tasks.push_back(task);
+      }
+
+      m_waiter.notify_one();
+
+      return task;
+    }
+
+    utils::Sizef
+    ImageDecoder::probeSize(const std::string& path) {
+      std::ifstream in(path, std::ios::binary);
+      if (!in) {
+        return utils::Sizef();
+      }
+
+      // The dimensions are always located in the first bytes of the file
+      // except for JPEG images where they follow a variable number of
+      // segments.
+      unsigned char h[26] = {0u};
+      in.read(reinterpret_cast<char*>(h), sizeof(h));
+
+      const std::streamsize count = in.gcount();
+
+      auto be16 = [](const unsigned char* b) { return (b[0] << 8) | b[1]; };
+      auto le16 = [](const unsigned char* b) { return b[0] | (b[1] << 8); };
+      auto be32 = [](const unsigned char* b) {
+        return static_cast<long>((static_cast<unsigned long>(b[0]) << 24) | (b[1] << 16) | (b[2] << 8) | b[3]);
+      };
+      auto le32 = [](const unsigned char* b) {
+        return static_cast<long>(static_cast<int>(b[0] | (b[1] << 8) | (b[2] << 16) | (static_cast<unsigned>(b[3]) << 24)));
+      };
+
+      // PNG: the `IHDR` chunk immediately follows the signature.
+      if (count >= 24 && h[0] == 0x89u && h[1] == 'P' && h[2] == 'N' && h[3] == 'G') {
+        return utils::Sizef(be32(h + 16), be32(h + 20));
+      }
+
+      // GIF: the logical screen descriptor follows the signature.
+      if (count >= 10 && h[0] == 'G' && h[1] == 'I' && h[2] == 'F') {
+        return utils::Sizef(le16(h + 6), le16(h + 8));
+      }
+
+      // BMP: the layout of the dimensions depends on the version of the
+      // header. The height is negative for top-down bitmaps.
+      if (count >= 26 && h[0] == 'B' && h[1] == 'M') {
+        if (le32(h + 14) == 12) {
+          return utils::Sizef(le16(h + 18), le16(h + 20));
+        }
+
+        const long height = le32(h + 22);
+        return utils::Sizef(le32(h + 18), height < 0 ? -height : height);
+      }
+
+      // JPEG: traverse the segments until a start of frame is found.
+      if (count < 4 || h[0] != 0xFFu || h[1] != 0xD8u) {
+        return utils::Sizef();
+      }
+
+      in.clear();
+      in.seekg(2);
+
+      unsigned char marker[4];
+      while (in.read(reinterpret_cast<char*>(marker), sizeof(marker))) {
+        if (marker[0] != 0xFFu) {
+          break;
+        }
+
+        // Start of frame markers except the ones used for other purposes
+        // (huffman tables, arithmetic coding).
+        const unsigned char m = marker[1];
+        if (m >= 0xC0u && m <= 0xCFu && m != 0xC4u && m != 0xC8u && m != 0xCCu) {
+          unsigned char frame[5];
+          if (!in.read(reinterpret_cast<char*>(frame), sizeof(frame))) {
+            break;
+          }
+
+          return utils::Sizef(be16(frame + 3), be16(frame + 1));
+        }
+
+        // Skip the segment: its length includes the two bytes of the length.
+        in.seekg(be16(marker + 2) - 2, std::ios::cur);
+      }
+
+      return utils::Sizef();
+    }
+
+    void
+    ImageDecoder::run() {
+      while (true) {
+        TaskShPtr task;
+
+        {
+          std::unique_lock<std::mutex> guard(m_locker);
+
+          m_waiter.wait(guard, [this]() { return !m_running || !m_tasks.empty(); });
+
+          if (!m_running) {
+            return;
+          }
+
+          task = m_tasks.front();
+          m_tasks.pop_front();
+        }
+
+        // Tasks cancelled while waiting in the queue are not decoded at all.
+        if (task->isCancelled()) {
+          continue;
+        }
+
+        // Decode the image through the cache so that concurrent requests for
+        // the same picture are only decoded once. Any error is reported as an
+        // image with no data so that the task is still marked as done.
+        core::engine::ImageShPtr img;
+
+        try {
+          img = ImageCache::getInstance().acquire(task->getPath());
+        }
+        catch (const std::exception& e) {
+          log(
+            std::string("Could not decode image \"") + task->getPath() + "\" (err: " + e.what() + ")",
+            utils::Level::Error
+          );
+        }
+
+        task->complete(img);
+      }
+    }
+
+  }
+}
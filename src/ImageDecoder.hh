@@ -0,0 +1,194 @@
+#ifndef    IMAGE_DECODER_HH
+# define   IMAGE_DECODER_HH
+
+# include <deque>
+# include <mutex>
+# include <memory>
+# include <string>
+# include <thread>
+# include <vector>
+# include <exception>
+# include <functional>
+# include <condition_variable>
+# include <maths_utils/Size.hh>
+# include <core_utils/CoreObject.hh>
+# include <sdl_engine/Image.hh>
+# include "ImageCache.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    class ImageDecoder: public utils::CoreObject {
+      public:
+
+        /**
+         * @brief - Describes a decoding request submitted to the decoder. The request
+         *          can be cancelled at any time: once the `cancel` method returns the
+         *          callback attached to the request is guaranteed not to be running
+         *          and will never be called.
+         *          The image is obtained from the image cache so that requests for the
+         *          same picture share the decoding. The task holds a reference on the
+         *          image until it is taken with `takeImage`: it is given back to the
+         *          cache upon destroying the task otherwise.
+         */
+        class Task {
+          public:
+
+            using Callback = std::function<void(const core::engine::ImageShPtr&)>;
+
+            /**
+             * @brief - Creates a new decoding task for the specified image.
+             * @param path - the path of the image to decode.
+             * @param callback - a method called from the decoding thread when the image
+             *                   is ready. It is not called if the task is cancelled.
+             */
+            Task(const std::string& path,
+                 Callback callback);
+
+            ~Task();
+
+            const std::string&
+            getPath() const noexcept;
+
+            /**
+             * @brief - Cancels this task. If the image is not decoded yet it will not
+             *          be, and the callback will not be called.
+             */
+            void
+            cancel();
+
+            bool
+            isCancelled();
+
+            /**
+             * @brief - Returns `true` if the image has been decoded (even if the decoding
+             *          produced an image with no data).
+             * @return - `true` if the image is available.
+             */
+            bool
+            isDone();
+
+            /**
+             * @brief - Retrieves the decoded image or `null` if it is not yet available.
+             *          The caller becomes responsible for giving the image back to the
+             *          image cache: subsequent calls return `null`.
+             * @return - the decoded image.
+             */
+            core::engine::ImageShPtr
+            takeImage();
+
+            /**
+             * @brief - Used by the decoder to register the decoded image and notify the
+             *          callback if the task has not been cancelled.
+             * @param image - the decoded image.
+             */
+            void
+            complete(core::engine::ImageShPtr image);
+
+          private:
+
+            /**
+             * @brief - Protects the result of the decoding.
+             */
+            std::mutex m_locker;
+
+            /**
+             * @brief - Protects the cancellation status and the execution of the callback:
+             *          it is distinct from `m_locker` so that the callback can take as
+             *          long as it wants without blocking accesses to the image.
+             */
+            std::mutex m_callbackLocker;
+
+            std::string m_path;
+            Callback m_callback;
+
+            bool m_cancelled;
+            bool m_done;
+            core::engine::ImageShPtr m_image;
+        };
+
+        using TaskShPtr = std::shared_ptr<Task>;
+
+      public:
+
+        /**
+         * @brief - Retrieves the process-wide decoder. Its threads are started on the
+         *          first call to this method.
+         * @return - the image decoder.
+         */
+        static
+        ImageDecoder&
+        getInstance();
+
+        /**
+         * @brief - Stops the decoding threads: any pending task is discarded.
+         */
+        ~ImageDecoder();
+
+        /**
+         * @brief - Schedules the decoding of the image at the specified path on one of
+         *          the decoding threads.
+         * @param path - the path of the image to decode.
+         * @param callback - a method to call from the decoding thread when the image
+         *                   is ready.
+         * @return - the task describing the request.
+         */
+        TaskShPtr
+        decode(const std::string& path,
+               Task::Callback callback = Task::Callback());
+
+        /**
+         * @brief - Reads the dimensions of the image at the specified path from the
+         *          header of the file, without decoding the image. This is cheap
+         *          enough to be done before scheduling the decoding so that widgets
+         *          can be laid out with their final size right away. BMP, PNG, GIF
+         *          and JPEG files are supported.
+         * @param path - the path of the image.
+         * @return - the size of the image or an invalid size if it cannot be read
+         *           from the header.
+         */
+        static
+        utils::Sizef
+        probeSize(const std::string& path);
+
+      private:
+
+        ImageDecoder();
+
+        /**
+         * @brief - Defines the number of threads used to decode images: we keep at least
+         *          a core for the rendering.
+         * @return - the number of decoding threads.
+         */
+        static
+        unsigned
+        getWorkersCount() noexcept;
+
+        /**
+         * @brief - Main loop of a decoding thread: waits for tasks and decodes them until
+         *          the decoder is destroyed.
+         */
+        void
+        run();
+
+      private:
+
+        /**
+         * @brief - Protects the queue of tasks and the running status.
+         */
+        std::mutex m_locker;
+        std::condition_variable m_waiter;
+
+        std::deque<TaskShPtr> m_tasks;
+
+        bool m_running;
+
+        std::vector<std::thread> m_workers;
+    };
+
+  }
+}
+
+# include "ImageDecoder.hxx"
+
+#endif    /* IMAGE_DECODER_HH */
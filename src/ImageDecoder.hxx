@@ -0,0 +1,98 @@
+#ifndef    IMAGE_DECODER_HXX
+# define   IMAGE_DECODER_HXX
+
+# include <algorithm>
+# include "ImageDecoder.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    inline
+    ImageDecoder::Task::Task(const std::string& path,
+                             Callback callback):
+      m_locker(),
+      m_callbackLocker(),
+
+      m_path(path),
+      m_callback(callback),
+
+      m_cancelled(false),
+      m_done(false),
+      m_image(nullptr)
+    {}
+
+    inline
+    ImageDecoder::Task::~Task() {
+      // The image was not retrieved: give it back to the cache.
+      ImageCache::getInstance().release(m_image);
+    }
+
+    inline
+    const std::string&
+    ImageDecoder::Task::getPath() const noexcept {
+      return m_path;
+    }
+
+    inline
+    void
+    ImageDecoder::Task::cancel() {
+      // Wait for the callback to terminate if it is running.
+      std::lock_guard<std::mutex> guard(m_callbackLocker);
+      m_cancelled = true;
+    }
+
+    inline
+    bool
+    ImageDecoder::Task::isCancelled() {
+      std::lock_guard<std::mutex> guard(m_callbackLocker);
+      return m_cancelled;
+    }
+
+    inline
+    bool
+    ImageDecoder::Task::isDone() {
+      std::lock_guard<std::mutex> guard(m_locker);
+      return m_done;
+    }
+
+    inline
+    core::engine::ImageShPtr
+    ImageDecoder::Task::takeImage() {
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      core::engine::ImageShPtr image = m_image;
+      m_image.reset();
+
+      return image;
+    }
+
+    inline
+    void
+    ImageDecoder::Task::complete(core::engine::ImageShPtr image) {
+      {
+        std::lock_guard<std::mutex> guard(m_locker);
+
+        m_image = image;
+        m_done = true;
+      }
+
+      // Notify the callback unless the task has been cancelled in the meantime.
+      std::lock_guard<std::mutex> guard(m_callbackLocker);
+
+      if (!m_cancelled && m_callback) {
+        m_callback(image);
+      }
+    }
+
+    inline
+    unsigned
+    ImageDecoder::getWorkersCount() noexcept {
+      const unsigned cores = std::thread::hardware_concurrency();
+
+      return std::max(1u, std::min(cores > 1u ? cores - 1u : 1u, 4u));
+    }
+
+  }
+}
+
+#endif    /* IMAGE_DECODER_HXX */
@@ -1,7 +1,6 @@
 
 # include "IntValidator.hh"
-# include <cmath>
-# include <core_utils/Conversion.hh>
+# include "NumericText.hh"
 # include "Validator_utils.hxx"
 
 namespace sdl {
@@ -15,8 +14,9 @@ namespace sdl {
       // https://code.woboq.org/qt5/qtbase/src/gui/util/qvalidator.cpp.html.
       // Try to convert the input string to an integer value: if this cannot be done
       // we have a trivial case of an invalid input.
-      bool ok = false;
-      int val = utils::convert(input, 0, ok);
+      // The conversion is performed in place without allocating memory.
+      int val = 0;
+      bool ok = number::parseInt(input.data(), input.size(), val);
 
       // Trivial case of the empty string which allows to safely access at least the
       // first characters in later tests.
@@ -63,8 +63,8 @@ namespace sdl {
       if (input[0] == '-' || input[0] == '+') {
         --digits;
       }
-      int lowerDigits = (m_lower == 0 ? 1 : static_cast<int>(std::log10(std::abs(m_lower)) + 1));
-      int upperDigits = (m_upper == 0 ? 1 : static_cast<int>(std::log10(std::abs(m_upper)) + 1));
+      int lowerDigits = number::countDigits(m_lower);
+      int upperDigits = number::countDigits(m_upper);
 
       // The input value represents a value which is not in the specified range.
       // We can't have any `Valid` value produced here but we still need to see
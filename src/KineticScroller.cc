@@ -0,0 +1,120 @@
+# include "KineticScroller.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    void
+    KineticScroller::press() noexcept {
+      // Stop any motion in progress and start tracking the speed of the user.
+      stop();
+
+      m_dragging = true;
+      m_lastSample = Clock::now();
+    }
+
+    void
+    KineticScroller::accumulate(const utils::Vector2f& motion) noexcept {
+      TimeStamp now = Clock::now();
+
+      // Any motion produced by the user stops the momentum.
+      m_gliding = false;
+      m_pending = m_pending + motion;
+
+      // In case no press was registered, start tracking the speed now: we can't
+      // compute any speed from this first motion though.
+      if (!m_dragging) {
+        m_dragging = true;
+        m_sample = utils::Vector2f();
+        m_velocity = utils::Vector2f();
+        m_lastSample = now;
+
+        return;
+      }
+
+      // Gather the motion in the current sample until it spans enough time to
+      // provide a meaningful speed.
+      m_sample = m_sample + motion;
+
+      float dt = elapsed(m_lastSample, now);
+      if (dt < getMinSampleDuration()) {
+        return;
+      }
+
+      // Smooth the speed with the previous samples.
+      const float w = getSampleWeight();
+
+      m_velocity = utils::Vector2f(
+        w * m_sample.x() / dt + (1.0f - w) * m_velocity.x(),
+        w * m_sample.y() / dt + (1.0f - w) * m_velocity.y()
+      );
+
+      m_sample = utils::Vector2f();
+      m_lastSample = now;
+    }
+
+    void
+    KineticScroller::release() noexcept {
+      TimeStamp now = Clock::now();
+
+      m_dragging = false;
+      m_sample = utils::Vector2f();
+
+      // Only keep moving if the user was still moving when releasing the content
+      // and if the speed is large enough.
+      if (!m_momentum || elapsed(m_lastSample, now) > getReleaseDelay() || norm(m_velocity) < getStopSpeed()) {
+        m_velocity = utils::Vector2f();
+        return;
+      }
+
+      m_gliding = true;
+      m_lastStep = now;
+    }
+
+    utils::Vector2f
+    KineticScroller::consume() noexcept {
+      TimeStamp now = Clock::now();
+
+      utils::Vector2f motion = m_pending;
+      m_pending = utils::Vector2f();
+
+      if (m_gliding) {
+        // Apply the friction over the elapsed time and move with the remaining
+        // speed. The duration is clamped so that a stall in the rendering does
+        // not produce a large jump.
+        float dt = std::min(elapsed(m_lastStep, now), getMaxFrameDuration());
+        float decay = std::exp(-m_friction * dt);
+
+        m_velocity = utils::Vector2f(m_velocity.x() * decay, m_velocity.y() * decay);
+
+        if (norm(m_velocity) < getStopSpeed()) {
+          m_gliding = false;
+          m_velocity = utils::Vector2f();
+        }
+        else {
+          motion = motion + utils::Vector2f(m_velocity.x() * dt, m_velocity.y() * dt);
+        }
+      }
+
+      m_lastStep = now;
+
+      return motion;
+    }
+
+    bool
+    KineticScroller::acquireFrame() noexcept {
+      TimeStamp now = Clock::now();
+
+      // Consider the frame lost if it was not drawn after a while: this can
+      // happen if the widget is hidden in the meantime.
+      if (m_framePending && elapsed(m_frameStart, now) < getMaxFrameDuration()) {
+        return false;
+      }
+
+      m_framePending = true;
+      m_frameStart = now;
+
+      return true;
+    }
+
+  }
+}
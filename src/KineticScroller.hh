@@ -0,0 +1,235 @@
+#ifndef    KINETIC_SCROLLER_HH
+# define   KINETIC_SCROLLER_HH
+
+# include <cmath>
+# include <chrono>
+# include <algorithm>
+# include <maths_utils/Vector2.hh>
+
+namespace sdl {
+  namespace graphic {
+
+    class KineticScroller {
+      public:
+
+        /**
+         * @brief - Creates a kinetic scroller. Such an object paces the scroll motions
+         *          produced by the user so that they are applied at most once per frame:
+         *          the motions received between two frames are accumulated and applied
+         *          as a single one. It also provides some momentum once the user stops
+         *          dragging so that the content keeps moving and slows down with some
+         *          friction.
+         *          Note that this object is not thread-safe: it should be protected by
+         *          the locker of the widget using it.
+         * @param momentum - `true` if the motion should continue after the user stops
+         *                   dragging.
+         * @param friction - the deceleration applied to the motion after the user stops
+         *                   dragging, expressed as the rate at which the speed decays per
+         *                   second.
+         */
+        KineticScroller(bool momentum = true,
+                        float friction = getDefaultFriction());
+
+        ~KineticScroller() = default;
+
+        /**
+         * @brief - Defines whether the motion should continue after the user stops
+         *          dragging. Deactivating the momentum stops any motion in progress.
+         * @param momentum - `true` to keep the content moving after a drag.
+         */
+        void
+        setMomentum(bool momentum) noexcept;
+
+        /**
+         * @brief - Indicates that the user started a new drag operation. Any motion in
+         *          progress is stopped.
+         */
+        void
+        press() noexcept;
+
+        /**
+         * @brief - Registers a motion produced by the user. The motion is not applied
+         *          right away but accumulated until `consume` is called. The speed of
+         *          the motion is also tracked so that it can be continued once the user
+         *          releases the content.
+         * @param motion - the motion to register.
+         */
+        void
+        accumulate(const utils::Vector2f& motion) noexcept;
+
+        /**
+         * @brief - Indicates that the user stopped dragging. If the momentum is active and
+         *          the user was still moving when releasing the content, the motion goes
+         *          on with the last speed registered and progressively slows down.
+         */
+        void
+        release() noexcept;
+
+        /**
+         * @brief - Stops any motion in progress and discards the accumulated motion.
+         */
+        void
+        stop() noexcept;
+
+        /**
+         * @brief - Determines whether some motion should still be applied: either some
+         *          motion was accumulated since the last call to `consume` or the content
+         *          is still moving on its own.
+         * @return - `true` if calling `consume` would produce some motion.
+         */
+        bool
+        hasMotion() const noexcept;
+
+        /**
+         * @brief - Retrieves the motion to apply for this frame. This includes the motion
+         *          accumulated since the last call and the motion produced by the momentum
+         *          given the time elapsed since the last call.
+         * @return - the motion to apply.
+         */
+        utils::Vector2f
+        consume() noexcept;
+
+        /**
+         * @brief - Used to pace the motions: returns `true` if no motion was applied since
+         *          the last frame, in which case the caller can apply the motion right away.
+         *          The frame is then considered used until `releaseFrame` is called. As a
+         *          safety net a frame is also considered released after some time in case
+         *          it is never drawn.
+         * @return - `true` if some motion can be applied.
+         */
+        bool
+        acquireFrame() noexcept;
+
+        /**
+         * @brief - Indicates that a new frame is drawn or that the motion applied after a
+         *          successful `acquireFrame` did not produce anything to draw. In both cases
+         *          the next motion can be applied right away.
+         */
+        void
+        releaseFrame() noexcept;
+
+      private:
+
+        using Clock = std::chrono::steady_clock;
+        using TimeStamp = Clock::time_point;
+
+        /**
+         * @brief - Defines the default rate at which the speed decays per second.
+         * @return - the default friction.
+         */
+        static
+        float
+        getDefaultFriction() noexcept;
+
+        /**
+         * @brief - Defines the speed in pixels per second under which the momentum stops.
+         * @return - the minimum speed of the momentum.
+         */
+        static
+        float
+        getStopSpeed() noexcept;
+
+        /**
+         * @brief - Defines the minimum duration in seconds over which the motions are
+         *          gathered to compute a sample of the speed. This avoids computing huge
+         *          speeds from events received at almost the same time.
+         * @return - the minimum duration of a speed sample.
+         */
+        static
+        float
+        getMinSampleDuration() noexcept;
+
+        /**
+         * @brief - Defines the weight of the last sample when computing the speed: the
+         *          speed is smoothed over the last samples to avoid erratic momentum.
+         * @return - the weight of a new sample.
+         */
+        static
+        float
+        getSampleWeight() noexcept;
+
+        /**
+         * @brief - Defines the duration in seconds after which the user is considered to
+         *          have stopped moving before releasing the content: no momentum is then
+         *          applied.
+         * @return - the maximum delay between the last motion and the release.
+         */
+        static
+        float
+        getReleaseDelay() noexcept;
+
+        /**
+         * @brief - Defines the maximum duration in seconds of a frame: it is used both to
+         *          limit the motion produced by the momentum after a stall and to consider
+         *          that a frame which was never drawn is released.
+         * @return - the maximum duration of a frame.
+         */
+        static
+        float
+        getMaxFrameDuration() noexcept;
+
+        /**
+         * @brief - Computes the duration in seconds between both time stamps.
+         * @param from - the start of the duration.
+         * @param to - the end of the duration.
+         * @return - the elapsed time in seconds.
+         */
+        static
+        float
+        elapsed(const TimeStamp& from,
+                const TimeStamp& to) noexcept;
+
+        /**
+         * @brief - Computes the norm of the input vector.
+         * @param v - the vector.
+         * @return - the norm of the vector.
+         */
+        static
+        float
+        norm(const utils::Vector2f& v) noexcept;
+
+      private:
+
+        /**
+         * @brief - The properties of the momentum: whether it is active and the friction
+         *          slowing down the motion.
+         */
+        bool m_momentum;
+        float m_friction;
+
+        /**
+         * @brief - The motion accumulated since the last call to `consume`.
+         */
+        utils::Vector2f m_pending;
+
+        /**
+         * @brief - Describes the speed of the user while dragging: the motion gathered
+         *          for the current sample is kept in `m_sample` and the speed itself in
+         *          `m_velocity`, expressed in pixels per second.
+         */
+        bool m_dragging;
+        utils::Vector2f m_sample;
+        TimeStamp m_lastSample;
+        utils::Vector2f m_velocity;
+
+        /**
+         * @brief - Whether the content is moving on its own after a release along with
+         *          the time at which the last motion was produced.
+         */
+        bool m_gliding;
+        TimeStamp m_lastStep;
+
+        /**
+         * @brief - Whether some motion was applied since the last frame along with the
+         *          time at which it was applied.
+         */
+        bool m_framePending;
+        TimeStamp m_frameStart;
+    };
+
+  }
+}
+
+# include "KineticScroller.hxx"
+
+#endif    /* KINETIC_SCROLLER_HH */
@@ -0,0 +1,117 @@
+#ifndef    KINETIC_SCROLLER_HXX
+# define   KINETIC_SCROLLER_HXX
+
+# include "KineticScroller.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    inline
+    KineticScroller::KineticScroller(bool momentum,
+                                     float friction):
+      m_momentum(momentum),
+      m_friction(friction),
+
+      m_pending(),
+
+      m_dragging(false),
+      m_sample(),
+      m_lastSample(Clock::now()),
+      m_velocity(),
+
+      m_gliding(false),
+      m_lastStep(Clock::now()),
+
+      m_framePending(false),
+      m_frameStart(Clock::now())
+    {}
+
+    inline
+    void
+    KineticScroller::setMomentum(bool momentum) noexcept {
+      m_momentum = momentum;
+
+      if (!m_momentum) {
+        m_gliding = false;
+        m_velocity = utils::Vector2f();
+      }
+    }
+
+    inline
+    void
+    KineticScroller::stop() noexcept {
+      m_pending = utils::Vector2f();
+
+      m_dragging = false;
+      m_sample = utils::Vector2f();
+      m_velocity = utils::Vector2f();
+
+      m_gliding = false;
+    }
+
+    inline
+    bool
+    KineticScroller::hasMotion() const noexcept {
+      return m_gliding || m_pending.x() != 0.0f || m_pending.y() != 0.0f;
+    }
+
+    inline
+    void
+    KineticScroller::releaseFrame() noexcept {
+      m_framePending = false;
+    }
+
+    inline
+    float
+    KineticScroller::getDefaultFriction() noexcept {
+      return 4.0f;
+    }
+
+    inline
+    float
+    KineticScroller::getStopSpeed() noexcept {
+      return 20.0f;
+    }
+
+    inline
+    float
+    KineticScroller::getMinSampleDuration() noexcept {
+      return 0.005f;
+    }
+
+    inline
+    float
+    KineticScroller::getSampleWeight() noexcept {
+      return 0.8f;
+    }
+
+    inline
+    float
+    KineticScroller::getReleaseDelay() noexcept {
+      return 0.1f;
+    }
+
+    inline
+    float
+    KineticScroller::getMaxFrameDuration() noexcept {
+      return 0.1f;
+    }
+
+    inline
+    float
+    KineticScroller::elapsed(const TimeStamp& from,
+                             const TimeStamp& to) noexcept
+    {
+      return std::chrono::duration_cast<std::chrono::duration<float>>(to - from).count();
+    }
+
+    inline
+    float
+    KineticScroller::norm(const utils::Vector2f& v) noexcept {
+      return std::sqrt(v.x() * v.x() + v.y() * v.y());
+    }
+
+  }
+}
+
+#endif    /* KINETIC_SCROLLER_HXX */
@@ -33,12 +33,13 @@ namespace sdl {
     {}
 
     LabelWidget::~LabelWidget() {
-      // Clear text.
+      // Clear text and remove it from the budget.
+      TextureBudget::getInstance().discharge(this);
       clearText();
 
-      // Clear font.
+      // Give back the font to the registry.
       if (m_font.valid()) {
-        getEngine().destroyColoredFont(m_font);
+        FontRegistry::getInstance().release(m_font);
       }
     }
 
@@ -49,6 +50,9 @@ namespace sdl {
       // Acquire the lock on the attributes of this widget.
       Guard guard(m_propsLocker);
 
+      // The text is used: prevent it from being evicted.
+      TextureBudget::getInstance().touch(this);
+
       // Load the text: this should happen only if the text has changed since
       // last draw operation. This can either mean that the text itself has
       // been modified or that one of the rendering properties to use to draw
@@ -155,6 +159,21 @@ namespace sdl {
       getEngine().drawTexture(m_label, &srcRectEngine, &uuid, &dstRectEngine);
     }
 
+    bool
+    LabelWidget::evictText() {
+      // Do not wait for the widget if it is busy: the text can be evicted
+      // later on.
+      std::unique_lock<std::mutex> guard(m_propsLocker, std::try_to_lock);
+      if (!guard.owns_lock()) {
+        return false;
+      }
+
+      clearText();
+      m_textChanged = true;
+
+      return true;
+    }
+
     void
     LabelWidget::stateUpdatedFromFocus(const core::FocusState& state,
                                        bool gainedFocus)
@@ -5,6 +5,9 @@
 # include <string>
 # include <core_utils/Uuid.hh>
 # include <sdl_core/SdlWidget.hh>
+# include "FontRegistry.hh"
+# include "TextCache.hh"
+# include "TextureBudget.hh"
 
 namespace sdl {
   namespace graphic {
@@ -87,6 +90,18 @@ namespace sdl {
         void
         clearText();
 
+        /**
+         * @brief - Used by the texture budget to release the text of this label when it
+         *          was not drawn for a while. The text is rebuilt upon the next call to
+         *          `drawContentPrivate`: no repaint is requested as the content of the
+         *          widget is still valid.
+         *          Acquires the `m_propsLocker` if possible.
+         * @return - `true` if the text could be released and `false` if the widget is
+         *           currently busy.
+         */
+        bool
+        evictText();
+
         /**
          * @brief - Used to determine whether any of the rendering properties of the text has
          *          been modified since the last `drawContentPrivate` operation.
@@ -133,8 +148,9 @@ namespace sdl {
         /**
          * @brief - Information about the font to use to render the text. We use the `m_fontName`
          *          and `m_fontSize` to store information while the font is not loaded yet. The
-         *          `m_font` itself holds an identifier returned by the engine which allows to
-         *          access to the font's data through the engine.
+         *          `m_font` itself holds an identifier borrowed from the `FontRegistry` which allows
+         *          to access to the font's data through the engine. It is shared with any other
+         *          widget using the same font.
          *          The information contained in these arguments may mismatch if the `m_textChanged`
          *          boolean is set to `true`. Upon the next repaint operation it should be corrected
          *          and if `m_textChanged` is `false` all these attributes should represent the
@@ -37,8 +37,9 @@ namespace sdl {
       // Load the text.
       if (!m_text.empty()) {
         if (!m_font.valid()) {
-          // Load the font.
-          m_font = getEngine().createColoredFont(m_fontName, getPalette(), m_fontSize);
+          // Borrow the font from the registry: labels sharing the same font
+          // and text colors also share the same font handle.
+          m_font = FontRegistry::getInstance().acquire(getEngine(), m_fontName, m_fontSize, getPalette());
 
           if (!m_font.valid()) {
             error(
@@ -48,15 +49,26 @@ namespace sdl {
           }
         }
 
-        m_label = getEngine().createTextureFromText(m_text, m_font, m_textRole);
+        // The texture is shared with any other widget displaying the same text.
+        m_label = TextCache::getInstance().acquireText(getEngine(), m_text, m_font, m_textRole);
       }
+
+      // Register the text in the budget so that it can be released when the
+      // label is not displayed anymore.
+      TextureBudget::getInstance().charge(
+        this,
+        TextureBudget::getTextureBytes(getEngine(), m_label),
+        [this]() {
+          return evictText();
+        }
+      );
     }
 
     inline
     void
     LabelWidget::clearText() {
       if (m_label.valid()) {
-        getEngine().destroyTexture(m_label);
+        TextCache::getInstance().release(m_label);
         m_label.invalidate();
       }
     }
@@ -0,0 +1,104 @@
+#ifndef    LRU_INDEX_HH
+# define   LRU_INDEX_HH
+
+# include <map>
+# include <list>
+# include <functional>
+
+namespace sdl {
+  namespace graphic {
+
+    template <typename Key, typename Compare = std::less<Key>>
+    class LruIndex {
+      public:
+
+        /**
+         * @brief - Creates an empty index. The index keeps track of the order of use
+         *          of the keys it contains so that the least recently used one can be
+         *          retrieved in constant time. It is meant to be used by caches which
+         *          only register the entries that can be evicted (i.e. which are not
+         *          in use): an entry is removed from the index when it gets acquired
+         *          and added back when it gets released so that evicting never needs
+         *          to skip entries.
+         */
+        LruIndex();
+
+        ~LruIndex() = default;
+
+        /**
+         * @brief - Determines whether the index does not contain any key.
+         * @return - `true` if the index is empty.
+         */
+        bool
+        empty() const noexcept;
+
+        /**
+         * @brief - Retrieves the number of keys registered in the index.
+         * @return - the number of keys in the index.
+         */
+        std::size_t
+        size() const noexcept;
+
+        /**
+         * @brief - Determines whether the input key is registered in the index.
+         * @param key - the key to search.
+         * @return - `true` if the key is registered.
+         */
+        bool
+        contains(const Key& key) const;
+
+        /**
+         * @brief - Marks the input key as the most recently used one. The key is added
+         *          to the index if it is not registered yet.
+         * @param key - the key to mark as used.
+         */
+        void
+        touch(const Key& key);
+
+        /**
+         * @brief - Removes the input key from the index. Nothing happens if the key is
+         *          not registered.
+         * @param key - the key to remove.
+         */
+        void
+        remove(const Key& key);
+
+        /**
+         * @brief - Retrieves the least recently used key. The index should not be empty.
+         * @return - the least recently used key.
+         */
+        const Key&
+        oldest() const;
+
+        /**
+         * @brief - Removes the least recently used key from the index. Nothing happens
+         *          if the index is empty.
+         */
+        void
+        pop();
+
+        /**
+         * @brief - Removes all the keys from the index.
+         */
+        void
+        clear() noexcept;
+
+      private:
+
+        using Order = std::list<Key>;
+        using Positions = std::map<Key, typename Order::iterator, Compare>;
+
+        /**
+         * @brief - The keys sorted by order of use (most recently used first) along
+         *          with their position in this list.
+         */
+        Order m_order;
+        Positions m_positions;
+    };
+
+  }
+}
+
+# include "LruIndex.hxx"
+
+#endif    /* LRU_INDEX_HH */
@@ -0,0 +1,97 @@
+#ifndef    LRU_INDEX_HXX
+# define   LRU_INDEX_HXX
+
+# include "LruIndex.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    template <typename Key, typename Compare>
+    inline
+    LruIndex<Key, Compare>::LruIndex():
+      m_order(),
+      m_positions()
+    {}
+
+    template <typename Key, typename Compare>
+    inline
+    bool
+    LruIndex<Key, Compare>::empty() const noexcept {
+      return m_order.empty();
+    }
+
+    template <typename Key, typename Compare>
+    inline
+    std::size_t
+    LruIndex<Key, Compare>::size() const noexcept {
+      return m_positions.size();
+    }
+
+    template <typename Key, typename Compare>
+    inline
+    bool
+    LruIndex<Key, Compare>::contains(const Key& key) const {
+      return m_positions.find(key) != m_positions.cend();
+    }
+
+    template <typename Key, typename Compare>
+    inline
+    void
+    LruIndex<Key, Compare>::touch(const Key& key) {
+      typename Positions::iterator it = m_positions.find(key);
+
+      // Move the key to the front of the list if it is already registered.
+      if (it != m_positions.end()) {
+        m_order.splice(m_order.begin(), m_order, it->second);
+        return;
+      }
+
+      m_order.push_front(key);
+      m_positions.insert(std::make_pair(key, m_order.begin()));
+    }
+
+    template <typename Key, typename Compare>
+    inline
+    void
+    LruIndex<Key, Compare>::remove(const Key& key) {
+      typename Positions::iterator it = m_positions.find(key);
+
+      if (it == m_positions.end()) {
+        return;
+      }
+
+      m_order.erase(it->second);
+      m_positions.erase(it);
+    }
+
+    template <typename Key, typename Compare>
+    inline
+    const Key&
+    LruIndex<Key, Compare>::oldest() const {
+      return m_order.back();
+    }
+
+    template <typename Key, typename Compare>
+    inline
+    void
+    LruIndex<Key, Compare>::pop() {
+      if (m_order.empty()) {
+        return;
+      }
+
+      m_positions.erase(m_order.back());
+      m_order.pop_back();
+    }
+
+    template <typename Key, typename Compare>
+    inline
+    void
+    LruIndex<Key, Compare>::clear() noexcept {
+      m_positions.clear();
+      m_order.clear();
+    }
+
+  }
+}
+
+#endif    /* LRU_INDEX_HXX */
@@ -0,0 +1,631 @@
+
+# include "NumericText.hh"
+# include <cstdlib>
+# include <cstring>
+# include <algorithm>
+
+namespace sdl {
+  namespace graphic {
+    namespace number {
+
+      namespace {
+
+        /**
+         * @brief - The powers of ten which can be represented exactly by a double.
+         */
+        const double sk_exactPowers[] = {
+          1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+          1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+          1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+
+        /**
+         * @brief - The powers of ten which can be represented by an unsigned integer on
+         *          at least 64 bits, up to the maximum number of significant digits of a
+         *          float.
+         */
+        const unsigned long long sk_integerPowers[] = {
+          1ull,
+          10ull,
+          100ull,
+          1000ull,
+          10000ull,
+          100000ull,
+          1000000ull,
+          10000000ull,
+          100000000ull,
+          1000000000ull
+        };
+
+        /**
+         * @brief - Multiplies the input value by `10^exponent`. The result is exact as
+         *          long as both the value and the product can be represented exactly
+         *          and the magnitude of the exponent is not larger than `22`.
+         * @param value - the value to scale.
+         * @param exponent - the power of ten to scale the value with.
+         * @return - the scaled value.
+         */
+        double
+        scaleByPowerOfTen(double value,
+                          int exponent) noexcept
+        {
+          while (exponent > 22) {
+            value *= sk_exactPowers[22];
+            exponent -= 22;
+          }
+          while (exponent < -22) {
+            value /= sk_exactPowers[22];
+            exponent += 22;
+          }
+
+          return (exponent >= 0 ? value * sk_exactPowers[exponent] : value / sk_exactPowers[-exponent]);
+        }
+
+        /**
+         * @brief - Writes the decimal digits of the input value in the output buffer
+         *          which should be at least `20` characters long.
+         * @param value - the value to write.
+         * @param out - the buffer receiving the digits.
+         * @return - the number of digits written.
+         */
+        std::size_t
+        writeDigits(unsigned long long value,
+                    char* out) noexcept
+        {
+          char reversed[20];
+          std::size_t count = 0u;
+
+          do {
+            reversed[count] = static_cast<char>('0' + value % 10u);
+            value /= 10u;
+            ++count;
+          } while (value > 0u);
+
+          for (std::size_t id = 0u ; id < count ; ++id) {
+            out[id] = reversed[count - 1u - id];
+          }
+
+          return count;
+        }
+
+        /**
+         * @brief - Writes the decimal digits of the input integral value in the output
+         *          buffer which should be at least `40` characters long. The value is
+         *          expected to be smaller than `2^128` which is the case of any float.
+         * @param value - the integral value to write.
+         * @param out - the buffer receiving the digits.
+         * @return - the number of digits written.
+         */
+        std::size_t
+        writeIntegralDigits(double value,
+                            char* out) noexcept
+        {
+          if (value < 1.8e19) {
+            return writeDigits(static_cast<unsigned long long>(value), out);
+          }
+
+          // Decompose the value into a 53 bits integer and a power of two
+          // and double the decimal digits of the integer as many times as
+          // needed. The digits are stored from the least significant one.
+          int exponent = 0;
+          double fraction = std::frexp(value, &exponent);
+          unsigned long long mantissa = static_cast<unsigned long long>(std::ldexp(fraction, 53));
+
+          unsigned char digits[40];
+          std::size_t count = 0u;
+
+          while (mantissa > 0u) {
+            digits[count] = static_cast<unsigned char>(mantissa % 10u);
+            mantissa /= 10u;
+            ++count;
+          }
+
+          for (int shift = 0 ; shift < exponent - 53 ; ++shift) {
+            unsigned carry = 0u;
+
+            for (std::size_t id = 0u ; id < count ; ++id) {
+              unsigned digit = digits[id] * 2u + carry;
+              digits[id] = static_cast<unsigned char>(digit % 10u);
+              carry = digit / 10u;
+            }
+
+            if (carry > 0u && count < sizeof(digits)) {
+              digits[count] = static_cast<unsigned char>(carry);
+              ++count;
+            }
+          }
+
+          for (std::size_t id = 0u ; id < count ; ++id) {
+            out[id] = static_cast<char>('0' + digits[count - 1u - id]);
+          }
+
+          return count;
+        }
+
+        /**
+         * @brief - Writes the text representing the input value if it is not finite.
+         * @param value - the value to write.
+         * @param out - the buffer receiving the text.
+         * @return - the number of characters written or `0` if the value is finite.
+         */
+        std::size_t
+        writeSpecialValue(float value,
+                          char* out) noexcept
+        {
+          const char* text = nullptr;
+
+          if (std::isnan(value)) {
+            text = (std::signbit(value) ? "-nan" : "nan");
+          }
+          else if (std::isinf(value)) {
+            text = (value < 0.0f ? "-inf" : "inf");
+          }
+
+          if (text == nullptr) {
+            return 0u;
+          }
+
+          std::size_t length = std::strlen(text);
+          std::memcpy(out, text, length);
+
+          return length;
+        }
+
+        /**
+         * @brief - Copies the text produced in the working buffer to the user's buffer
+         *          if it is large enough.
+         * @param text - the text to copy.
+         * @param length - the length of the text.
+         * @param out - the buffer receiving the text.
+         * @param size - the size of the buffer.
+         * @return - the length of the text or `0` if the buffer is too small.
+         */
+        std::size_t
+        copyToOutput(const char* text,
+                     std::size_t length,
+                     char* out,
+                     std::size_t size) noexcept
+        {
+          if (out == nullptr || length >= size) {
+            return 0u;
+          }
+
+          std::memcpy(out, text, length);
+          out[length] = '\0';
+
+          return length;
+        }
+
+        /**
+         * @brief - The maximum number of significant digits kept when interpreting a value.
+         *          Any decimal value lying exactly halfway between two floats has less than
+         *          this many significant digits: the digits past this limit can thus be
+         *          summarized by a single non zero digit without changing the rounding.
+         */
+        const int sk_maximumSignificantDigits = 120;
+
+        /**
+         * @brief - The powers of ten which can be represented exactly by a float.
+         */
+        const float sk_exactFloatPowers[] = {
+          1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+        };
+
+        /**
+         * @brief - Converts the value `digits * 10^exponent` to the nearest float, ties
+         *          being rounded to even. When both the digits and the power of ten are
+         *          exact floats a single float operation gives the correctly rounded
+         *          result. Otherwise the value is written in a stack buffer and handed to
+         *          `strtof` which rounds correctly: the text only holds digits and an
+         *          exponent so that it does not depend on the current locale.
+         * @param digits - the significant digits of the value, without leading zeros.
+         * @param count - the number of significant digits, at most the value returned by
+         *                `sk_maximumSignificantDigits`.
+         * @param exponent - the power of ten to scale the digits with.
+         * @param out - output argument receiving the converted value.
+         * @return - `true` if the value could be converted without overflowing.
+         */
+        bool
+        convertDigits(const char* digits,
+                      int count,
+                      int exponent,
+                      float& out) noexcept
+        {
+          if (count <= 9 && exponent >= -10 && exponent <= 10) {
+            unsigned long mantissa = 0u;
+            for (int id = 0 ; id < count ; ++id) {
+              mantissa = mantissa * 10u + static_cast<unsigned>(digits[id] - '0');
+            }
+
+            if (mantissa <= (1u << 24u)) {
+              const float m = static_cast<float>(mantissa);
+
+              out = (exponent >= 0 ? m * sk_exactFloatPowers[exponent] : m / sk_exactFloatPowers[-exponent]);
+
+              return true;
+            }
+          }
+
+          char buffer[sk_maximumSignificantDigits + 16];
+          std::memcpy(buffer, digits, count);
+
+          std::size_t length = count;
+          buffer[length] = 'e';
+          ++length;
+
+          if (exponent < 0) {
+            buffer[length] = '-';
+            ++length;
+          }
+
+          length += writeDigits(static_cast<unsigned long long>(exponent < 0 ? -exponent : exponent), buffer + length);
+          buffer[length] = '\0';
+
+          const float result = std::strtof(buffer, nullptr);
+          if (std::isinf(result)) {
+            return false;
+          }
+
+          out = result;
+
+          return true;
+        }
+
+      }
+
+      bool
+      parseFloat(const char* text,
+                 std::size_t length,
+                 float& value) noexcept
+      {
+        std::size_t id = 0u;
+        bool negative = false;
+
+        if (length > 0u && (text[0] == '-' || text[0] == '+')) {
+          negative = (text[0] == '-');
+          ++id;
+        }
+
+        // Gather the significant digits of the mantissa: the leading zeros
+        // are skipped and the digits past the maximum count are replaced by
+        // a single non zero digit if any of them is not zero. The exponent
+        // accounts for the position of the decimal point.
+        char digits[sk_maximumSignificantDigits + 1];
+        int count = 0;
+        bool truncated = false;
+        int exponent = 0;
+        bool hasDigits = false;
+
+        for ( ; id < length && text[id] >= '0' && text[id] <= '9' ; ++id) {
+          hasDigits = true;
+
+          if (count == 0 && text[id] == '0') {
+            continue;
+          }
+
+          if (count < sk_maximumSignificantDigits) {
+            digits[count] = text[id];
+            ++count;
+          }
+          else {
+            truncated = truncated || text[id] != '0';
+            ++exponent;
+          }
+        }
+
+        if (id < length && text[id] == '.') {
+          ++id;
+
+          for ( ; id < length && text[id] >= '0' && text[id] <= '9' ; ++id) {
+            hasDigits = true;
+
+            if (count == 0 && text[id] == '0') {
+              --exponent;
+            }
+            else if (count < sk_maximumSignificantDigits) {
+              digits[count] = text[id];
+              ++count;
+              --exponent;
+            }
+            else {
+              truncated = truncated || text[id] != '0';
+            }
+          }
+        }
+
+        if (!hasDigits) {
+          return false;
+        }
+
+        // Interpret the exponent if any: it should contain at least one
+        // digit. Its magnitude is clamped as any value past a few hundreds
+        // already overflows or underflows.
+        if (id < length && (text[id] == 'e' || text[id] == 'E')) {
+          ++id;
+
+          bool negativeExp = false;
+          if (id < length && (text[id] == '-' || text[id] == '+')) {
+            negativeExp = (text[id] == '-');
+            ++id;
+          }
+
+          const std::size_t start = id;
+
+          int explicitExp = 0;
+          for ( ; id < length && text[id] >= '0' && text[id] <= '9' ; ++id) {
+            explicitExp = std::min(explicitExp * 10 + (text[id] - '0'), 10000);
+          }
+
+          if (id == start) {
+            return false;
+          }
+
+          exponent += (negativeExp ? -explicitExp : explicitExp);
+        }
+
+        // The whole text should be consumed.
+        if (id != length) {
+          return false;
+        }
+
+        // The largest float is below `10^39` and the smallest one above
+        // `10^-46`: values outside of these bounds are not converted.
+        float result = 0.0f;
+
+        if (count > 0 && exponent + count > -50) {
+          if (exponent + count > 40) {
+            return false;
+          }
+
+          if (truncated) {
+            digits[count] = '1';
+            ++count;
+            --exponent;
+          }
+
+          if (!convertDigits(digits, count, exponent, result)) {
+            return false;
+          }
+        }
+
+        value = (negative ? -result : result);
+
+        return true;
+      }
+
+      std::size_t
+      formatFixed(float value,
+                  unsigned decimals,
+                  char* out,
+                  std::size_t size) noexcept
+      {
+        char buffer[64];
+        std::size_t length = writeSpecialValue(value, buffer);
+
+        if (length > 0u) {
+          return copyToOutput(buffer, length, out, size);
+        }
+
+        decimals = std::min(decimals, getMaximumDecimals());
+
+        if (std::signbit(value)) {
+          buffer[length] = '-';
+          ++length;
+        }
+
+        // A float has at most `24` significant bits and `10^9` at most
+        // `21` bits once the powers of two are taken out: the product is
+        // thus exact in a double and rounding it to the nearest integer
+        // (ties to even) yields the same result as the standard streams.
+        double magnitude = std::fabs(static_cast<double>(value));
+        double scaled = magnitude * sk_exactPowers[decimals];
+
+        unsigned long long fraction = 0u;
+
+        if (scaled < 9.0e18) {
+          unsigned long long rounded = static_cast<unsigned long long>(std::nearbyint(scaled));
+
+          length += writeDigits(rounded / sk_integerPowers[decimals], buffer + length);
+          fraction = rounded % sk_integerPowers[decimals];
+        }
+        else {
+          // Such a large float is necessarily an integer: the decimals
+          // are all zeros.
+          length += writeIntegralDigits(magnitude, buffer + length);
+        }
+
+        if (decimals > 0u) {
+          buffer[length] = '.';
+          ++length;
+
+          // Pad the decimals with leading zeros.
+          for (std::size_t id = decimals ; id > 0u ; --id) {
+            buffer[length + id - 1u] = static_cast<char>('0' + fraction % 10u);
+            fraction /= 10u;
+          }
+
+          length += decimals;
+        }
+
+        return copyToOutput(buffer, length, out, size);
+      }
+
+      std::size_t
+      formatShortest(float value,
+                     char* out,
+                     std::size_t size) noexcept
+      {
+        char buffer[64];
+        std::size_t length = writeSpecialValue(value, buffer);
+
+        if (length > 0u) {
+          return copyToOutput(buffer, length, out, size);
+        }
+
+        if (std::signbit(value)) {
+          buffer[length] = '-';
+          ++length;
+        }
+
+        if (value == 0.0f) {
+          buffer[length] = '0';
+          ++length;
+
+          return copyToOutput(buffer, length, out, size);
+        }
+
+        // Estimate the decimal exponent of the value and correct it using
+        // its first nine significant digits: this accounts for the powers
+        // of ten which cannot be represented exactly.
+        double magnitude = std::fabs(static_cast<double>(value));
+
+        int exponent = countIntegralDigits(value) - 1;
+        if (magnitude < 1.0) {
+          exponent = -1;
+          while (scaleByPowerOfTen(magnitude, -exponent) < 1.0) {
+            --exponent;
+          }
+        }
+
+        double leading = scaleByPowerOfTen(magnitude, 8 - exponent);
+        if (leading >= sk_exactPowers[9]) {
+          ++exponent;
+        }
+        else if (leading < sk_exactPowers[8]) {
+          --exponent;
+        }
+
+        // Try an increasing number of significant digits until the text
+        // converts back to the input value. Nine digits always do for a
+        // float. As scaling the value may be off by a tiny amount both
+        // the nearest candidate and its neighbour on the other side of
+        // the scaled value are tried. The conversion back is exact.
+        unsigned long long digits = 0u;
+        int precision = 1;
+        int digitsExp = exponent;
+        bool found = false;
+
+        for ( ; precision <= 9 && !found ; ++precision) {
+          const double scaled = scaleByPowerOfTen(magnitude, precision - 1 - exponent);
+          const unsigned long long nearest = static_cast<unsigned long long>(std::nearbyint(scaled));
+          const unsigned long long candidates[] = {
+            nearest,
+            (scaled > static_cast<double>(nearest) ? nearest + 1u : nearest - 1u)
+          };
+
+          for (unsigned c = 0u ; c < 2u && !found ; ++c) {
+            unsigned long long candidate = candidates[c];
+            int candidateExp = exponent;
+
+            // Rounding may carry to an additional digit.
+            if (candidate >= sk_integerPowers[precision]) {
+              candidate /= 10u;
+              ++candidateExp;
+            }
+
+            // The candidate should have exactly `precision` digits.
+            if (candidate < sk_integerPowers[precision - 1]) {
+              continue;
+            }
+
+            // Keep the nearest candidate in case none converts back to
+            // the input value.
+            if (c == 0u) {
+              digits = candidate;
+              digitsExp = candidateExp;
+            }
+
+            char text[20];
+            const int count = static_cast<int>(writeDigits(candidate, text));
+
+            float converted = 0.0f;
+            found = (
+              convertDigits(text, count, candidateExp - precision + 1, converted) &&
+              converted == std::fabs(value)
+            );
+
+            if (found) {
+              digits = candidate;
+              digitsExp = candidateExp;
+            }
+          }
+        }
+
+        // Nine digits are always enough: the nearest candidate with this
+        // precision is used if none converted back to the input value.
+        --precision;
+
+        // Remove trailing zeros which do not bring any information.
+        while (precision > 1 && digits % 10u == 0u) {
+          digits /= 10u;
+          --precision;
+        }
+
+        char text[20];
+        const int count = static_cast<int>(writeDigits(digits, text));
+
+        if (digitsExp >= -5 && digitsExp < 9) {
+          // Standard notation.
+          if (digitsExp < 0) {
+            buffer[length] = '0';
+            buffer[length + 1u] = '.';
+            length += 2u;
+
+            for (int id = 0 ; id < -digitsExp - 1 ; ++id) {
+              buffer[length] = '0';
+              ++length;
+            }
+
+            std::memcpy(buffer + length, text, count);
+            length += count;
+          }
+          else if (count <= digitsExp + 1) {
+            std::memcpy(buffer + length, text, count);
+            length += count;
+
+            for (int id = count ; id < digitsExp + 1 ; ++id) {
+              buffer[length] = '0';
+              ++length;
+            }
+          }
+          else {
+            std::memcpy(buffer + length, text, digitsExp + 1);
+            length += digitsExp + 1;
+
+            buffer[length] = '.';
+            ++length;
+
+            std::memcpy(buffer + length, text + digitsExp + 1, count - digitsExp - 1);
+            length += count - digitsExp - 1;
+          }
+        }
+        else {
+          // Scientific notation.
+          buffer[length] = text[0];
+          ++length;
+
+          if (count > 1) {
+            buffer[length] = '.';
+            ++length;
+
+            std::memcpy(buffer + length, text + 1, count - 1);
+            length += count - 1;
+          }
+
+          buffer[length] = 'e';
+          ++length;
+
+          if (digitsExp < 0) {
+            buffer[length] = '-';
+            ++length;
+          }
+
+          length += writeDigits(static_cast<unsigned long long>(digitsExp < 0 ? -digitsExp : digitsExp), buffer + length);
+        }
+
+        return copyToOutput(buffer, length, out, size);
+      }
+
+    }
+  }
+}
@@ -0,0 +1,145 @@
+#ifndef    NUMERIC_TEXT_HH
+# define   NUMERIC_TEXT_HH
+
+# include <string>
+# include <cstddef>
+
+namespace sdl {
+  namespace graphic {
+    namespace number {
+
+      /**
+       * @brief - Retrieves the size of a buffer large enough to hold any value produced by
+       *          the formatting functions of this module, including the terminal '\0'.
+       * @return - the minimum size of a buffer which guarantees that formatting succeeds.
+       */
+      std::size_t
+      getMaximumFormattedLength() noexcept;
+
+      /**
+       * @brief - Retrieves the maximum number of decimals that can be requested when
+       *          formatting a value with a fixed number of decimals. A float does not
+       *          hold more than nine significant digits anyway.
+       * @return - the maximum number of decimals.
+       */
+      unsigned
+      getMaximumDecimals() noexcept;
+
+      /**
+       * @brief - Counts the digits needed to write the magnitude of the input integer. The
+       *          sign is not counted and `0` is considered to have a single digit.
+       * @param value - the value for which digits should be counted.
+       * @return - the number of digits of the value.
+       */
+      int
+      countDigits(int value) noexcept;
+
+      /**
+       * @brief - Counts the digits of the integral part of the magnitude of the input value.
+       *          Values with a magnitude smaller than `1` have a single digit (the leading
+       *          `0`). Invalid values (infinity or nan) are also considered to have a single
+       *          digit.
+       * @param value - the value for which digits should be counted.
+       * @return - the number of digits of the integral part of the value.
+       */
+      int
+      countIntegralDigits(float value) noexcept;
+
+      /**
+       * @brief - Interprets the `length` characters starting at `text` as an integer. The
+       *          text should be made of an optional sign followed by at least one digit and
+       *          nothing else. No memory is allocated by this function.
+       * @param text - the characters to interpret.
+       * @param length - the number of characters to interpret.
+       * @param value - output argument receiving the value if the conversion succeeds. It
+       *                is left unchanged otherwise.
+       * @return - `true` if the text represents an integer which fits in an `int`.
+       */
+      bool
+      parseInt(const char* text,
+               std::size_t length,
+               int& value) noexcept;
+
+      /**
+       * @brief - Interprets the `length` characters starting at `text` as a floating point
+       *          value. The text should be made of an optional sign, some digits optionally
+       *          separated by a '.' character and an optional exponent introduced by 'e' or
+       *          'E'. At least one digit is required in the mantissa and in the exponent if
+       *          it is present. The value is rounded to the nearest float, ties being rounded
+       *          to even, which is the result `strtof` produces in the "C" locale. No memory
+       *          is allocated by this function.
+       * @param text - the characters to interpret.
+       * @param length - the number of characters to interpret.
+       * @param value - output argument receiving the value if the conversion succeeds. It
+       *                is left unchanged otherwise.
+       * @return - `true` if the text represents a value which fits in a `float`.
+       */
+      bool
+      parseFloat(const char* text,
+                 std::size_t length,
+                 float& value) noexcept;
+
+      /**
+       * @brief - Writes the input value with exactly `decimals` digits after the decimal
+       *          point, similarly to what `std::fixed` produces. The value is rounded to
+       *          the nearest representable text, ties being rounded to even. The number
+       *          of decimals is clamped to `getMaximumDecimals`.
+       *          No memory is allocated and the output is null terminated.
+       * @param value - the value to format.
+       * @param decimals - the number of decimals to produce.
+       * @param out - the buffer receiving the text.
+       * @param size - the size of the buffer.
+       * @return - the number of characters written, not counting the terminal '\0' or `0`
+       *           if the buffer is too small.
+       */
+      std::size_t
+      formatFixed(float value,
+                  unsigned decimals,
+                  char* out,
+                  std::size_t size) noexcept;
+
+      /**
+       * @brief - Writes the shortest text which converts back to the input value through
+       *          `parseFloat`. Values with a decimal exponent in `[-5; 9[` are written in
+       *          standard notation and other values in scientific notation.
+       *          No memory is allocated and the output is null terminated.
+       * @param value - the value to format.
+       * @param out - the buffer receiving the text.
+       * @param size - the size of the buffer.
+       * @return - the number of characters written, not counting the terminal '\0' or `0`
+       *           if the buffer is too small.
+       */
+      std::size_t
+      formatShortest(float value,
+                     char* out,
+                     std::size_t size) noexcept;
+
+      /**
+       * @brief - Convenience wrapper around `formatFixed` which assigns the text to the
+       *          input string. The storage of the string is reused when possible.
+       * @param value - the value to format.
+       * @param decimals - the number of decimals to produce.
+       * @param out - the string receiving the text.
+       */
+      void
+      toFixed(float value,
+              unsigned decimals,
+              std::string& out);
+
+      /**
+       * @brief - Convenience wrapper around `formatShortest` which assigns the text to the
+       *          input string. The storage of the string is reused when possible.
+       * @param value - the value to format.
+       * @param out - the string receiving the text.
+       */
+      void
+      toShortest(float value,
+                 std::string& out);
+
+    }
+  }
+}
+
+# include "NumericText.hxx"
+
+#endif    /* NUMERIC_TEXT_HH */
@@ -0,0 +1,131 @@
+#ifndef    NUMERIC_TEXT_HXX
+# define   NUMERIC_TEXT_HXX
+
+# include "NumericText.hh"
+# include <cmath>
+# include <limits>
+
+namespace sdl {
+  namespace graphic {
+    namespace number {
+
+      inline
+      std::size_t
+      getMaximumFormattedLength() noexcept {
+        // The longest text is produced by formatting the largest float
+        // with the maximum number of decimals: a sign, `39` digits, the
+        // decimal point and the decimals.
+        return 64u;
+      }
+
+      inline
+      unsigned
+      getMaximumDecimals() noexcept {
+        return 9u;
+      }
+
+      inline
+      int
+      countDigits(int value) noexcept {
+        // Use the unsigned magnitude so that the lowest integer which
+        // does not have a positive counterpart is handled as well.
+        unsigned magnitude = (value < 0 ? 0u - static_cast<unsigned>(value) : static_cast<unsigned>(value));
+
+        int digits = 1;
+        while (magnitude >= 10u) {
+          magnitude /= 10u;
+          ++digits;
+        }
+
+        return digits;
+      }
+
+      inline
+      int
+      countIntegralDigits(float value) noexcept {
+        if (!std::isfinite(value)) {
+          return 1;
+        }
+
+        // Compare against successive powers of ten: a float has at most
+        // `39` integral digits so the loop stays short.
+        double magnitude = std::fabs(static_cast<double>(value));
+        double power = 10.0;
+
+        int digits = 1;
+        while (magnitude >= power) {
+          power *= 10.0;
+          ++digits;
+        }
+
+        return digits;
+      }
+
+      inline
+      bool
+      parseInt(const char* text,
+               std::size_t length,
+               int& value) noexcept
+      {
+        std::size_t id = 0u;
+        bool negative = false;
+
+        if (length > 0u && (text[0] == '-' || text[0] == '+')) {
+          negative = (text[0] == '-');
+          ++id;
+        }
+
+        // At least one digit is needed.
+        if (id >= length) {
+          return false;
+        }
+
+        // Accumulate the magnitude and stop as soon as it cannot be
+        // represented by an `int` anymore.
+        const long long limit = static_cast<long long>(std::numeric_limits<int>::max()) + (negative ? 1 : 0);
+        long long magnitude = 0;
+
+        for ( ; id < length ; ++id) {
+          if (text[id] < '0' || text[id] > '9') {
+            return false;
+          }
+
+          magnitude = magnitude * 10 + (text[id] - '0');
+          if (magnitude > limit) {
+            return false;
+          }
+        }
+
+        value = static_cast<int>(negative ? -magnitude : magnitude);
+
+        return true;
+      }
+
+      inline
+      void
+      toFixed(float value,
+              unsigned decimals,
+              std::string& out)
+      {
+        char buffer[64];
+        std::size_t length = formatFixed(value, decimals, buffer, sizeof(buffer));
+
+        out.assign(buffer, length);
+      }
+
+      inline
+      void
+      toShortest(float value,
+                 std::string& out)
+      {
+        char buffer[64];
+        std::size_t length = formatShortest(value, buffer, sizeof(buffer));
+
+        out.assign(buffer, length);
+      }
+
+    }
+  }
+}
+
+#endif    /* NUMERIC_TEXT_HXX */
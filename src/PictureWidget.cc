@@ -1,5 +1,49 @@
 
 # include "PictureWidget.hh"
+# include <SDL2/SDL_hints.h>
+
+namespace {
+
+  /**
+   * @brief - Requests the textures created while an instance of this class exists to
+   *          be filtered linearly when they are scaled, instead of using the nearest
+   *          pixel. The hint is set with a normal priority so that a value forced by
+   *          the application or the environment still applies. The previous value of
+   *          the hint is restored upon destroying the object, including the absence
+   *          of value.
+   */
+  class LinearScaling {
+    public:
+
+      LinearScaling():
+        m_previous(),
+        m_hadValue(false)
+      {
+        const char* previous = SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY);
+
+        m_hadValue = (previous != nullptr);
+        if (m_hadValue) {
+          m_previous = previous;
+        }
+
+        SDL_SetHintWithPriority(SDL_HINT_RENDER_SCALE_QUALITY, "linear", SDL_HINT_NORMAL);
+      }
+
+      ~LinearScaling() {
+        SDL_SetHintWithPriority(
+          SDL_HINT_RENDER_SCALE_QUALITY,
+          m_hadValue ? m_previous.c_str() : nullptr,
+          SDL_HINT_NORMAL
+        );
+      }
+
+    private:
+
+      std::string m_previous;
+      bool m_hadValue;
+  };
+
+}
 
 namespace sdl {
   namespace graphic {
@@ -9,16 +53,26 @@ namespace sdl {
                                        const Mode& mode,
                                        SdlWidget* parent,
                                        const core::engine::Color& color,
-                                       const utils::Sizef& area):
+                                       const utils::Sizef& area,
+                                       bool async):
       core::SdlWidget(name, area, parent, color),
 
       m_propsLocker(),
 
       m_mode(mode),
-      m_img(std::make_shared<core::engine::Image>(picture)),
+      m_path(picture),
+      m_img(async || picture.empty() ? nullptr : ImageCache::getInstance().acquire(picture)),
 
       m_picture(),
-      m_picChanged(true)
+      m_placeholder(false),
+      m_picChanged(true),
+
+      m_scaled(),
+      m_scaledSize(),
+
+      m_async(async),
+      m_autoSize(!area.valid()),
+      m_decoding()
     {
       // Check whether we can assign a valid size hint to this item if possible.
       // The size hint could either be the result of the input area (in which
@@ -28,8 +82,13 @@ namespace sdl {
       // Typically in the case of a picture mode set to `Fit` we want to assign
       // a size hint equivalent to the initial size of the picture. This allows
       // to at least request that the picture can be displayed in full.
+      // When the picture is decoded asynchronously, its size is not known yet:
+      // the size hint will be assigned once the decoding is done.
       if (!area.valid()) {
-        setSizeHint(m_img->getSize());
+        if (m_img != nullptr) {
+          setSizeHint(m_img->getSize());
+        }
+
         setSizePolicy(
           sdl::core::SizePolicy(
             sdl::core::SizePolicy::Name::Preferred,
@@ -37,52 +96,175 @@ namespace sdl {
           )
         );
       }
+
+      if (m_async && !picture.empty()) {
+        startDecoding(picture);
+      }
     }
 
     PictureWidget::~PictureWidget() {
       Guard guard(m_propsLocker);
+
+      cancelDecoding();
+      TextureBudget::getInstance().discharge(this);
       clearPicture();
+      clearScaledPicture();
+      releaseImage();
     }
 
     void
-    PictureWidget::drawContentPrivate(const utils::Uuid& uuid,
-                                      const utils::Boxf& area)
-    {
-      // Acquire the lock on the attributes of this widget.
-      Guard guard(m_propsLocker);
+    PictureWidget::notifyPictureDecoded() {
+      // This runs on the decoding thread: the widget is only notified through
+      // an event which concerns the whole widget (hence no update region). It
+      // will be processed on the main thread.
+      std::shared_ptr<core::engine::PaintEvent> pe = std::make_shared<core::engine::PaintEvent>(this);
+      pe->setEmitter(this);
 
-      // Load the picture: this should happen only if the picture has changed
-      // since last draw operation.
-      if (pictureChanged()) {
-        loadPicture();
-        m_picChanged = false;
+      postEvent(pe);
+    }
+
+    void
+    PictureWidget::retrieveDecodedPicture() {
+      if (m_decoding == nullptr || !m_decoding->isDone()) {
+        return;
       }
 
-      // If we don't have any picture to display, return early, nothing more
-      // to do.
+      // The image has been obtained from the image cache by the decoding thread:
+      // this widget now holds the reference on it.
+      m_img = m_decoding->takeImage();
+      m_decoding.reset();
+
+      // Update the size hint if needed: the header of the file may not have
+      // provided it.
+      updateSizeHintFrom(m_img);
+
+      setPictureChanged();
+    }
+
+    bool
+    PictureWidget::repaintEvent(const core::engine::PaintEvent& e) {
+      {
+        Guard guard(m_propsLocker);
+
+        retrieveDecodedPicture();
+      }
+
+      return core::SdlWidget::repaintEvent(e);
+    }
+
+    void
+    PictureWidget::loadScaledPicture(const utils::Sizef& size) {
+      clearScaledPicture();
+
+      // The scaled picture is built from the full resolution picture which may
+      // have been released after building a previous scaled version.
       if (!m_picture.valid()) {
+        loadSourcePicture(size);
+      }
+
+      if (!m_picture.valid() || !size.valid()) {
         return;
       }
 
-      // Handle the drawing of the picture based on the fitting mode. A fit
-      // operation is easier because we just blit the picture so that it takes
-      // up all the space available.
-      // The `Crop` mode specifies that only the part of the picture which can
-      // be displayed in the provided space should be displayed.
-      // We also need to handle the `area` of the picture which should be drawn
-      // so that we only handle the intersection of the area provided in input
-      // and the area spanned by the picture.
-      //
-      // In any of the available mode an important part of the process is to
-      // determine which part of the image should be blit if the area spans the
-      // entire area available in the `uuid` texture.
-      // This area will be then intersected with the actual `area` to be drawn
-      // in order to only repaint the needed bits.
-      // So a first preliminary step is to determine these values.
-
-      // In a first approach let's consider that the entire picture can be drawn.
-      utils::Sizef sizePic = getEngine().queryTexture(m_picture);
-      utils::Boxf srcRect = utils::Boxf::fromSize(sizePic, true);
+      // The picture is still being decoded: there is no point in scaling the
+      // placeholder, it can be created directly at the target size. It will
+      // be replaced once the picture is available.
+      if (m_placeholder) {
+        clearPicture();
+
+        m_scaled = getEngine().createTexture(size, core::engine::Palette::ColorRole::Mid);
+        getEngine().fillTexture(m_scaled, getPalette());
+        m_scaledSize = size;
+
+        chargePicture();
+
+        return;
+      }
+
+      // Downscaling by a large factor in a single step would skip most of the
+      // pixels of the picture: instead we successively halve the picture until
+      // it is less than twice as large as the target. The textures created in
+      // the process are filtered linearly so that each halving step averages
+      // neighbouring pixels: this behaves like a box filter.
+      // The filtering mode applies to the texture being scaled so the picture
+      // (which is created by the image cache) is first copied with no scaling
+      // into such a texture.
+      LinearScaling linear;
+
+      utils::Sizef sizeCur = getEngine().queryTexture(m_picture);
+      utils::Uuid current = getEngine().createTexture(sizeCur, core::engine::Palette::ColorRole::Base);
+      blitWhole(m_picture, sizeCur, current, sizeCur);
+
+      while (sizeCur.w() >= 2.0f * size.w() && sizeCur.h() >= 2.0f * size.h()) {
+        utils::Sizef sizeHalf(std::floor(sizeCur.w() / 2.0f), std::floor(sizeCur.h() / 2.0f));
+
+        utils::Uuid half = getEngine().createTexture(sizeHalf, core::engine::Palette::ColorRole::Base);
+        blitWhole(current, sizeCur, half, sizeHalf);
+
+        getEngine().destroyTexture(current);
+
+        current = half;
+        sizeCur = sizeHalf;
+      }
+
+      // Perform the last step to reach the target size.
+      m_scaled = getEngine().createTexture(size, core::engine::Palette::ColorRole::Base);
+      blitWhole(current, sizeCur, m_scaled, size);
+
+      getEngine().destroyTexture(current);
+
+      m_scaledSize = size;
+
+      // Neither the full resolution picture nor the image are needed anymore:
+      // they are given back to the image cache which keeps them until they
+      // get evicted, so that a resize of the widget does not need to decode
+      // and upload the picture again.
+      clearPicture();
+      releaseImage();
+
+      chargePicture();
+    }
+
+    bool
+    PictureWidget::evictPicture() const {
+      // Do not wait for the widget if it is busy: the textures can be evicted
+      // later on.
+      std::unique_lock<std::mutex> guard(m_propsLocker, std::try_to_lock);
+      if (!guard.owns_lock()) {
+        return false;
+      }
+
+      clearPicture();
+      clearScaledPicture();
+      m_picChanged = true;
+
+      return true;
+    }
+
+    void
+    PictureWidget::blitWhole(const utils::Uuid& from,
+                             const utils::Sizef& fromSize,
+                             const utils::Uuid& to,
+                             const utils::Sizef& toSize) const
+    {
+      utils::Boxf src = utils::Boxf::fromSize(fromSize, true);
+      utils::Boxf dst = utils::Boxf::fromSize(toSize, true);
+
+      utils::Boxf srcEngine = convertToEngineFormat(src, src);
+      utils::Boxf dstEngine = convertToEngineFormat(dst, dst);
+
+      getEngine().drawTexture(from, &srcEngine, &to, &dstEngine);
+    }
+
+    void
+    PictureWidget::drawContentPrivate(const utils::Uuid& uuid,
+                                      const utils::Boxf& area)
+    {
+      // Acquire the lock on the attributes of this widget.
+      Guard guard(m_propsLocker);
+
+      // The textures are used: prevent them from being evicted.
+      TextureBudget::getInstance().touch(this);
 
       // Handle the area where the picture should be drawn. The input `area` is
       // expected to be expressed in local coordinates so we can directly compute
@@ -93,6 +275,14 @@ namespace sdl {
       utils::Sizef sizeEnv = getEngine().queryTexture(uuid);
       utils::Boxf dstRect = utils::Boxf::fromSize(sizeEnv, true).intersect(area);
 
+      // Load the picture: this should happen only if the picture has changed
+      // since last draw operation. While the picture is being decoded we
+      // display a placeholder instead.
+      if (pictureChanged()) {
+        loadPicture(sizeEnv);
+        m_picChanged = false;
+      }
+
       // Check whether the `dstRect` is valid: if this is not the case it means
       // that we're indeed asked to repaint an area that is not inside this
       // widget so we can return early as there's nothing to do.
@@ -100,45 +290,61 @@ namespace sdl {
         return;
       }
 
+      // Handle the drawing of the picture based on the fitting mode. A fit
+      // operation is easier because we just blit the picture so that it takes
+      // up all the space available.
+      // The `Crop` mode specifies that only the part of the picture which can
+      // be displayed in the provided space should be displayed.
+      // We also need to handle the `area` of the picture which should be drawn
+      // so that we only handle the intersection of the area provided in input
+      // and the area spanned by the picture.
+
       // Handle `Fit` mode.
       if (m_mode == Mode::Fit) {
-        // In this mode the picture is automatically resized in order to fit the
-        // available space. It is thus much harder to exactly determine which
-        // part of the image will be drawn in the input `area`.
-        // To do so, we know that the whole `srcRect` gets mapped to a `sizeEnv`
-        // area upon drawing. From this we can deduce the initial area which gets
-        // mapped to `area` in the final drawing.
-        // Once we have this information we can use ti to draw the initial area
-        // and map it to the desired `area` part of the final image.
-
-        // Determine the initial location of the input `area` in the initial image.
-        const float wScale = sizeEnv.w() / srcRect.w();
-        const float hScale = sizeEnv.h() / srcRect.h();
-
-        const utils::Vector2f center = utils::Vector2f(dstRect.x() / wScale, dstRect.y() / hScale);
-
-        utils::Boxf areaAsSrc(center, dstRect.w() / wScale, dstRect.h() / hScale);
-
-        // The output `area` corresponds to the `areaAsSrc` portion of the initial
-        // image. We now need to intersect this with the image area and see if
-        // this makes sense. The only restriction is if the input `area` is larger
-        // than the available `sizeEnv`: this is the only case where the `srcRect`
-        // will perform any intersection on the `areaAsSrc`. Otherwise as we're
-        // performing a fit operation we can only draw subparts of the picture.
-        utils::Boxf srcAreaToDraw = srcRect.intersect(areaAsSrc);
-
-        // Convert this area to engine format.
-        utils::Boxf srcAreaToDrawEngine = convertToEngineFormat(srcAreaToDraw, srcRect);
+        // In this mode the picture is resized in order to fit the available
+        // space. Rather than scaling the full resolution picture upon each
+        // repaint we keep a copy of the picture scaled to the size of the
+        // canvas: this copy is built once per size and then blit with no
+        // scaling at all.
+        if (!m_scaled.valid() || m_scaledSize.w() != sizeEnv.w() || m_scaledSize.h() != sizeEnv.h()) {
+          loadScaledPicture(sizeEnv);
+        }
+
+        // If we don't have any picture to display, return early, nothing more
+        // to do.
+        if (!m_scaled.valid()) {
+          return;
+        }
+
+        // The scaled picture spans exactly the canvas so the `area` to repaint
+        // corresponds to the same area in the scaled picture.
+        utils::Boxf srcAreaToDrawEngine = convertToEngineFormat(dstRect, utils::Boxf::fromSize(sizeEnv, true));
 
         // The final blit area can be directly converted into engine usable format.
         utils::Boxf dstRectEngine = convertToEngineFormat(dstRect, LayoutItem::getRenderingArea());
 
         // Repaint the picture.
-        getEngine().drawTexture(m_picture, &srcAreaToDrawEngine, &uuid, &dstRectEngine);
+        getEngine().drawTexture(m_scaled, &srcAreaToDrawEngine, &uuid, &dstRectEngine);
       }
 
       // Handle `Crop` mode.
       if (m_mode == Mode::Crop) {
+        // The full resolution picture might have been released if the widget
+        // was displayed in `Fit` mode: restore it if needed.
+        if (!m_picture.valid()) {
+          loadSourcePicture(sizeEnv);
+        }
+
+        // If we don't have any picture to display, return early, nothing more
+        // to do.
+        if (!m_picture.valid()) {
+          return;
+        }
+
+        // In a first approach let's consider that the entire picture can be drawn.
+        utils::Sizef sizePic = getEngine().queryTexture(m_picture);
+        utils::Boxf srcRect = utils::Boxf::fromSize(sizePic, true);
+
         // In crop mode, the picture is displayed with no scaling and just takes
         // the maximum amount of space between what's available and its internal
         // size.
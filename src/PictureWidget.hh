@@ -1,10 +1,14 @@
 #ifndef    PICTUREWIDGET_HH
 # define   PICTUREWIDGET_HH
 
+# include <cmath>
 # include <memory>
 # include <string>
 # include <sdl_core/SdlWidget.hh>
 # include <sdl_engine/Image.hh>
+# include "ImageDecoder.hh"
+# include "ImageCache.hh"
+# include "TextureBudget.hh"
 
 namespace sdl {
   namespace graphic {
@@ -24,7 +28,8 @@ namespace sdl {
                          const Mode& mode = Mode::Crop,
                          SdlWidget* parent = nullptr,
                          const core::engine::Color& color = core::engine::Color(),
-                         const utils::Sizef& area = utils::Sizef());
+                         const utils::Sizef& area = utils::Sizef(),
+                         bool async = false);
 
         virtual ~PictureWidget();
 
@@ -50,14 +55,165 @@ namespace sdl {
         drawContentPrivate(const utils::Uuid& uuid,
                            const utils::Boxf& area) override;
 
+        /**
+         * @brief - Reimplementation of the base `SdlWidget` method. When the picture has
+         *          been decoded, the decoding thread posts a repaint event for the whole
+         *          widget: the image is retrieved here, from the main thread, before the
+         *          repaint is processed.
+         * @param e - the paint event.
+         * @return - `true` if the event was recognized, `false` otherwise.
+         */
+        bool
+        repaintEvent(const core::engine::PaintEvent& e) override;
+
       private:
 
+        /**
+         * @brief - Used to create the textures representing the picture. Any existing
+         *          texture is discarded. Assumes that the locker is already acquired.
+         * @param size - the size of the canvas, used to size the placeholder if the
+         *               picture is still being decoded.
+         */
+        void
+        loadPicture(const utils::Sizef& size);
+
+        /**
+         * @brief - Used to create the full resolution texture representing the picture
+         *          or a placeholder if the picture is still being decoded. The image is
+         *          retrieved from the image cache if it was released: in case it has been
+         *          evicted in the meantime it is decoded again. In asynchronous mode this
+         *          happens on the decoding threads and the placeholder is displayed until
+         *          then, otherwise it is decoded right away.
+         *          Assumes that the locker is already acquired.
+         * @param size - the size of the canvas, used to size the placeholder.
+         */
+        void
+        loadSourcePicture(const utils::Sizef& size);
+
+        /**
+         * @brief - Used to create a copy of the picture scaled to the specified size. The
+         *          full resolution texture and the image are given back to the image cache
+         *          once the copy is built. The intermediate textures are filtered linearly
+         *          so that each halving step averages neighbouring pixels. A placeholder
+         *          is directly created at the specified size.
+         *          Assumes that the locker is already acquired.
+         * @param size - the size of the scaled copy.
+         */
+        void
+        loadScaledPicture(const utils::Sizef& size);
+
+        /**
+         * @brief - Draws the whole `from` texture onto the whole `to` texture, scaling
+         *          it if needed.
+         * @param from - the texture to draw.
+         * @param fromSize - the size of the `from` texture.
+         * @param to - the texture onto which the `from` texture is drawn.
+         * @param toSize - the size of the `to` texture.
+         */
+        void
+        blitWhole(const utils::Uuid& from,
+                  const utils::Sizef& fromSize,
+                  const utils::Uuid& to,
+                  const utils::Sizef& toSize) const;
+
+        /**
+         * @brief - Used to create a texture which is displayed in place of the picture
+         *          while it is being decoded. The placeholder has the size of the size
+         *          hint of this widget if any, and the provided size otherwise.
+         *          Assumes that the locker is already acquired.
+         * @param size - the size to use if no size hint is available.
+         */
+        void
+        loadPlaceholder(const utils::Sizef& size) const;
+
+        /**
+         * @brief - Schedules the decoding of the picture at the specified path on the
+         *          decoding threads. Any pending decoding is cancelled. In case the size
+         *          hint of this widget is deduced from the picture, it is read from the
+         *          header of the file beforehand so that the layout does not change when
+         *          the picture becomes available.
+         *          Assumes that the locker is already acquired.
+         * @param path - the path of the picture to decode.
+         */
+        void
+        startDecoding(const std::string& path);
+
+        /**
+         * @brief - Schedules the decoding of the picture at the current path on the
+         *          decoding threads. Unlike `startDecoding` the size hint is not updated:
+         *          this is used to reload a picture released since it was displayed.
+         *          Assumes that the locker is already acquired.
+         */
+        void
+        requestDecoding();
+
+        /**
+         * @brief - Cancels the pending decoding operation if any. Once this method
+         *          returns the decoding thread will not access this widget anymore.
+         *          Assumes that the locker is already acquired.
+         */
+        void
+        cancelDecoding();
+
+        /**
+         * @brief - Called by the decoding thread when the picture has been decoded.
+         *          This method does not access the properties of the widget: it only
+         *          posts a repaint event, the image itself is retrieved when the event
+         *          is processed.
+         */
+        void
+        notifyPictureDecoded();
+
+        /**
+         * @brief - Retrieves the image produced by the pending decoding operation if it
+         *          is done: the image is registered in the image cache and the size hint
+         *          of the widget is updated if needed.
+         *          Assumes that the locker is already acquired.
+         */
+        void
+        retrieveDecodedPicture();
+
+        /**
+         * @brief - Updates the size hint of this widget from the input image if it is
+         *          deduced from the picture.
+         *          Assumes that the locker is already acquired.
+         * @param img - the image displayed by this widget.
+         */
         void
-        loadPicture() const;
+        updateSizeHintFrom(const core::engine::ImageShPtr& img);
 
         void
         clearPicture() const;
 
+        void
+        clearScaledPicture() const;
+
+        /**
+         * @brief - Registers the textures currently held by this widget in the texture
+         *          budget. Assumes that the locker is already acquired.
+         */
+        void
+        chargePicture() const;
+
+        /**
+         * @brief - Used by the texture budget to release the textures of this widget when
+         *          it was not drawn for a while. They are rebuilt upon the next call to
+         *          `drawContentPrivate`. The image itself is kept so that the rebuild does
+         *          not require to decode the picture again.
+         *          Acquires the locker if possible.
+         * @return - `true` if the textures could be released and `false` if the widget is
+         *           currently busy.
+         */
+        bool
+        evictPicture() const;
+
+        /**
+         * @brief - Gives back the image displayed by this widget to the image cache.
+         *          Assumes that the locker is already acquired.
+         */
+        void
+        releaseImage() const;
+
         bool
         pictureChanged() const noexcept;
 
@@ -78,12 +234,22 @@ namespace sdl {
          */
         Mode m_mode;
 
+        /**
+         * @brief - The path of the picture displayed by this widget. It is used to retrieve
+         *          the image from the image cache again when it was released.
+         */
+        std::string m_path;
+
         /**
          * @brief - Holds the picture to use to represent this widget. This value is created
          *          right upon building this widget and is used to provide an indication of
          *          the expected size of this widget.
+         *          The image is obtained from the image cache and is thus shared with the
+         *          other widgets displaying the same picture. In `Fit` mode it is given back
+         *          to the cache once the scaled copy is built: it is usually still cached
+         *          when the size of the widget changes.
          */
-        core::engine::ImageShPtr m_img;
+        mutable core::engine::ImageShPtr m_img;
 
         /**
          * @brief - Holds the identifier of the texture associated to this picture widget as
@@ -93,12 +259,47 @@ namespace sdl {
          */
         mutable utils::Uuid m_picture;
 
+        /**
+         * @brief - Whether `m_picture` is a placeholder owned by this widget or a texture
+         *          shared through the image cache.
+         */
+        mutable bool m_placeholder;
+
         /**
          * @brief - Holds the current status of the picture's identifier. This value indicates
          *          whether it's safe to use the `m_picture` value or a repaint operation should
          *          be performed before.
          */
         mutable bool m_picChanged;
+
+        /**
+         * @brief - A copy of the picture scaled to the size of the widget, used in `Fit`
+         *          mode so that repaints do not need to scale the picture. The size it
+         *          was built for is kept in `m_scaledSize`: it is rebuilt whenever the
+         *          size of the widget changes.
+         */
+        mutable utils::Uuid m_scaled;
+        mutable utils::Sizef m_scaledSize;
+
+        /**
+         * @brief - Whether the pictures should be decoded on the decoding threads rather
+         *          than right away when the path is set.
+         */
+        bool m_async;
+
+        /**
+         * @brief - Whether the size hint of this widget should be deduced from the size
+         *          of the picture. This is the case when no area is specified upon
+         *          building this widget.
+         */
+        bool m_autoSize;
+
+        /**
+         * @brief - The pending decoding operation if any. When it is done, the image is
+         *          retrieved upon the next repaint and the texture created from it: the
+         *          placeholder displayed meanwhile is then discarded.
+         */
+        ImageDecoder::TaskShPtr m_decoding;
     };
 
     using PictureWidgetShPtr = std::shared_ptr<PictureWidget>;
@@ -11,12 +11,19 @@ namespace sdl {
     PictureWidget::setImagePath(const std::string& path) {
       Guard guard(m_propsLocker);
 
-      // Create a new image from the input path if needed.
-      if (path.empty()) {
-        m_img.reset();
+      // Any pending decoding is now obsolete and so is the current image.
+      cancelDecoding();
+      releaseImage();
+
+      // Create a new image from the input path if needed: it is shared with
+      // the other widgets displaying the same picture.
+      m_path = path;
+
+      if (!path.empty() && m_async) {
+        startDecoding(path);
       }
-      else {
-        m_img = std::make_shared<core::engine::Image>(path);
+      else if (!path.empty()) {
+        m_img = ImageCache::getInstance().acquire(path);
       }
 
       setPictureChanged();
@@ -37,23 +44,157 @@ namespace sdl {
 
     inline
     void
-    PictureWidget::loadPicture() const {
+    PictureWidget::loadPicture(const utils::Sizef& size) {
       // Clear existing image if any.
       clearPicture();
+      clearScaledPicture();
 
       // Load the image.
+      loadSourcePicture(size);
+    }
+
+    inline
+    void
+    PictureWidget::loadSourcePicture(const utils::Sizef& size) {
+      // The image is released once the scaled copy is built: retrieve it from
+      // the cache again, which usually still holds its texture as well. This
+      // may require to decode the picture again if it was evicted in the mean
+      // time: in asynchronous mode this is done by the decoder so that the
+      // rendering is not blocked and the placeholder is displayed instead.
+      if (m_img == nullptr && m_decoding == nullptr && !m_path.empty()) {
+        if (m_async) {
+          requestDecoding();
+        }
+        else {
+          m_img = ImageCache::getInstance().acquire(m_path);
+        }
+      }
+
       if (m_img != nullptr && m_img->hasData()) {
-        m_picture = getEngine().createTextureFromFile(m_img, core::engine::Palette::ColorRole::Base);
+        m_picture = ImageCache::getInstance().acquireTexture(getEngine(), m_img);
+        m_placeholder = false;
+      }
+      else if (m_decoding != nullptr) {
+        loadPlaceholder(size);
+      }
+
+      chargePicture();
+    }
+
+    inline
+    void
+    PictureWidget::loadPlaceholder(const utils::Sizef& size) const {
+      // Use the size hint if any: this is the size the picture is expected to
+      // have so the layout does not change when the picture becomes available.
+      utils::Sizef hint = getSizeHint();
+      if (!hint.valid()) {
+        hint = size;
+      }
+
+      if (!hint.valid()) {
+        return;
+      }
+
+      m_picture = getEngine().createTexture(hint, core::engine::Palette::ColorRole::Mid);
+      getEngine().fillTexture(m_picture, getPalette());
+
+      m_placeholder = true;
+    }
+
+    inline
+    void
+    PictureWidget::startDecoding(const std::string& path) {
+      cancelDecoding();
+
+      // Reading the dimensions from the header of the file is much cheaper
+      // than decoding the picture: this allows to lay out the widget with its
+      // final size while the placeholder is displayed.
+      if (m_autoSize) {
+        utils::Sizef size = ImageDecoder::probeSize(path);
+        if (size.valid()) {
+          setSizeHint(size);
+        }
+      }
+
+      requestDecoding();
+    }
+
+    inline
+    void
+    PictureWidget::requestDecoding() {
+      m_decoding = ImageDecoder::getInstance().decode(
+        m_path,
+        [this](const core::engine::ImageShPtr& /*img*/) {
+          notifyPictureDecoded();
+        }
+      );
+    }
+
+    inline
+    void
+    PictureWidget::cancelDecoding() {
+      if (m_decoding != nullptr) {
+        m_decoding->cancel();
+        m_decoding.reset();
+      }
+    }
+
+    inline
+    void
+    PictureWidget::updateSizeHintFrom(const core::engine::ImageShPtr& img) {
+      if (m_autoSize && img != nullptr && img->hasData()) {
+        setSizeHint(img->getSize());
       }
     }
 
     inline
     void
     PictureWidget::clearPicture() const {
-      if (m_picture.valid()) {
+      if (!m_picture.valid()) {
+        return;
+      }
+
+      // The placeholder belongs to this widget while the picture is shared
+      // through the image cache.
+      if (m_placeholder) {
         getEngine().destroyTexture(m_picture);
-        m_picture.invalidate();
       }
+      else {
+        ImageCache::getInstance().releaseTexture(m_picture);
+      }
+
+      m_picture.invalidate();
+      m_placeholder = false;
+    }
+
+    inline
+    void
+    PictureWidget::releaseImage() const {
+      if (m_img != nullptr) {
+        ImageCache::getInstance().release(m_img);
+        m_img.reset();
+      }
+    }
+
+    inline
+    void
+    PictureWidget::clearScaledPicture() const {
+      if (m_scaled.valid()) {
+        getEngine().destroyTexture(m_scaled);
+        m_scaled.invalidate();
+      }
+    }
+
+    inline
+    void
+    PictureWidget::chargePicture() const {
+      TextureBudget::getInstance().charge(
+        this,
+        TextureBudget::getTextureBytes(getEngine(), m_picture) + TextureBudget::getTextureBytes(getEngine(), m_scaled),
+        [this]() {
+          return evictPicture();
+        }
+      );
     }
 
     inline
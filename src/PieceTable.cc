@@ -0,0 +1,429 @@
+# include "PieceTable.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    PieceTable::PieceTable(const std::string& text):
+      utils::CoreObject(std::string("piece_table")),
+
+      m_original(),
+      m_added(),
+
+      m_originalBreaks(),
+      m_addedBreaks(),
+
+      m_root(nullptr),
+
+      m_rng()
+    {
+      setService(std::string("text"));
+
+      reset(text);
+    }
+
+    void
+    PieceTable::reset(const std::string& text) {
+      // Discard any existing piece along with the buffers.
+      m_root.reset();
+
+      m_original.clear();
+      m_originalBreaks.clear();
+      m_added.clear();
+      m_addedBreaks.clear();
+
+      // Register the input text as the original buffer and create a
+      // single piece spanning all of it.
+      appendToBuffer(Buffer::Original, text);
+
+      if (!m_original.empty()) {
+        m_root = makeNode(makePiece(Buffer::Original, 0u, m_original.size()));
+      }
+    }
+
+    void
+    PieceTable::insert(std::size_t offset,
+                       const std::string& text)
+    {
+      // Check consistency.
+      if (offset > size()) {
+        error(
+          std::string("Could not insert text at offset ") + std::to_string(offset),
+          std::string("Document only contains ") + std::to_string(size()) + " character(s)"
+        );
+      }
+
+      if (text.empty()) {
+        return;
+      }
+
+      // Append the text to the added buffer: the piece referencing it will
+      // be either a new piece or an extension of an existing one.
+      const std::size_t start = m_added.size();
+      const std::size_t breaksCount = m_addedBreaks.size();
+
+      appendToBuffer(Buffer::Added, text);
+
+      const std::size_t lines = m_addedBreaks.size() - breaksCount;
+
+      // When the user is typing, each character is inserted right after the
+      // previous one: in this case we can simply extend the piece which ends
+      // at the insertion point. This keeps the number of pieces low.
+      if (offset > 0u && extendPiece(m_root.get(), offset, start, text.size(), lines)) {
+        return;
+      }
+
+      // Otherwise split the tree at the insertion point and insert a new
+      // piece in between both parts.
+      NodePtr left, right;
+      split(std::move(m_root), offset, left, right);
+
+      NodePtr node = makeNode(makePiece(Buffer::Added, start, text.size()));
+
+      m_root = merge(merge(std::move(left), std::move(node)), std::move(right));
+    }
+
+    void
+    PieceTable::erase(std::size_t offset,
+                      std::size_t count)
+    {
+      // Clamp the range to the actual content of the document.
+      const std::size_t total = size();
+
+      if (offset >= total || count == 0u) {
+        return;
+      }
+
+      count = std::min(count, total - offset);
+
+      // Isolate the range to remove and drop it.
+      NodePtr left, middle, right;
+
+      split(std::move(m_root), offset, left, middle);
+      split(std::move(middle), count, middle, right);
+
+      m_root = merge(std::move(left), std::move(right));
+    }
+
+    char
+    PieceTable::at(std::size_t offset) const {
+      // Descend the tree until we reach the piece containing the offset.
+      const Node* node = m_root.get();
+
+      while (node != nullptr) {
+        const std::size_t leftSize = sizeOf(node->left);
+
+        if (offset < leftSize) {
+          node = node->left.get();
+        }
+        else if (offset < leftSize + node->piece.length) {
+          return getBuffer(node->piece.buffer)[node->piece.start + offset - leftSize];
+        }
+        else {
+          offset -= (leftSize + node->piece.length);
+          node = node->right.get();
+        }
+      }
+
+      error(
+        std::string("Could not retrieve character at offset ") + std::to_string(offset),
+        std::string("Document only contains ") + std::to_string(size()) + " character(s)"
+      );
+
+      // Make the compiler happy, even though `error` throws.
+      return '\0';
+    }
+
+    std::string
+    PieceTable::substr(std::size_t offset,
+                       std::size_t count) const
+    {
+      const std::size_t total = size();
+
+      if (offset >= total) {
+        return std::string();
+      }
+
+      count = std::min(count, total - offset);
+
+      std::string out;
+      out.reserve(count);
+
+      collect(m_root.get(), offset, count, out);
+
+      return out;
+    }
+
+    std::size_t
+    PieceTable::lineStart(std::size_t line) const {
+      // The first line always starts at the beginning of the document.
+      if (line == 0u) {
+        return 0u;
+      }
+
+      if (line >= lineCount()) {
+        error(
+          std::string("Could not retrieve start of line ") + std::to_string(line),
+          std::string("Document only contains ") + std::to_string(lineCount()) + " line(s)"
+        );
+      }
+
+      // The line `n` starts right after the `n`-th line break of the document.
+      // We descend the tree using the aggregated line counts to find the piece
+      // containing this line break and then use the buffer's line breaks to get
+      // its exact position.
+      const Node* node = m_root.get();
+      std::size_t base = 0u;
+      std::size_t remaining = line;
+
+      while (node != nullptr) {
+        const std::size_t leftLines = linesOf(node->left);
+
+        if (remaining <= leftLines) {
+          node = node->left.get();
+          continue;
+        }
+
+        const std::size_t leftSize = sizeOf(node->left);
+
+        if (remaining <= leftLines + node->piece.lines) {
+          const std::vector<std::size_t>& breaks = getBreaks(node->piece.buffer);
+          std::vector<std::size_t>::const_iterator first = std::lower_bound(breaks.cbegin(), breaks.cend(), node->piece.start);
+
+          const std::size_t pos = *(first + (remaining - leftLines - 1u));
+
+          return base + leftSize + (pos - node->piece.start) + 1u;
+        }
+
+        remaining -= (leftLines + node->piece.lines);
+        base += (leftSize + node->piece.length);
+        node = node->right.get();
+      }
+
+      // We should never reach this point as the line exists.
+      error(
+        std::string("Could not retrieve start of line ") + std::to_string(line),
+        std::string("Inconsistent line index")
+      );
+
+      return 0u;
+    }
+
+    std::size_t
+    PieceTable::lineLength(std::size_t line) const {
+      const std::size_t start = lineStart(line);
+
+      // The last line runs until the end of the document while any other line
+      // ends right before the line break preceding the next line.
+      if (line + 1u >= lineCount()) {
+        return size() - start;
+      }
+
+      return lineStart(line + 1u) - 1u - start;
+    }
+
+    std::size_t
+    PieceTable::lineFromOffset(std::size_t offset) const {
+      // Count the line breaks located strictly before the offset.
+      const Node* node = m_root.get();
+      std::size_t lines = 0u;
+
+      while (node != nullptr) {
+        const std::size_t leftSize = sizeOf(node->left);
+
+        if (offset < leftSize) {
+          node = node->left.get();
+        }
+        else if (offset < leftSize + node->piece.length) {
+          return lines + linesOf(node->left) + countBreaks(node->piece.buffer, node->piece.start, offset - leftSize);
+        }
+        else {
+          lines += (linesOf(node->left) + node->piece.lines);
+          offset -= (leftSize + node->piece.length);
+          node = node->right.get();
+        }
+      }
+
+      // The offset is at or beyond the end of the document.
+      return lines;
+    }
+
+    void
+    PieceTable::appendToBuffer(const Buffer& buffer,
+                               const std::string& text)
+    {
+      std::string& buf = (buffer == Buffer::Original ? m_original : m_added);
+      std::vector<std::size_t>& breaks = (buffer == Buffer::Original ? m_originalBreaks : m_addedBreaks);
+
+      // Register the position of the line breaks of the text: as we only ever
+      // append to the buffer the list stays sorted.
+      const std::size_t base = buf.size();
+
+      for (std::size_t id = 0u ; id < text.size() ; ++id) {
+        if (text[id] == '\n') {
+          breaks.push_back(base + id);
+        }
+      }
+
+      buf.append(text);
+    }
+
+    void
+    PieceTable::split(NodePtr node,
+                      std::size_t offset,
+                      NodePtr& left,
+                      NodePtr& right)
+    {
+      if (node == nullptr) {
+        left.reset();
+        right.reset();
+
+        return;
+      }
+
+      const std::size_t leftSize = sizeOf(node->left);
+
+      if (offset <= leftSize) {
+        // The split point lies in the left subtree.
+        NodePtr subLeft = std::move(node->left);
+        split(std::move(subLeft), offset, left, node->left);
+
+        refresh(*node);
+        right = std::move(node);
+
+        return;
+      }
+
+      if (offset >= leftSize + node->piece.length) {
+        // The split point lies in the right subtree.
+        NodePtr subRight = std::move(node->right);
+        split(std::move(subRight), offset - leftSize - node->piece.length, node->right, right);
+
+        refresh(*node);
+        left = std::move(node);
+
+        return;
+      }
+
+      // The split point lies inside the piece of this node: cut it in two. The
+      // head stays in this node, which keeps its left subtree, while the tail
+      // is moved to a new node prepended to the right subtree.
+      const std::size_t local = offset - leftSize;
+      const Piece piece = node->piece;
+
+      node->piece = makePiece(piece.buffer, piece.start, local);
+      NodePtr tail = makeNode(makePiece(piece.buffer, piece.start + local, piece.length - local));
+
+      NodePtr subRight = std::move(node->right);
+
+      refresh(*node);
+      left = std::move(node);
+
+      right = merge(std::move(tail), std::move(subRight));
+    }
+
+    PieceTable::NodePtr
+    PieceTable::merge(NodePtr left,
+                      NodePtr right)
+    {
+      if (left == nullptr) {
+        return right;
+      }
+      if (right == nullptr) {
+        return left;
+      }
+
+      // Keep the node with the highest priority as root.
+      if (left->priority > right->priority) {
+        NodePtr subRight = std::move(left->right);
+        left->right = merge(std::move(subRight), std::move(right));
+
+        refresh(*left);
+
+        return left;
+      }
+
+      NodePtr subLeft = std::move(right->left);
+      right->left = merge(std::move(left), std::move(subLeft));
+
+      refresh(*right);
+
+      return right;
+    }
+
+    bool
+    PieceTable::extendPiece(Node* node,
+                            std::size_t offset,
+                            std::size_t expected,
+                            std::size_t length,
+                            std::size_t lines)
+    {
+      if (node == nullptr) {
+        return false;
+      }
+
+      const std::size_t leftSize = sizeOf(node->left);
+      const std::size_t end = leftSize + node->piece.length;
+
+      bool extended = false;
+
+      if (offset <= leftSize) {
+        extended = extendPiece(node->left.get(), offset, expected, length, lines);
+      }
+      else if (offset > end) {
+        extended = extendPiece(node->right.get(), offset - end, expected, length, lines);
+      }
+      else if (offset == end &&
+               node->piece.buffer == Buffer::Added &&
+               node->piece.start + node->piece.length == expected)
+      {
+        // The piece ends at the insertion point and references the end of the
+        // added buffer: the inserted text directly follows it.
+        node->piece.length += length;
+        node->piece.lines += lines;
+
+        extended = true;
+      }
+
+      // Update the aggregated data along the path.
+      if (extended) {
+        refresh(*node);
+      }
+
+      return extended;
+    }
+
+    void
+    PieceTable::collect(const Node* node,
+                        std::size_t offset,
+                        std::size_t count,
+                        std::string& out) const
+    {
+      if (node == nullptr || count == 0u) {
+        return;
+      }
+
+      const std::size_t leftSize = sizeOf(node->left);
+
+      // Only visit the subtrees which intersect the range `[offset; offset + count[`.
+      if (offset < leftSize) {
+        const std::size_t fromLeft = std::min(count, leftSize - offset);
+        collect(node->left.get(), offset, fromLeft, out);
+      }
+
+      const std::size_t pieceEnd = leftSize + node->piece.length;
+
+      if (offset + count > leftSize && offset < pieceEnd) {
+        const std::size_t from = std::max(offset, leftSize);
+        const std::size_t to = std::min(offset + count, pieceEnd);
+
+        out.append(getBuffer(node->piece.buffer), node->piece.start + from - leftSize, to - from);
+      }
+
+      if (offset + count > pieceEnd) {
+        const std::size_t from = std::max(offset, pieceEnd);
+        collect(node->right.get(), from - pieceEnd, offset + count - from, out);
+      }
+    }
+
+  }
+}
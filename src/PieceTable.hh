@@ -0,0 +1,333 @@
+#ifndef    PIECE_TABLE_HH
+# define   PIECE_TABLE_HH
+
+# include <memory>
+# include <random>
+# include <string>
+# include <vector>
+# include <core_utils/CoreObject.hh>
+
+namespace sdl {
+  namespace graphic {
+
+    class PieceTable: public utils::CoreObject {
+      public:
+
+        /**
+         * @brief - Creates a new piece table with the specified initial content. The
+         *          text is kept as is in a read-only buffer and all the subsequent
+         *          modifications are appended into a second buffer: the document is
+         *          then described as a sequence of pieces referencing either buffer.
+         *          The pieces are organized in a balanced tree where each node also
+         *          keeps track of the number of characters and of line breaks in its
+         *          subtree: this allows edits, offset lookups and line lookups to be
+         *          performed in logarithmic time relatively to the number of pieces.
+         * @param text - the initial content of the document.
+         */
+        PieceTable(const std::string& text = std::string());
+
+        virtual ~PieceTable();
+
+        PieceTable(const PieceTable&) = delete;
+
+        PieceTable&
+        operator=(const PieceTable&) = delete;
+
+        /**
+         * @brief - Used to replace the whole content of this table with the input
+         *          text. Any existing piece is discarded along with both buffers.
+         * @param text - the new content of the document.
+         */
+        void
+        reset(const std::string& text);
+
+        /**
+         * @brief - Returns the number of characters in the document.
+         * @return - the number of characters of the document.
+         */
+        std::size_t
+        size() const noexcept;
+
+        /**
+         * @brief - Returns `true` if this document does not contain any character.
+         * @return - `true` if the document is empty.
+         */
+        bool
+        empty() const noexcept;
+
+        /**
+         * @brief - Returns the number of lines in the document. Note that an empty
+         *          document still counts one (empty) line, and that a trailing
+         *          line break opens a new empty line.
+         * @return - the number of lines of the document.
+         */
+        std::size_t
+        lineCount() const noexcept;
+
+        /**
+         * @brief - Inserts the input text at the specified offset in the document.
+         *          The text is appended to the modifications buffer and a piece is
+         *          inserted in the tree. When the insertion directly follows the
+         *          last inserted text (which is typically the case when the user is
+         *          typing) the existing piece is extended instead.
+         *          An error is raised if the offset is larger than the size of the
+         *          document.
+         * @param offset - the offset at which the text should be inserted.
+         * @param text - the text to insert.
+         */
+        void
+        insert(std::size_t offset,
+               const std::string& text);
+
+        /**
+         * @brief - Removes `count` characters starting at `offset` from the document.
+         *          The range is clamped to the size of the document. Note that the
+         *          buffers are left untouched: only the pieces are updated.
+         * @param offset - the offset of the first character to remove.
+         * @param count - the number of characters to remove.
+         */
+        void
+        erase(std::size_t offset,
+              std::size_t count);
+
+        /**
+         * @brief - Retrieves the character at the specified offset. An error is raised
+         *          if the offset does not correspond to a valid character.
+         * @param offset - the offset of the character to retrieve.
+         * @return - the character at the specified offset.
+         */
+        char
+        at(std::size_t offset) const;
+
+        /**
+         * @brief - Retrieves `count` characters starting at `offset`. The range is
+         *          clamped to the size of the document. Only the pieces spanned by
+         *          the range are visited.
+         * @param offset - the offset of the first character to retrieve.
+         * @param count - the maximum number of characters to retrieve.
+         * @return - the corresponding part of the document.
+         */
+        std::string
+        substr(std::size_t offset,
+               std::size_t count = std::string::npos) const;
+
+        /**
+         * @brief - Assembles the whole content of the document in a single string.
+         *          This operation is linear in the size of the document.
+         * @return - the content of the document.
+         */
+        std::string
+        toString() const;
+
+        /**
+         * @brief - Returns the offset of the first character of the specified line.
+         *          An error is raised if the line does not exist in the document.
+         * @param line - the index of the line.
+         * @return - the offset of the first character of the line.
+         */
+        std::size_t
+        lineStart(std::size_t line) const;
+
+        /**
+         * @brief - Returns the number of characters of the specified line, not
+         *          counting the terminating line break if any.
+         * @param line - the index of the line.
+         * @return - the length of the line.
+         */
+        std::size_t
+        lineLength(std::size_t line) const;
+
+        /**
+         * @brief - Retrieves the content of the specified line, without its line
+         *          break if any.
+         * @param line - the index of the line to retrieve.
+         * @return - the content of the line.
+         */
+        std::string
+        line(std::size_t line) const;
+
+        /**
+         * @brief - Returns the index of the line containing the character at the
+         *          specified offset. The offset equal to the size of the document
+         *          is considered valid and refers to the last line.
+         * @param offset - the offset of the character.
+         * @return - the index of the line containing this character.
+         */
+        std::size_t
+        lineFromOffset(std::size_t offset) const;
+
+      private:
+
+        /**
+         * @brief - Describes the buffers which can be referenced by a piece. The
+         *          original buffer is never modified while the added buffer is
+         *          only ever appended to.
+         */
+        enum class Buffer {
+          Original,
+          Added
+        };
+
+        /**
+         * @brief - A piece references a contiguous range of one of the buffers. We
+         *          also keep the number of line breaks in this range so that nodes
+         *          can maintain aggregated line counts.
+         */
+        struct Piece {
+          Buffer buffer;
+          std::size_t start;
+          std::size_t length;
+          std::size_t lines;
+        };
+
+        struct Node;
+        using NodePtr = std::unique_ptr<Node>;
+
+        /**
+         * @brief - A node of the tree. Nodes are ordered by their position in the
+         *          document (implicit key) and balanced through a random priority
+         *          (treap). The `size` and `lines` attributes describe the whole
+         *          subtree rooted at this node.
+         */
+        struct Node {
+          Piece piece;
+          unsigned priority;
+
+          std::size_t size;
+          std::size_t lines;
+
+          NodePtr left;
+          NodePtr right;
+        };
+
+        static
+        std::size_t
+        sizeOf(const NodePtr& node) noexcept;
+
+        static
+        std::size_t
+        linesOf(const NodePtr& node) noexcept;
+
+        static
+        void
+        refresh(Node& node) noexcept;
+
+        const std::string&
+        getBuffer(const Buffer& buffer) const noexcept;
+
+        const std::vector<std::size_t>&
+        getBreaks(const Buffer& buffer) const noexcept;
+
+        /**
+         * @brief - Counts the line breaks contained in the range `[start; start + length[`
+         *          of the specified buffer. This uses a binary search in the sorted
+         *          list of line breaks of the buffer.
+         * @param buffer - the buffer to consider.
+         * @param start - the start of the range.
+         * @param length - the length of the range.
+         * @return - the number of line breaks in the range.
+         */
+        std::size_t
+        countBreaks(const Buffer& buffer,
+                    std::size_t start,
+                    std::size_t length) const noexcept;
+
+        Piece
+        makePiece(const Buffer& buffer,
+                  std::size_t start,
+                  std::size_t length) const noexcept;
+
+        NodePtr
+        makeNode(const Piece& piece);
+
+        void
+        appendToBuffer(const Buffer& buffer,
+                       const std::string& text);
+
+        /**
+         * @brief - Splits the input tree so that the first `offset` characters end up
+         *          in `left` and the rest in `right`. A piece straddling the offset is
+         *          cut in two.
+         * @param node - the tree to split.
+         * @param offset - the number of characters to keep in the left tree.
+         * @param left - output tree receiving the first `offset` characters.
+         * @param right - output tree receiving the remaining characters.
+         */
+        void
+        split(NodePtr node,
+              std::size_t offset,
+              NodePtr& left,
+              NodePtr& right);
+
+        /**
+         * @brief - Concatenates both trees, assuming that all the characters of the
+         *          `left` tree come before the ones of the `right` tree.
+         * @param left - the first tree.
+         * @param right - the second tree.
+         * @return - the concatenated tree.
+         */
+        NodePtr
+        merge(NodePtr left,
+              NodePtr right);
+
+        /**
+         * @brief - Attempts to extend the piece ending exactly at `offset` by `length`
+         *          characters, which is possible only if it references the end of the
+         *          added buffer. Aggregated data is updated along the visited path.
+         * @param node - the tree to search.
+         * @param offset - the offset at which the text has been inserted.
+         * @param expected - the start of the text in the added buffer.
+         * @param length - the number of characters inserted.
+         * @param lines - the number of line breaks inserted.
+         * @return - `true` if the piece could be extended.
+         */
+        bool
+        extendPiece(Node* node,
+                    std::size_t offset,
+                    std::size_t expected,
+                    std::size_t length,
+                    std::size_t lines);
+
+        void
+        collect(const Node* node,
+                std::size_t offset,
+                std::size_t count,
+                std::string& out) const;
+
+      private:
+
+        /**
+         * @brief - The buffers holding the actual characters of the document. The
+         *          original buffer is assigned upon building the table (or when it
+         *          is reset) while the added buffer receives all the insertions.
+         */
+        std::string m_original;
+        std::string m_added;
+
+        /**
+         * @brief - Sorted positions of the line breaks in each buffer. As buffers are
+         *          never modified except by appending to the added buffer, these lists
+         *          stay sorted and allow to count line breaks in any range with two
+         *          binary searches.
+         */
+        std::vector<std::size_t> m_originalBreaks;
+        std::vector<std::size_t> m_addedBreaks;
+
+        /**
+         * @brief - The root of the pieces' tree.
+         */
+        NodePtr m_root;
+
+        /**
+         * @brief - Random engine used to generate the priorities of the nodes.
+         */
+        std::minstd_rand m_rng;
+    };
+
+    using PieceTableShPtr = std::shared_ptr<PieceTable>;
+  }
+}
+
+# include "PieceTable.hxx"
+
+#endif    /* PIECE_TABLE_HH */
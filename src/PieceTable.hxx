@@ -0,0 +1,114 @@
+#ifndef    PIECE_TABLE_HXX
+# define   PIECE_TABLE_HXX
+
+# include <algorithm>
+# include "PieceTable.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    inline
+    PieceTable::~PieceTable() {}
+
+    inline
+    std::size_t
+    PieceTable::size() const noexcept {
+      return sizeOf(m_root);
+    }
+
+    inline
+    bool
+    PieceTable::empty() const noexcept {
+      return size() == 0u;
+    }
+
+    inline
+    std::size_t
+    PieceTable::lineCount() const noexcept {
+      // Each line break opens a new line.
+      return linesOf(m_root) + 1u;
+    }
+
+    inline
+    std::string
+    PieceTable::toString() const {
+      return substr(0u, size());
+    }
+
+    inline
+    std::string
+    PieceTable::line(std::size_t line) const {
+      return substr(lineStart(line), lineLength(line));
+    }
+
+    inline
+    std::size_t
+    PieceTable::sizeOf(const NodePtr& node) noexcept {
+      return (node == nullptr ? 0u : node->size);
+    }
+
+    inline
+    std::size_t
+    PieceTable::linesOf(const NodePtr& node) noexcept {
+      return (node == nullptr ? 0u : node->lines);
+    }
+
+    inline
+    void
+    PieceTable::refresh(Node& node) noexcept {
+      node.size = sizeOf(node.left) + node.piece.length + sizeOf(node.right);
+      node.lines = linesOf(node.left) + node.piece.lines + linesOf(node.right);
+    }
+
+    inline
+    const std::string&
+    PieceTable::getBuffer(const Buffer& buffer) const noexcept {
+      return (buffer == Buffer::Original ? m_original : m_added);
+    }
+
+    inline
+    const std::vector<std::size_t>&
+    PieceTable::getBreaks(const Buffer& buffer) const noexcept {
+      return (buffer == Buffer::Original ? m_originalBreaks : m_addedBreaks);
+    }
+
+    inline
+    std::size_t
+    PieceTable::countBreaks(const Buffer& buffer,
+                            std::size_t start,
+                            std::size_t length) const noexcept
+    {
+      const std::vector<std::size_t>& breaks = getBreaks(buffer);
+
+      std::vector<std::size_t>::const_iterator first = std::lower_bound(breaks.cbegin(), breaks.cend(), start);
+      std::vector<std::size_t>::const_iterator last = std::lower_bound(first, breaks.cend(), start + length);
+
+      return static_cast<std::size_t>(last - first);
+    }
+
+    inline
+    PieceTable::Piece
+    PieceTable::makePiece(const Buffer& buffer,
+                          std::size_t start,
+                          std::size_t length) const noexcept
+    {
+      return Piece{buffer, start, length, countBreaks(buffer, start, length)};
+    }
+
+    inline
+    PieceTable::NodePtr
+    PieceTable::makeNode(const Piece& piece) {
+      NodePtr node = std::make_unique<Node>();
+
+      node->piece = piece;
+      node->priority = static_cast<unsigned>(m_rng());
+
+      refresh(*node);
+
+      return node;
+    }
+
+  }
+}
+
+#endif    /* PIECE_TABLE_HXX */
@@ -1,7 +1,6 @@
 
 # include "ProgressBar.hh"
 # include "LinearLayout.hh"
-# include "GradientWidget.hh"
 
 namespace sdl {
   namespace graphic {
@@ -37,11 +36,10 @@ namespace sdl {
         changed = true;
       }
 
-      // Request a repaint and an update of the masking element if the internal
-      // completion value has changed.
+      // Forward the completion to the gradient widget: it only displays the
+      // completed part of the gradient and coalesces the repaint requests.
       if (changed) {
-        updateMaskSizeFromCompletion();
-        requestRepaint();
+        getGradientWidget()->setFraction(m_completion);
       }
     }
 
@@ -50,10 +48,8 @@ namespace sdl {
       // No focus for this elements.
       setFocusPolicy(core::FocusPolicy());
 
-      // Create a linear layout which will contain both the gradient
-      // widget representing the progression of the loading and the
-      // mask widget which will be used to `fake` some not-loaded
-      // part of the gradient.
+      // Create a linear layout which will contain the gradient widget
+      // representing the progression of the loading.
       LinearLayoutShPtr layout = std::make_shared<LinearLayout>(
         "layout_for_progress_bar",
         this,
@@ -70,19 +66,16 @@ namespace sdl {
 
       setLayout(layout);
 
-      // Create the gradient and its corresponding widget to represent
-      // the progress bar.
-      core::engine::GradientShPtr gradient = std::make_shared<core::engine::Gradient>(
-        "gradient_for_progress_bar",
-        core::engine::gradient::Mode::Linear,
-        core::engine::Color::NamedColor::Red,
-        core::engine::Color::NamedColor::Green
-      );
-
+      // Create the widget to represent the progress bar: the gradient is
+      // shared by all progress bars so that they also share its texture.
+      // Only the completed part of the gradient is displayed, the rest of
+      // the widget displaying its background.
       GradientWidget* gradWidget = new GradientWidget(
-        "grad_for_progress_bar",
-        gradient,
-        this
+        getGradientName(),
+        getDefaultGradient(),
+        this,
+        utils::Sizef(),
+        core::engine::Color::NamedColor::White
       );
       if (gradWidget == nullptr) {
         error(
@@ -91,79 +84,10 @@ namespace sdl {
         );
       }
 
-      // Create the mask used to hide part of the gradient in case the
-      // completion is not set to maximum for the progress bar.
-      core::SdlWidget* mask = new core::SdlWidget(
-        getMaskName(),
-        utils::Sizef(),
-        this,
-        core::engine::Color::NamedColor::White
-      );
-      if (mask == nullptr) {
-        error(
-          std::string("Could not create progress bar"),
-          std::string("Cannot build progress mask")
-        );
-      }
-      mask->setZOrder(1);
-      mask->setFocusPolicy(core::FocusPolicy());
-      mask->allowLog(false);
+      // Nothing is completed yet.
+      gradWidget->setFraction(m_completion);
 
-      // Add only the gradient widget to the layout, the masking element
-      // is handled manually as we want some sort of overlapping between
-      // both elements.
       layout->addItem(gradWidget);
-
-      // Theoretically we should update the mask size to ensure the empty
-      // initial completion. BUT as we might not have a queue yet the event
-      // might not be able to be posted anyway.
-      // Anyway as we should get a resize event quite early in the process
-      // and as we already set the `m_completion·` to be `0` it should be
-      // automatically enforced when the resize event is received. So we
-      // will consider the job done here.
-    }
-
-    void
-    ProgressBar::updateMaskSizeFromCompletion() {
-      // Given that the gradient widget is given all the available space on this
-      // widget we can assume that we are able to know its size through querying
-      // this widget's size.
-      // Now the goal is to resize the masking element so that it's size hides a
-      // part of the gradient widget consistent with the current completion value.
-      // By resizing it upon each progression notification we are able to fake
-      // a feeling of progress.
-      utils::Sizef window = LayoutItem::getRenderingArea().toSize();
-
-      // Compute the masked part of the widget: this corresponds to the part that
-      // it is not completed yet. We consider that the left part of the progress
-      // bar is the part that is completed.
-      float masked = std::min(1.0f, std::max(0.0f, 1.0f - m_completion));
-
-      utils::Sizef dims(masked * window.w(), window.h());
-      utils::Vector2f center(window.w() / 2.0f - dims.w() / 2.0f, 0.0f);
-
-      // Create the resize event for the mask. Note that in case the mask is
-      // set with a null width (typically when the percentage reaches `100%`
-      // we will instead hide the mask.
-      core::SdlWidget* mask = getMask();
-
-      if (dims.w() < 1.0f) {
-        mask->setVisible(false);
-      }
-      else {
-        // Make the mask visible if needed.
-        if (!mask->isVisible()) {
-          mask->setVisible(true);
-        }
-
-        postEvent(
-          std::make_shared<core::engine::ResizeEvent>(
-            utils::Boxf(center, dims),
-            mask->getRenderingArea(),
-            mask
-          )
-        );
-      }
     }
 
   }
@@ -5,6 +5,8 @@
 # include <memory>
 # include <string>
 # include <sdl_core/SdlWidget.hh>
+# include <sdl_engine/Gradient.hh>
+# include "GradientWidget.hh"
 
 namespace sdl {
   namespace graphic {
@@ -42,16 +44,6 @@ namespace sdl {
         void
         setCompletion(float value);
 
-      protected:
-
-        /**
-         * @brief - Reimplementation of the base class method to provide update of the
-         *          size of the mask as it is not managed by the layout itself.
-         * @param window - the available size to perform the update.
-         */
-        void
-        updatePrivate(const utils::Boxf& window) override;
-
       private:
 
         /**
@@ -66,36 +58,37 @@ namespace sdl {
         getFrameDimensions() noexcept;
 
         /**
-         * @brief - Used to retrieve the name to use to describe the masking element.
-         * @return - a name to use to describe the masking element.
+         * @brief - Used to retrieve the name to use to describe the gradient element.
+         * @return - a name to use to describe the gradient element.
          */
         static
         const char*
-        getMaskName() noexcept;
+        getGradientName() noexcept;
 
         /**
-         * @brief - Used to build the layout of this widget.
+         * @brief - Used to retrieve the gradient displayed by progress bars. It is
+         *          shared by all the progress bars so that they can share the same
+         *          texture to represent it.
+         * @return - the gradient used by progress bars.
          */
-        void
-        build();
+        static
+        core::engine::GradientShPtr
+        getDefaultGradient();
 
         /**
-         * @brief - Compute and assign a valid size to the mask element used by this
-         *          progress bar to simulate some progress. The current size of the
-         *          widget is used.
-         *          Assumes that the locker is already acquired.
+         * @brief - Used to build the layout of this widget.
          */
         void
-        updateMaskSizeFromCompletion();
+        build();
 
         /**
-         * @brief - Used to retrieve the mask widget used to fake the loading progress.
+         * @brief - Used to retrieve the gradient widget displaying the progression.
          *          The return value is always valid if the method returns (i.e. an error
-         *          is raised if the mask cannot be retrieved).
-         * @return - the masking element.
+         *          is raised if the gradient widget cannot be retrieved).
+         * @return - the gradient widget.
          */
-        core::SdlWidget*
-        getMask();
+        GradientWidget*
+        getGradientWidget();
 
       private:
 
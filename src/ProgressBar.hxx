@@ -17,24 +17,27 @@ namespace sdl {
 
     inline
     const char*
-    ProgressBar::getMaskName() noexcept {
-      return "progress_mask";
+    ProgressBar::getGradientName() noexcept {
+      return "grad_for_progress_bar";
     }
 
     inline
-    void
-    ProgressBar::updatePrivate(const utils::Boxf& window) {
-      // Call the base class method.
-      core::SdlWidget::updatePrivate(window);
-
-      // Update the size of the mask to be consistent with the current state.
-      updateMaskSizeFromCompletion();
+    core::engine::GradientShPtr
+    ProgressBar::getDefaultGradient() {
+      static core::engine::GradientShPtr gradient = std::make_shared<core::engine::Gradient>(
+        "gradient_for_progress_bar",
+        core::engine::gradient::Mode::Linear,
+        core::engine::Color::NamedColor::Red,
+        core::engine::Color::NamedColor::Green
+      );
+
+      return gradient;
     }
 
     inline
-    core::SdlWidget*
-    ProgressBar::getMask() {
-      return getChildAs<core::SdlWidget>(getMaskName());
+    GradientWidget*
+    ProgressBar::getGradientWidget() {
+      return getChildAs<GradientWidget>(getGradientName());
     }
 
   }
@@ -22,9 +22,14 @@ namespace sdl {
       m_value(0),
 
       m_elementsChanged(true),
-      m_upArrow({utils::Uuid(), utils::Boxf(), getArrowColorRole(false), true}),
-      m_slider({utils::Uuid(), utils::Boxf(), getSliderColorRole(false), true}),
-      m_downArrow({utils::Uuid(), utils::Boxf(), getArrowColorRole(false), true}),
+      m_upArrow({utils::Uuid(), utils::Uuid(), utils::Boxf(), false}),
+      m_slider({utils::Uuid(), utils::Uuid(), utils::Boxf(), false}),
+      m_downArrow({utils::Uuid(), utils::Uuid(), utils::Boxf(), false}),
+
+      m_kinetic(false),
+      m_dragPending(false),
+      m_dragPos(),
+      m_frameNotifier(),
 
       onValueChanged()
     {
@@ -88,22 +93,33 @@ namespace sdl {
       // Acquire the lock on the data contained in this widget.
       Guard guard(m_propsLocker);
 
+      // A new frame is being drawn: the last drag position received since the
+      // previous one can be applied. This is not done while drawing as it may
+      // notify listeners: an event is posted instead.
+      m_kinetic.releaseFrame();
+
+      if (m_dragPending) {
+        std::shared_ptr<core::engine::PaintEvent> pe = m_frameNotifier.request(this);
+
+        if (pe != nullptr) {
+          postEvent(pe);
+        }
+      }
+
       // Load the elements: this should happen only if the geometry of the scroll bar
       // has changed since last draw operation. This can either mean that the way the
       // elements has changed or that one of the rendering properties to use to draw
       // the elements has been updated.
-      bool forceFill = m_elementsChanged;
-
+      // The textures are filled with the relevant color right away: the highlight of
+      // the elements only changes which texture is drawn.
       if (elementsChanged()) {
         loadElements();
+        fillElements();
 
         // The elements have been updated.
         m_elementsChanged = false;
       }
 
-      // Fill up the textures with the relevant color.
-      fillElements(forceFill);
-
       // The arrows and slider are arranged in a linear fashion where the top arrow is
       // positionned first, then comes the slider and finally the bottom arrow. In the
       // case of an horizontal layout this is still the case but the position are set
@@ -128,7 +144,7 @@ namespace sdl {
         utils::Boxf srcRectEngine = convertToEngineFormat(srcRect, arrow);
 
         // Draw the texture.
-        getEngine().drawTexture(m_upArrow.id, &srcRectEngine, &uuid, &dstRectEngine);
+        getEngine().drawTexture(getTexture(m_upArrow), &srcRectEngine, &uuid, &dstRectEngine);
       }
 
       utils::Boxf dstRectForSlider = m_slider.box.intersect(area);
@@ -140,7 +156,7 @@ namespace sdl {
         utils::Boxf srcRectEngine = convertToEngineFormat(srcRect, slider);
 
         // Draw the texture.
-        getEngine().drawTexture(m_slider.id, &srcRectEngine, &uuid, &dstRectEngine);
+        getEngine().drawTexture(getTexture(m_slider), &srcRectEngine, &uuid, &dstRectEngine);
       }
 
       utils::Boxf dstRectForDownArrow = m_downArrow.box.intersect(area);
@@ -152,7 +168,7 @@ namespace sdl {
         utils::Boxf srcRectEngine = convertToEngineFormat(srcRect, arrow);
 
         // Draw the texture.
-        getEngine().drawTexture(m_downArrow.id, &srcRectEngine, &uuid, &dstRectEngine);
+        getEngine().drawTexture(getTexture(m_downArrow), &srcRectEngine, &uuid, &dstRectEngine);
       }
     }
 
@@ -170,28 +186,11 @@ namespace sdl {
       // to have the area where nothing is displayed (i.e the area of the scroll bar where
       // the slider is not) to be updated when the focus is received.
       if (!state.hasFocus()) {
-        core::engine::Palette::ColorRole arrowRole = getArrowColorRole(false);
-        core::engine::Palette::ColorRole sliderRole = getSliderColorRole(false);
-
         bool update = false;
 
-        if (m_upArrow.role != arrowRole) {
-          m_upArrow.role = arrowRole;
-          m_upArrow.roleUpdated = true;
-          update = true;
-        }
-
-        if (m_slider.role != sliderRole) {
-          m_slider.role = sliderRole;
-          m_slider.roleUpdated = true;
-          update = true;
-        }
-
-        if (m_downArrow.role != arrowRole) {
-          m_downArrow.role = arrowRole;
-          m_downArrow.roleUpdated = true;
-          update = true;
-        }
+        update = setHighlighted(m_upArrow, false) || update;
+        update = setHighlighted(m_slider, false) || update;
+        update = setHighlighted(m_downArrow, false) || update;
 
         if (update) {
           requestRepaint();
@@ -401,19 +400,13 @@ namespace sdl {
       // Acquire the lock on the data contained in this widget.
       Guard guard(m_propsLocker);
 
-      // Convert in terms of `slider's reference frame`.
-      int desired = getValueFromSliderPos(local);
-
-      // Assign the value and request a repaint if needed.
-      bool update = performAction(Action::Move, desired);
-
-      // Perform the update of the elements which will produce another
-      // update status.
-      bool updateFromElems = updateElementsRolesFromMousePos(local);
+      // High rate mice produce several drag events per frame: only the last
+      // position matters so we keep it and move the slider at most once per
+      // frame.
+      m_dragPos = local;
+      m_dragPending = true;
 
-      if (update || updateFromElems) {
-        requestRepaint();
-      }
+      applyDrag();
 
       // Use the base handler to provide a return value.
       return core::SdlWidget::mouseDragEvent(e);
@@ -701,31 +694,67 @@ namespace sdl {
       // Check whether the mouse is hovering over any of the elements representing
       // the scroll bar: if this is the case we should request a repaint with the
       // new info.
+      // Note that this does not modify the textures: the highlighted version of
+      // each element is already available.
       bool update = false;
 
-      core::engine::Palette::ColorRole r = getArrowColorRole(m_upArrow.box.contains(local));
-      if (m_upArrow.role != r) {
-        m_upArrow.role = r;
-        m_upArrow.roleUpdated = true;
-        update = true;
+      update = setHighlighted(m_upArrow, m_upArrow.box.contains(local)) || update;
+      update = setHighlighted(m_slider, m_slider.box.contains(local)) || update;
+      update = setHighlighted(m_downArrow, m_downArrow.box.contains(local)) || update;
+
+      // Return whether any role were updated.
+      return update;
+    }
+
+    bool
+    ScrollBar::repaintEvent(const core::engine::PaintEvent& e) {
+      {
+        // Acquire the lock on the data contained in this widget.
+        Guard guard(m_propsLocker);
+
+        // Apply the drag position queued during the last frame.
+        const DeferredNotifier::Reception frame = m_frameNotifier.receive(e, this);
+
+        if (frame != DeferredNotifier::Reception::None) {
+          applyDrag();
+        }
+
+        if (frame == DeferredNotifier::Reception::Alone) {
+          return true;
+        }
       }
 
-      r = getSliderColorRole(m_slider.box.contains(local));
-      if (m_slider.role != r) {
-        m_slider.role = r;
-        m_slider.roleUpdated = true;
-        update = true;
+      // Use the base handler.
+      return core::SdlWidget::repaintEvent(e);
+    }
+
+    void
+    ScrollBar::applyDrag() {
+      // Assume that the locker is already acquired.
+      if (!m_dragPending || !m_kinetic.acquireFrame()) {
+        return;
       }
 
-      r = getArrowColorRole(m_downArrow.box.contains(local));
-      if (m_downArrow.role != r) {
-        m_downArrow.role = r;
-        m_downArrow.roleUpdated = true;
-        update = true;
+      m_dragPending = false;
+
+      // Convert in terms of `slider's reference frame`.
+      int desired = getValueFromSliderPos(m_dragPos);
+
+      // Assign the value and request a repaint if needed.
+      bool update = performAction(Action::Move, desired);
+
+      // Perform the update of the elements which will produce another
+      // update status.
+      bool updateFromElems = updateElementsRolesFromMousePos(m_dragPos);
+
+      if (update || updateFromElems) {
+        requestRepaint();
+        return;
       }
 
-      // Return whether any role were updated.
-      return update;
+      // Nothing changed so no frame will be drawn: the next drag position can
+      // be applied right away.
+      m_kinetic.releaseFrame();
     }
 
     void
@@ -737,24 +766,27 @@ namespace sdl {
 
       // Retrieve the dimensions of this scroll bar so that we can determine
       // the size of each element.
-      m_upArrow.id = getEngine().createTexture(getArrowSize(total), m_upArrow.role);
-      if (!m_upArrow.id.valid()) {
+      m_upArrow.id = getEngine().createTexture(getArrowSize(total), getArrowColorRole(false));
+      m_upArrow.highlight = getEngine().createTexture(getArrowSize(total), getArrowColorRole(true));
+      if (!m_upArrow.id.valid() || !m_upArrow.highlight.valid()) {
         error(
           std::string("Could not create up arrow to represent scroll bar"),
           std::string("Engine returned invalid uuid")
         );
       }
 
-      m_slider.id = getEngine().createTexture(getSliderSize(total), m_slider.role);
-      if (!m_slider.id.valid()) {
+      m_slider.id = getEngine().createTexture(getSliderSize(total), getSliderColorRole(false));
+      m_slider.highlight = getEngine().createTexture(getSliderSize(total), getSliderColorRole(true));
+      if (!m_slider.id.valid() || !m_slider.highlight.valid()) {
         error(
           std::string("Could not create slider to represent scroll bar"),
           std::string("Engine returned invalid uuid")
         );
       }
 
-      m_downArrow.id = getEngine().createTexture(getArrowSize(total), m_downArrow.role);
-      if (!m_downArrow.id.valid()) {
+      m_downArrow.id = getEngine().createTexture(getArrowSize(total), getArrowColorRole(false));
+      m_downArrow.highlight = getEngine().createTexture(getArrowSize(total), getArrowColorRole(true));
+      if (!m_downArrow.id.valid() || !m_downArrow.highlight.valid()) {
         error(
           std::string("Could not create down arrow to represent scroll bar"),
           std::string("Engine returned invalid uuid")
@@ -787,25 +819,16 @@ namespace sdl {
     }
 
     void
-    ScrollBar::fillElements(bool force) {
-      // Fill the textures with the relevant color if needed.
-      if (m_upArrow.roleUpdated || force) {
-        getEngine().setTextureRole(m_upArrow.id, m_upArrow.role);
-        getEngine().fillTexture(m_upArrow.id, getPalette());
-        m_upArrow.roleUpdated = false;
-      }
+    ScrollBar::fillElements() {
+      // Fill both versions of each element with their respective color.
+      getEngine().fillTexture(m_upArrow.id, getPalette());
+      getEngine().fillTexture(m_upArrow.highlight, getPalette());
 
-      if (m_slider.roleUpdated || force) {
-        getEngine().setTextureRole(m_slider.id, m_slider.role);
-        getEngine().fillTexture(m_slider.id, getPalette());
-        m_slider.roleUpdated = false;
-      }
+      getEngine().fillTexture(m_slider.id, getPalette());
+      getEngine().fillTexture(m_slider.highlight, getPalette());
 
-      if (m_downArrow.roleUpdated || force) {
-        getEngine().setTextureRole(m_downArrow.id, m_downArrow.role);
-        getEngine().fillTexture(m_downArrow.id, getPalette());
-        m_downArrow.roleUpdated = false;
-      }
+      getEngine().fillTexture(m_downArrow.id, getPalette());
+      getEngine().fillTexture(m_downArrow.highlight, getPalette());
     }
 
   }
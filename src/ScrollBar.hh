@@ -7,6 +7,8 @@
 # include <core_utils/Signal.hh>
 # include "LinearLayout.hh"
 # include "ScrollOrientation.hh"
+# include "KineticScroller.hh"
+# include "DeferredNotifier.hh"
 
 namespace sdl {
   namespace graphic {
@@ -138,6 +140,17 @@ namespace sdl {
         drawContentPrivate(const utils::Uuid& uuid,
                            const utils::Boxf& area) override;
 
+        /**
+         * @brief - Reimplementation of the base `core::SdlWidget` method in order to
+         *          apply the drag position queued while the previous frame was being
+         *          drawn. This happens upon receiving the event posted when drawing
+         *          the frame: this event does not trigger a repaint on its own.
+         * @param e - the paint event to process.
+         * @return - `true` if the event was recognized and `false` otherwise.
+         */
+        bool
+        repaintEvent(const core::engine::PaintEvent& e) override;
+
         /**
          * @brief - Reimplementation of the base `core::SdlWidget` method in order to detect
          *          when the focus is lost. This allows to reset the highlight of any of the
@@ -441,6 +454,16 @@ namespace sdl {
         bool
         updateElementsRolesFromMousePos(const utils::Vector2f& local);
 
+        /**
+         * @brief - Moves the slider to the last position registered by a drag event,
+         *          unless the slider was already moved since the last frame in which
+         *          case the motion is applied in the next frame.
+         *          Note that this method assumes the that the locker protecting from
+         *          concurrency is already locked.
+         */
+        void
+        applyDrag();
+
         /**
          * @brief - Used to create the textures allowing to represent the scroll bar
          *          components, namely the two arrows allowing to scroll and the slider
@@ -457,16 +480,14 @@ namespace sdl {
 
         /**
          * @brief - Used to perform a fill operation on the textures representing the element
-         *          for this scroll bar. The fill operation allows to initialize the data of
-         *          the texture and potentially update it based on a color role change.
-         *          The fill operation is usually triggered by the fact that the internal data
-         *          for an element request it but the user can force it using the input bool
-         *          if needed.
-         * @param force - `true` if the elements should be filled no matter what and `false`
-         *                if we should use the internal data to handle each case.
+         *          for this scroll bar. Each element has a texture for its regular state and
+         *          another one for its highlighted state: both are filled once when they are
+         *          created so that highlighting an element only means drawing the other one.
+         *          Note that this method assumes that the locker has already been acquired.
          */
         void
-        fillElements(bool force = false);
+        fillElements();
+
 
         /**
          * @brief - Destroys the textures describing the elements representing the scroll
@@ -531,12 +552,40 @@ namespace sdl {
         struct ElementDesc {
           utils::Uuid id;                        //<! - The identifier of the texture to use to
                                                  //     represent this element.
+          utils::Uuid highlight;                 //<! - The identifier of the texture to use to
+                                                 //     represent this element when highlighted.
           utils::Boxf box;                       //<! - The box to use to position this element.
-          core::engine::Palette::ColorRole role; //<! - The color role attached to this element.
-          bool roleUpdated;                      //<! - `true` when the role has been changed and
-                                                 //     requires an update of the texture.
+          bool highlighted;                      //<! - `true` when the element is highlighted.
         };
 
+        /**
+         * @brief - Used to update the highlight status of the input element.
+         * @param element - the element to update.
+         * @param highlighted - `true` if the element should be highlighted.
+         * @return - `true` if the status of the element was modified.
+         */
+        static
+        bool
+        setHighlighted(ElementDesc& element,
+                       bool highlighted) noexcept;
+
+        /**
+         * @brief - Retrieves the texture to draw to represent the input element given its
+         *          highlight status.
+         * @param element - the element to draw.
+         * @return - the texture representing the element.
+         */
+        const utils::Uuid&
+        getTexture(const ElementDesc& element) const noexcept;
+
+        /**
+         * @brief - Destroys both textures of the input element.
+         *          Note that this method assumes that the locker has already been acquired.
+         * @param element - the element to clear.
+         */
+        void
+        clearElement(ElementDesc& element);
+
         /**
          * @brief - A mutex allowing to protect this object from concurrent accesses.
          *          Should be used to modify or read the values of most of the internal
@@ -620,6 +669,19 @@ namespace sdl {
          */
         ElementDesc m_downArrow;
 
+        /**
+         * @brief - Paces the drag operations so that the slider is moved at most once per
+         *          frame. As the slider follows the absolute position of the mouse, only
+         *          the last position received since the last frame is kept in `m_dragPos`
+         *          and the momentum is not used. When a frame is drawn while a position
+         *          is pending the `m_frameNotifier` is used so that it gets applied from
+         *          the events loop.
+         */
+        KineticScroller m_kinetic;
+        bool m_dragPending;
+        utils::Vector2f m_dragPos;
+        DeferredNotifier m_frameNotifier;
+
       public:
 
         /**
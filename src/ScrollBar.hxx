@@ -240,25 +240,48 @@ namespace sdl {
     }
 
     inline
-    void
-    ScrollBar::clearElements() {
-      // Clear any assigned texture.
-      if (m_upArrow.id.valid()) {
-        getEngine().destroyTexture(m_upArrow.id);
-        m_upArrow.id.invalidate();
+    bool
+    ScrollBar::setHighlighted(ElementDesc& element,
+                              bool highlighted) noexcept
+    {
+      if (element.highlighted == highlighted) {
+        return false;
       }
 
-      if (m_downArrow.id.valid()) {
-        getEngine().destroyTexture(m_downArrow.id);
-        m_downArrow.id.invalidate();
+      element.highlighted = highlighted;
+
+      return true;
+    }
+
+    inline
+    const utils::Uuid&
+    ScrollBar::getTexture(const ElementDesc& element) const noexcept {
+      return (element.highlighted ? element.highlight : element.id);
+    }
+
+    inline
+    void
+    ScrollBar::clearElement(ElementDesc& element) {
+      if (element.id.valid()) {
+        getEngine().destroyTexture(element.id);
+        element.id.invalidate();
       }
 
-      if (m_slider.id.valid()) {
-        getEngine().destroyTexture(m_slider.id);
-        m_slider.id.invalidate();
+      if (element.highlight.valid()) {
+        getEngine().destroyTexture(element.highlight);
+        element.highlight.invalidate();
       }
     }
 
+    inline
+    void
+    ScrollBar::clearElements() {
+      // Clear any assigned texture.
+      clearElement(m_upArrow);
+      clearElement(m_downArrow);
+      clearElement(m_slider);
+    }
+
     inline
     bool
     ScrollBar::elementsChanged() const noexcept {
@@ -10,13 +10,26 @@ namespace sdl {
       core::SdlWidget(name, area, parent),
 
       m_supportName(),
-      m_coordsToFollow(nullptr)
+      m_coordsToFollow(nullptr),
+
+      m_blitScrolling(true),
+      m_blitPending(false),
+      m_blitOrigin(),
+      m_scrollDelta(),
+      m_backing(),
+
+      m_kinetic(),
+      m_frameNotifier()
     {
       // We don't want the widget to be sensitive to hover over events.
       setFocusPolicy(core::FocusPolicy());
     }
 
-    ScrollableWidget::~ScrollableWidget() {}
+    ScrollableWidget::~ScrollableWidget() {
+      Guard guard(m_propsLocker);
+
+      clearBacking();
+    }
 
     void
     ScrollableWidget::setSupport(core::SdlWidget* widget) {
@@ -147,7 +160,7 @@ namespace sdl {
 
       // Handle scrolling.
       if (handleContentScrolling(start, localEnd, motion, false)) {
-        requestRepaint();
+        requestScrollRepaint();
       }
     }
 
@@ -166,6 +179,10 @@ namespace sdl {
 
       utils::Boxf newSize = onResize(window, support);
 
+      // The whole widget is repainted after a resize so there's no point in
+      // shifting the previous content.
+      m_blitPending = false;
+
       // Assign the new size if the support widget is valid.
       if (support != nullptr) {
         postEvent(
@@ -255,6 +272,20 @@ namespace sdl {
         return false;
       }
 
+      // Keep track of the motion of the support widget since the last repaint
+      // so that the content already displayed can be shifted rather than being
+      // repainted. The origin is the position displayed by the canvas: as the
+      // resize events are processed asynchronously we can't rely on summing the
+      // individual motions.
+      if (m_blitScrolling) {
+        if (!m_blitPending) {
+          m_blitOrigin = support->getRenderingArea().getCenter();
+          m_blitPending = true;
+        }
+
+        m_scrollDelta = area.getCenter() - m_blitOrigin;
+      }
+
       // Post the resize event for the support widget if needed.
       postEvent(
         std::make_shared<core::engine::ResizeEvent>(
@@ -378,8 +409,9 @@ namespace sdl {
       // Protect from concurrent accesses.
       Guard guard(m_propsLocker);
 
-      // Assign the new coordinates.
+      // Assign the new coordinates and stop any motion in progress.
       createOrGetCoordsToFollow(local, true);
+      m_kinetic.press();
 
       return core::SdlWidget::mouseButtonPressEvent(e);
     }
@@ -410,17 +442,15 @@ namespace sdl {
       // Protect from concurrent accesses.
       Guard guard(m_propsLocker);
 
-      utils::Vector2f start = createOrGetCoordsToFollow(dragStart);
-      utils::Vector2f localEnd = mapFromGlobal(e.getMousePosition());
+      createOrGetCoordsToFollow(dragStart);
 
-      // Call the dedicated handler to do the necessary work in order to
-      // handle scrolling: if the return value indicates that some changes
-      // where made to this widget we should issue a repaint.
+      // High rate mice produce several drag events per frame: rather than
+      // scrolling the content for each of them, the motion is accumulated
+      // and applied at most once per frame.
       utils::Vector2f move(e.getMove().x(), e.getMove().y());
 
-      if (handleContentScrolling(start, localEnd, move)) {
-        requestRepaint();
-      }
+      m_kinetic.accumulate(move);
+      applyKineticScrolling();
 
       // Use the base handler to provide the return value.
       return core::SdlWidget::mouseDragEvent(e);
@@ -437,6 +467,17 @@ namespace sdl {
       // Protect from concurrent accesses.
       Guard guard(m_propsLocker);
 
+      // A frame was drawn since the motion was queued: apply it now.
+      const DeferredNotifier::Reception frame = m_frameNotifier.receive(e, this);
+
+      if (frame != DeferredNotifier::Reception::None) {
+        applyKineticScrolling();
+      }
+
+      if (frame == DeferredNotifier::Reception::Alone) {
+        return true;
+      }
+
       // First check whether there is a support widget: if this is not the
       // case we are sure that we won't receive such repaint events.
       if (!hasSupportWidget()) {
@@ -451,11 +492,23 @@ namespace sdl {
       }
 
       // We need to make sure that any area provided in the repaint event is
-      // not larger than the dimensions of this element.
-      std::vector<utils::Boxf> cropped;
+      // not larger than the dimensions of this element. The cropped areas are
+      // gathered in a region so that overlapping and adjacent areas get merged
+      // into a small set of areas to repaint.
+      DirtyRegion cropped;
       utils::Boxf thisArea = LayoutItem::getRenderingArea().toOrigin();
 
+      // An event without any region concerns the whole support widget.
       const std::vector<core::engine::update::Region>& regions = e.getUpdateRegions();
+      if (regions.empty()) {
+        cropped.add(thisArea.intersect(support->getRenderingArea()));
+      }
+
+      // The regions emitted by this widget are the strips exposed by a scroll
+      // operation: they are already expressed after the shift of the content
+      // and should not be translated again.
+      const bool shifted = m_blitPending && !e.isEmittedBy(this);
+
       for (unsigned id = 0u ; id < regions.size() ; ++id) {
         // Convert the region to local coordinate frame.
         utils::Boxf local = (
@@ -464,6 +517,20 @@ namespace sdl {
           mapFromGlobal(regions[id].area)
         );
 
+        // Children of the support widget lying entirely outside of the viewport
+        // are culled: their repaints are not propagated any further as they are
+        // not visible anyway. They will be repainted once scrolled into view.
+        if (!thisArea.intersect(local).valid()) {
+          continue;
+        }
+
+        // In case a scroll operation is pending, the content to repaint will be
+        // shifted by the scroll delta before being repainted: the area should be
+        // translated accordingly.
+        if (shifted) {
+          local = utils::Boxf(local.getCenter() + m_scrollDelta, local.w(), local.h());
+        }
+
         // Check whether it is contained inside the area assigned to this widget.
         if (!thisArea.contains(local)) {
           // Only consider the intersection of the area to repaint with this area
@@ -471,20 +538,231 @@ namespace sdl {
           local = thisArea.intersect(local);
         }
 
-        cropped.push_back(mapToGlobal(local));
+        if (local.valid()) {
+          cropped.add(local);
+        }
+      }
+
+      // In case a scroll operation is pending, the repaint of the whole support
+      // widget is the one caused by its motion: the part of the viewport which
+      // will be shifted does not need to be repainted. The strips exposed by the
+      // motion are requested by this widget.
+      if (m_blitPending && regions.empty()) {
+        utils::Boxf reusable = getReusableArea();
+
+        if (reusable.valid()) {
+          cropped.subtract(reusable);
+        }
       }
 
+      // Nothing visible needs to be repainted: the event is consumed here so
+      // that it does not trigger a repaint of the whole hierarchy.
+      if (cropped.empty()) {
+        return true;
+      }
+
+      cropped.simplify();
+
       // Create a new repaint event from the new areas.
       core::engine::PaintEvent pe(this);
       pe.setEmitter(e.getEmitter());
 
-      for (unsigned id = 0u ; id < cropped.size() ; ++id) {
-        pe.addUpdateRegion(cropped[id]);
+      const std::vector<utils::Boxf>& boxes = cropped.getBoxes();
+      for (unsigned id = 0u ; id < boxes.size() ; ++id) {
+        pe.addUpdateRegion(mapToGlobal(boxes[id]));
       }
 
       // Call the paint event with the newly created event.
       return core::SdlWidget::repaintEvent(pe);
     }
 
+    void
+    ScrollableWidget::clearContentPrivate(const utils::Uuid& uuid,
+                                          const utils::Boxf& area)
+    {
+      {
+        // Protect from concurrent accesses.
+        Guard guard(m_propsLocker);
+
+        // Shift the content displayed in the previous frame before clearing
+        // the first area to update: the content is read from the whole part
+        // of the viewport still valid which includes areas about to be cleared.
+        shiftContent(uuid);
+      }
+
+      // Use the base handler to clear the area.
+      core::SdlWidget::clearContentPrivate(uuid, area);
+    }
+
+    void
+    ScrollableWidget::drawContentPrivate(const utils::Uuid& uuid,
+                                         const utils::Boxf& /*area*/)
+    {
+      // Protect from concurrent accesses.
+      Guard guard(m_propsLocker);
+
+      // Shift the content displayed in the previous frame if this was not
+      // done when clearing the canvas.
+      shiftContent(uuid);
+
+      // A new frame is being drawn: the motion accumulated since the last one
+      // can be applied. This is not done here as moving the support widget and
+      // notifying listeners should not happen while drawing: an event is posted
+      // instead.
+      m_kinetic.releaseFrame();
+
+      if (m_kinetic.hasMotion()) {
+        std::shared_ptr<core::engine::PaintEvent> pe = m_frameNotifier.request(this);
+
+        if (pe != nullptr) {
+          postEvent(pe);
+        }
+      }
+    }
+
+    void
+    ScrollableWidget::shiftContent(const utils::Uuid& uuid) {
+      // Assume the locker is already locked.
+
+      // Only shift the content once per repaint, even if several areas are
+      // updated.
+      if (!m_blitPending) {
+        return;
+      }
+
+      m_blitPending = false;
+
+      utils::Boxf reusable = getReusableArea();
+      if (!reusable.valid() || (m_scrollDelta.x() == 0.0f && m_scrollDelta.y() == 0.0f)) {
+        return;
+      }
+
+      // Make sure the backing texture matches the size of the canvas.
+      utils::Sizef sizeEnv = getEngine().queryTexture(uuid);
+
+      if (m_backing.valid()) {
+        utils::Sizef sizeBacking = getEngine().queryTexture(m_backing);
+
+        if (sizeBacking.w() != sizeEnv.w() || sizeBacking.h() != sizeEnv.h()) {
+          clearBacking();
+        }
+      }
+
+      if (!m_backing.valid()) {
+        m_backing = getEngine().createTexture(sizeEnv, core::engine::Palette::ColorRole::Base);
+      }
+
+      // The content now displayed in the reusable area was displayed at the
+      // same location minus the scroll delta in the previous frame: this is
+      // the intersection of the viewport with the viewport shifted back by
+      // the delta. It is first copied in the backing texture at the same
+      // location and then drawn back onto the canvas at its new location.
+      utils::Boxf canvas = utils::Boxf::fromSize(sizeEnv, true);
+      utils::Boxf viewport = LayoutItem::getRenderingArea().toOrigin();
+      utils::Boxf src = viewport.intersect(
+        utils::Boxf(viewport.getCenter() - m_scrollDelta, viewport.w(), viewport.h())
+      );
+
+      utils::Boxf srcEngine = convertToEngineFormat(src, canvas);
+      utils::Boxf dstEngine = convertToEngineFormat(reusable, canvas);
+
+      getEngine().drawTexture(uuid, &srcEngine, &m_backing, &srcEngine);
+      getEngine().drawTexture(m_backing, &srcEngine, &uuid, &dstEngine);
+    }
+
+    void
+    ScrollableWidget::applyKineticScrolling() {
+      // Assume the locker is already locked.
+      if (!m_kinetic.hasMotion() || !m_kinetic.acquireFrame()) {
+        return;
+      }
+
+      utils::Vector2f motion = m_kinetic.consume();
+
+      // The positions are only provided for inheriting classes: the base
+      // implementation only relies on the motion.
+      utils::Vector2f start = (m_coordsToFollow != nullptr ? *m_coordsToFollow : utils::Vector2f());
+
+      if (!isAgainstBounds(motion) && handleContentScrolling(start, start + motion, motion)) {
+        requestScrollRepaint();
+        return;
+      }
+
+      // Nothing moved so no frame will be drawn because of this motion: the
+      // next motion can be applied right away. This also stops the momentum
+      // if the content reached its bounds.
+      m_kinetic.releaseFrame();
+      m_kinetic.stop();
+    }
+
+    bool
+    ScrollableWidget::isAgainstBounds(const utils::Vector2f& motion) const {
+      // Assume the locker is already locked.
+      if (!hasSupportWidget()) {
+        return true;
+      }
+
+      // Use the same computations as the `handleContentScrolling` method to
+      // determine whether the support can move along the motion.
+      utils::Boxf area = getSupportWidget()->getRenderingArea();
+      utils::Sizef thisSize = LayoutItem::getRenderingArea().toSize();
+      utils::Boxf viewport(
+        area.getCenter(),
+        std::min(area.w(), thisSize.w()),
+        std::min(area.h(), thisSize.h())
+      );
+
+      utils::Sizef max = getPreferredSizePrivate();
+
+      const bool blockedX =
+        motion.x() == 0.0f ||
+        (motion.x() < 0.0f && viewport.getLeftBound() <= -max.w() / 2.0f) ||
+        (motion.x() > 0.0f && viewport.getRightBound() >= max.w() / 2.0f)
+      ;
+      const bool blockedY =
+        motion.y() == 0.0f ||
+        (motion.y() < 0.0f && viewport.getBottomBound() <= -max.h() / 2.0f) ||
+        (motion.y() > 0.0f && viewport.getTopBound() >= max.h() / 2.0f)
+      ;
+
+      return blockedX && blockedY;
+    }
+
+    void
+    ScrollableWidget::requestScrollRepaint() {
+      // Assume the locker is already locked.
+
+      // Repaint the whole widget in case the content cannot be shifted.
+      if (!m_blitPending) {
+        requestRepaint();
+        return;
+      }
+
+      utils::Boxf reusable = getReusableArea();
+
+      if (!reusable.valid()) {
+        m_blitPending = false;
+        requestRepaint();
+        return;
+      }
+
+      // Only repaint the strips exposed by the scroll operation. They are
+      // expressed in the coordinates of the content once shifted.
+      std::vector<utils::Boxf> exposed = DirtyRegion::subtract(LayoutItem::getRenderingArea().toOrigin(), reusable);
+
+      if (exposed.empty()) {
+        return;
+      }
+
+      std::shared_ptr<core::engine::PaintEvent> pe = std::make_shared<core::engine::PaintEvent>(this);
+      pe->setEmitter(this);
+
+      for (unsigned id = 0u ; id < exposed.size() ; ++id) {
+        pe->addUpdateRegion(mapToGlobal(exposed[id]));
+      }
+
+      postEvent(pe);
+    }
+
   }
 }
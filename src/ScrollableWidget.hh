@@ -1,11 +1,16 @@
 #ifndef    SCROLLABLE_WIDGET_HH
 # define   SCROLLABLE_WIDGET_HH
 
+# include <cmath>
 # include <mutex>
 # include <memory>
+# include <vector>
 # include <sdl_core/SdlWidget.hh>
 # include <maths_utils/Vector2.hh>
 # include "ScrollOrientation.hh"
+# include "DirtyRegion.hh"
+# include "KineticScroller.hh"
+# include "DeferredNotifier.hh"
 
 namespace sdl {
   namespace graphic {
@@ -35,6 +40,10 @@ namespace sdl {
          *          This method is used to assign a new widget that this object
          *          will operate on. A `null` value means that no widget is being
          *          scrolled and is valid.
+         *          Note that the children of the support widget lying outside of the
+         *          viewport are only culled from the repaint propagation (see the
+         *          `repaintEvent` method): they are still updated and drawn in their
+         *          own canvas by `sdl_core`, which provides no way to skip them.
          * @param widget - the new widget to scroll onto.
          */
         void
@@ -56,6 +65,18 @@ namespace sdl {
         utils::Sizef
         getPreferredSize() const noexcept;
 
+        /**
+         * @brief - Defines whether scrolling the support widget should reuse the content
+         *          already displayed. When this is the case the last composited viewport
+         *          is shifted by the scroll delta with a single blit and only the strips
+         *          of the viewport which are newly exposed are repainted from the support
+         *          widget. Otherwise the whole viewport is repainted upon each scroll.
+         *          This is activated by default.
+         * @param blit - `true` to shift the displayed content when scrolling.
+         */
+        void
+        setBlitScrolling(bool blit);
+
         /**
          * @brief - Reimplementation of the base `core::SdlWidget` in order to filter the
          *          returned widget if it corresponds to the support widget but outside
@@ -275,12 +296,49 @@ namespace sdl {
          *          the whole content: if we were to use the regular system which allow for
          *          larger items to be displayed on top of others we would lose the benefit
          *          of having such a scrollable content.
+         *          Repaints of areas lying entirely outside of the viewport are culled
+         *          and not propagated at all. This is the only culling performed: the
+         *          widgets emitting them are not hidden as the layouts would ignore
+         *          them and reflow the content.
+         *          While a scroll is pending the repaints requested by the support are
+         *          translated by the scroll delta as the content they refer to will be
+         *          shifted before being repainted.
+         *          This is also where the motion queued by the kinetic scroller is
+         *          applied after a frame has been drawn.
          * @param e - the paint event to process.
          * @return - `true` if the event was recognized and `false` otherwise.
          */
         bool
         repaintEvent(const core::engine::PaintEvent& e) override;
 
+        /**
+         * @brief - Reimplementation of the base `SdlWidget` method. In case the support
+         *          widget was scrolled since the last repaint, the part of the canvas
+         *          which is still valid is shifted by the scroll delta before any area
+         *          is cleared: this guarantees that the shift only reads the content of
+         *          the previous frame.
+         * @param uuid - the identifier of the canvas to clear.
+         * @param area - the area of the canvas to clear.
+         */
+        void
+        clearContentPrivate(const utils::Uuid& uuid,
+                            const utils::Boxf& area) override;
+
+        /**
+         * @brief - Reimplementation of the base `SdlWidget` method. In case the support
+         *          widget was scrolled since the last repaint, the part of the canvas
+         *          which is still valid is shifted by the scroll delta (if this was not
+         *          already done when clearing the canvas) so that it does not need to
+         *          be repainted from the support widget.
+         *          When some motion was queued by the kinetic scroller an event is also
+         *          posted so that it gets applied once the frame is drawn.
+         * @param uuid - the identifier of the canvas which we can use to draw an image overlay.
+         * @param area - the area of the canvas to update.
+         */
+        void
+        drawContentPrivate(const utils::Uuid& uuid,
+                           const utils::Boxf& area) override;
+
       private:
 
         /**
@@ -335,6 +393,8 @@ namespace sdl {
          *          event. This method checks that the button provided in argument is
          *          the one used by the scrolling process and if this is the case do
          *          perform a reset of the coordinates to follow.
+         *          The kinetic scroller is also released so that the content keeps
+         *          moving for a while.
          *          Note that the locker is acquired by this method.
          * @param button - the button which attempts to reset the scrolling coordinates.
          */
@@ -369,6 +429,67 @@ namespace sdl {
         createOrGetCoordsToFollow(const utils::Vector2f& coords,
                                   bool force = false);
 
+        /**
+         * @brief - Used to determine the part of the viewport which displays valid data
+         *          once the content displayed so far is shifted by the current scroll
+         *          delta: this is the intersection of the viewport with the viewport
+         *          shifted by the delta. The content is read from the same area shifted
+         *          back by the delta. The returned box is invalid if nothing can be
+         *          reused.
+         *          Assumes that the locker is already acquired.
+         * @return - the part of the viewport which does not need to be repainted from
+         *           the support widget, expressed in local coordinate frame.
+         */
+        utils::Boxf
+        getReusableArea() const noexcept;
+
+        /**
+         * @brief - Requests a repaint after the support widget has been scrolled. When
+         *          blit scrolling is enabled only the strips of the viewport which are
+         *          exposed by the scroll are repainted: otherwise or when nothing from
+         *          the previous frame can be reused the whole widget is repainted.
+         *          Assumes that the locker is already acquired.
+         */
+        void
+        requestScrollRepaint();
+
+        /**
+         * @brief - Shifts the part of the canvas which is still valid after a scroll
+         *          operation by the scroll delta. Nothing happens if no scroll operation
+         *          was performed since the last repaint.
+         *          Assumes that the locker is already acquired.
+         * @param uuid - the identifier of the canvas.
+         */
+        void
+        shiftContent(const utils::Uuid& uuid);
+
+        /**
+         * @brief - Applies the motion accumulated by the kinetic scroller to the support
+         *          widget, unless some motion was already applied since the last frame
+         *          in which case it waits for the next frame.
+         *          Assumes that the locker is already acquired.
+         */
+        void
+        applyKineticScrolling();
+
+        /**
+         * @brief - Determines whether the support widget is already against its bounds
+         *          along the input motion, in which case applying it would not move the
+         *          support widget. This is used to stop the momentum of the content.
+         *          Assumes that the locker is already acquired.
+         * @param motion - the motion to check.
+         * @return - `true` if the support can't move along the motion.
+         */
+        bool
+        isAgainstBounds(const utils::Vector2f& motion) const;
+
+        /**
+         * @brief - Releases the texture used to shift the content of the viewport.
+         *          Assumes that the locker is already acquired.
+         */
+        void
+        clearBacking();
+
       private:
 
       /**
@@ -397,6 +518,40 @@ namespace sdl {
          */
         OptionalPos m_coordsToFollow;
 
+        /**
+         * @brief - Whether scrolling reuses the content displayed in the viewport rather
+         *          than repainting it entirely.
+         */
+        bool m_blitScrolling;
+
+        /**
+         * @brief - Describes the scroll operations performed since the last repaint: the
+         *          `m_blitOrigin` is the center of the support widget as displayed by the
+         *          canvas and `m_scrollDelta` the motion of the support widget since then
+         *          expressed in local coordinate frame. These values are only relevant if
+         *          `m_blitPending` is `true`.
+         */
+        bool m_blitPending;
+        utils::Vector2f m_blitOrigin;
+        utils::Vector2f m_scrollDelta;
+
+        /**
+         * @brief - A texture used to copy the part of the canvas to shift when scrolling.
+         *          Blitting a texture onto itself with overlapping areas is not supported
+         *          so the data transits through this texture. It is created upon the first
+         *          scroll and kept at the size of the canvas.
+         */
+        utils::Uuid m_backing;
+
+        /**
+         * @brief - Paces the drag motions so that the support widget is moved at most
+         *          once per frame, and keeps the content moving after a drag. When a
+         *          frame is drawn while some motion is queued, the `m_frameNotifier` is
+         *          used so that the motion gets applied from the events loop.
+         */
+        KineticScroller m_kinetic;
+        DeferredNotifier m_frameNotifier;
+
       public:
 
         /**
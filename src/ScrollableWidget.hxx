@@ -16,6 +16,21 @@ namespace sdl {
       return getPreferredSizePrivate();
     }
 
+    inline
+    void
+    ScrollableWidget::setBlitScrolling(bool blit) {
+      // Protect from concurrent accesses.
+      Guard guard(m_propsLocker);
+
+      m_blitScrolling = blit;
+
+      // Any pending shift is dropped in favor of a full repaint.
+      if (!m_blitScrolling && m_blitPending) {
+        m_blitPending = false;
+        requestRepaint();
+      }
+    }
+
     inline
     const core::SdlWidget*
     ScrollableWidget::getItemAt(const utils::Vector2f& pos) const noexcept {
@@ -141,6 +156,10 @@ namespace sdl {
 
       // Reset the coordinates to follow.
       m_coordsToFollow.reset();
+
+      // Let the content glide if the user was still moving.
+      m_kinetic.release();
+      applyKineticScrolling();
     }
 
     inline
@@ -165,6 +184,27 @@ namespace sdl {
       return coords;
     }
 
+    inline
+    utils::Boxf
+    ScrollableWidget::getReusableArea() const noexcept {
+      // Assume the locker is already locked.
+      utils::Boxf viewport = LayoutItem::getRenderingArea().toOrigin();
+
+      utils::Boxf shifted(viewport.getCenter() + m_scrollDelta, viewport.w(), viewport.h());
+
+      return viewport.intersect(shifted);
+    }
+
+    inline
+    void
+    ScrollableWidget::clearBacking() {
+      // Assume the locker is already locked.
+      if (m_backing.valid()) {
+        getEngine().destroyTexture(m_backing);
+        m_backing.invalidate();
+      }
+    }
+
   }
 }
 
@@ -10,6 +10,7 @@ namespace sdl {
                                    float margin):
       core::Layout(name, widget, margin),
       m_activeItem(-1),
+      m_activeDeferred(false),
       m_idsToPosition()
     {
       // Nothing to do.
@@ -68,11 +69,16 @@ namespace sdl {
       // internal array.
       const int realID = m_idsToPosition[m_activeItem];
 
-      // Disable other items.
+      // Disable other items. In case the active item is deferred it is
+      // disabled as well and there's no need to compute its area.
       std::vector<bool> visible(getItemsCount(), false);
-      visible[realID] = true;
+      visible[realID] = !m_activeDeferred;
       assignVisibilityStatus(visible);
 
+      if (m_activeDeferred) {
+        return;
+      }
+
       // Compute the available space for the active child.
       const utils::Sizef componentSize = computeAvailableSize(window);
 
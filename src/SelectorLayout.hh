@@ -45,6 +45,24 @@ namespace sdl {
         int
         getActiveItemId() const;
 
+        /**
+         * @brief - Used to defer the display of the active item. While deferred, all the
+         *          items are hidden and no geometry is computed for the active item: this
+         *          allows the widget using this layout to display something else in its
+         *          place without paying for the layout and repaint of the item.
+         *          The layout is invalidated whenever the status changes.
+         * @param deferred - `true` if the active item should be hidden.
+         */
+        void
+        setActiveItemDeferred(bool deferred);
+
+        /**
+         * @brief - Determines whether the display of the active item is deferred.
+         * @return - `true` if the active item is hidden.
+         */
+        bool
+        isActiveItemDeferred() const noexcept;
+
       protected:
 
         void
@@ -112,6 +130,12 @@ namespace sdl {
 
         int m_activeItem;
 
+        /**
+         * @brief - Whether the active item is hidden until the widget using this layout
+         *          decides otherwise.
+         */
+        bool m_activeDeferred;
+
         /**
          * @brief - Allows to store the logical position of the item stored at a given
          *          position in the parent table. This allows to correctly assign the
@@ -62,6 +62,24 @@ namespace sdl {
       return m_activeItem;
     }
 
+    inline
+    void
+    SelectorLayout::setActiveItemDeferred(bool deferred) {
+      // Nothing to do if the status does not change.
+      if (deferred == m_activeDeferred) {
+        return;
+      }
+
+      m_activeDeferred = deferred;
+      makeGeometryDirty();
+    }
+
+    inline
+    bool
+    SelectorLayout::isActiveItemDeferred() const noexcept {
+      return m_activeDeferred;
+    }
+
     inline
     int
     SelectorLayout::getLogicalIDFromPhysicalID(int physID) const noexcept {
@@ -14,7 +14,17 @@ namespace sdl {
       m_propsLocker(),
 
       m_switchOnLeftClick(switchOnLeftClick),
-      m_activeItem(0u)
+      m_activeItem(0u),
+
+      m_pages(),
+      m_snapshots(),
+      m_snapshotsCount(getDefaultSnapshotsCount()),
+
+      m_displayed(nullptr),
+      m_canvasSize(),
+      m_switchPending(false),
+
+      m_frameNotifier()
     {
       SelectorLayoutShPtr layout = std::make_shared<SelectorLayout>(
         std::string("selector_layout_for_") + getName(),
@@ -26,6 +36,13 @@ namespace sdl {
       setLayout(layout);
     }
 
+    SelectorWidget::~SelectorWidget() {
+      Guard guard(m_propsLocker);
+
+      TextureBudget::getInstance().discharge(this);
+      clearSnapshots();
+    }
+
     void
     SelectorWidget::insertWidget(core::SdlWidget* widget,
                                  int index)
@@ -47,6 +64,12 @@ namespace sdl {
       l.addItem(widget, index);
 
       m_activeItem = l.getActiveItemId();
+
+      // Keep track of the page using the same position as the layout.
+      const int count = static_cast<int>(m_pages.size());
+      m_pages.insert(m_pages.begin() + std::max(0, std::min(index, count)), widget);
+
+      onActiveItemChanged();
     }
 
     int
@@ -73,9 +96,252 @@ namespace sdl {
         m_activeItem = l.getActiveItemId();
       }
 
+      // Forget about the page: the widget may be deleted by the caller.
+      if (logicID >= 0 && logicID < static_cast<int>(m_pages.size())) {
+        m_pages.erase(m_pages.begin() + logicID);
+      }
+
+      discardSnapshot(widget);
+
+      if (m_displayed == widget) {
+        m_displayed = nullptr;
+      }
+
+      onActiveItemChanged();
+
       // Return the index of this widget.
       return logicID;
     }
 
+    void
+    SelectorWidget::updatePrivate(const utils::Boxf& window) {
+      {
+        Guard guard(m_propsLocker);
+
+        // In case the size changes the canvas will be recreated: its content
+        // can't be saved anymore. The existing snapshots are kept though as
+        // the size might come back to its previous value.
+        if (!m_canvasSize.compareWithTolerance(window.toSize(), 0.5f)) {
+          m_displayed = nullptr;
+          m_canvasSize = utils::Sizef();
+        }
+      }
+
+      core::SdlWidget::updatePrivate(window);
+    }
+
+    bool
+    SelectorWidget::repaintEvent(const core::engine::PaintEvent& e) {
+      {
+        Guard guard(m_propsLocker);
+
+        // The snapshot of the active page was drawn: the page itself can now
+        // be displayed unless another page was activated in the meantime.
+        const DeferredNotifier::Reception frame = m_frameNotifier.receive(e, this);
+
+        if (frame != DeferredNotifier::Reception::None && !m_switchPending) {
+          getLayout().setActiveItemDeferred(false);
+        }
+
+        if (frame == DeferredNotifier::Reception::Alone) {
+          return true;
+        }
+
+        // Any other repaint requested by a page means that its content has
+        // changed: its snapshot is outdated.
+        if (!isEmitter(e)) {
+          for (unsigned id = 0u ; id < m_snapshots.size() ; ++id) {
+            if (e.isEmittedBy(m_snapshots[id].page)) {
+              m_snapshots[id].valid = false;
+            }
+          }
+        }
+      }
+
+      return core::SdlWidget::repaintEvent(e);
+    }
+
+    void
+    SelectorWidget::clearContentPrivate(const utils::Uuid& uuid,
+                                        const utils::Boxf& area)
+    {
+      {
+        // Protect from concurrent accesses.
+        Guard guard(m_propsLocker);
+
+        // The canvas still displays the page previously active: save it
+        // before clearing the first area to update.
+        if (m_switchPending) {
+          captureSnapshot(uuid);
+        }
+      }
+
+      // Use the base handler to clear the area.
+      core::SdlWidget::clearContentPrivate(uuid, area);
+    }
+
+    void
+    SelectorWidget::drawContentPrivate(const utils::Uuid& uuid,
+                                       const utils::Boxf& area)
+    {
+      // Protect from concurrent accesses.
+      Guard guard(m_propsLocker);
+
+      // The snapshots are used: prevent them from being evicted.
+      TextureBudget::getInstance().touch(this);
+
+      // The canvas displays the active page from now on, either through its
+      // snapshot or because the page is drawn on top of it.
+      m_canvasSize = getEngine().queryTexture(uuid);
+      m_displayed = getActivePage();
+      m_switchPending = false;
+
+      if (!getLayout().isActiveItemDeferred()) {
+        return;
+      }
+
+      // Draw the snapshot in place of the active page: the page will only be
+      // laid out and repainted after this frame. In case the snapshot is not
+      // available anymore the page is displayed right away.
+      const int id = findSnapshot(m_displayed);
+
+      if (id >= 0) {
+        utils::Boxf canvas = utils::Boxf::fromSize(m_canvasSize, true);
+        utils::Boxf dstRect = canvas.intersect(area);
+
+        if (dstRect.valid()) {
+          utils::Boxf rectEngine = convertToEngineFormat(dstRect, canvas);
+
+          getEngine().drawTexture(m_snapshots[id].texture, &rectEngine, &uuid, &rectEngine);
+        }
+      }
+
+      std::shared_ptr<core::engine::PaintEvent> pe = m_frameNotifier.request(this);
+
+      if (pe != nullptr) {
+        postEvent(pe);
+      }
+    }
+
+    void
+    SelectorWidget::captureSnapshot(const utils::Uuid& canvas) {
+      // Only capture the content of the canvas once: it is not valid anymore
+      // as soon as an area is cleared.
+      core::SdlWidget* page = m_displayed;
+      m_displayed = nullptr;
+
+      // Nothing to capture if the content of the canvas is not known or if
+      // the snapshots are disabled.
+      if (page == nullptr || !canvas.valid() || m_snapshotsCount == 0) {
+        return;
+      }
+
+      // Retrieve the existing snapshot for this page if any: it becomes the
+      // most recently used one.
+      Snapshot snapshot{page, utils::Uuid(), utils::Sizef(), false};
+
+      Snapshots::iterator it = std::find_if(
+        m_snapshots.begin(),
+        m_snapshots.end(),
+        [page](const Snapshot& entry) {
+          return entry.page == page;
+        }
+      );
+
+      if (it != m_snapshots.end()) {
+        snapshot = *it;
+        m_snapshots.erase(it);
+      }
+
+      // Make sure the snapshot matches the size of the canvas.
+      utils::Sizef sizeEnv = getEngine().queryTexture(canvas);
+
+      if (snapshot.texture.valid() && !snapshot.size.compareWithTolerance(sizeEnv, 0.5f)) {
+        getEngine().destroyTexture(snapshot.texture);
+        snapshot.texture.invalidate();
+      }
+
+      if (!snapshot.texture.valid()) {
+        snapshot.texture = getEngine().createTexture(sizeEnv, core::engine::Palette::ColorRole::Base);
+        snapshot.size = sizeEnv;
+      }
+
+      // Copy the whole canvas.
+      utils::Boxf area = utils::Boxf::fromSize(sizeEnv, true);
+      utils::Boxf rectEngine = convertToEngineFormat(area, area);
+
+      getEngine().drawTexture(canvas, &rectEngine, &snapshot.texture, &rectEngine);
+      snapshot.valid = true;
+
+      m_snapshots.insert(m_snapshots.begin(), snapshot);
+
+      // Discard the least recently used snapshots.
+      trimSnapshots();
+      chargeSnapshots();
+    }
+
+    void
+    SelectorWidget::discardSnapshot(core::SdlWidget* page) {
+      Snapshots::iterator it = std::find_if(
+        m_snapshots.begin(),
+        m_snapshots.end(),
+        [page](const Snapshot& entry) {
+          return entry.page == page;
+        }
+      );
+
+      if (it == m_snapshots.end()) {
+        return;
+      }
+
+      getEngine().destroyTexture(it->texture);
+      m_snapshots.erase(it);
+
+      chargeSnapshots();
+    }
+
+    void
+    SelectorWidget::clearSnapshots() {
+      for (unsigned id = 0u ; id < m_snapshots.size() ; ++id) {
+        getEngine().destroyTexture(m_snapshots[id].texture);
+      }
+
+      m_snapshots.clear();
+    }
+
+    void
+    SelectorWidget::chargeSnapshots() {
+      std::size_t bytes = 0u;
+
+      for (unsigned id = 0u ; id < m_snapshots.size() ; ++id) {
+        bytes += TextureBudget::getTextureBytes(getEngine(), m_snapshots[id].texture);
+      }
+
+      TextureBudget::getInstance().charge(
+        this,
+        bytes,
+        [this]() {
+          return evictSnapshots();
+        }
+      );
+    }
+
+    bool
+    SelectorWidget::evictSnapshots() {
+      // Do not wait for the widget if it is busy: the snapshots can be
+      // evicted later on.
+      std::unique_lock<std::mutex> guard(m_propsLocker, std::try_to_lock);
+      if (!guard.owns_lock()) {
+        return false;
+      }
+
+      clearSnapshots();
+
+      // The active page can't be deferred anymore.
+      getLayout().setActiveItemDeferred(false);
+
+      return true;
+    }
+
   }
 }
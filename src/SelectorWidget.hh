@@ -5,9 +5,12 @@
 # include <memory>
 # include <string>
 # include <vector>
+# include <algorithm>
 # include <unordered_map>
 # include <sdl_core/SdlWidget.hh>
 # include "SelectorLayout.hh"
+# include "TextureBudget.hh"
+# include "DeferredNotifier.hh"
 
 namespace sdl {
   namespace graphic {
@@ -21,11 +24,22 @@ namespace sdl {
                        const core::engine::Color& color = core::engine::Color(),
                        const utils::Sizef& area = utils::Sizef());
 
-        ~SelectorWidget() = default;
+        /**
+         * @brief - Destroys the snapshots of the pages kept by this widget.
+         */
+        ~SelectorWidget();
 
         void
         setActiveWidget(const std::string& name);
 
+        /**
+         * @brief - Used to activate the widget at the specified index. In case a snapshot of
+         *          the page is available it is displayed during the next frame and the page
+         *          itself is only laid out and repainted during the following one. This
+         *          allows to flip quickly between pages without paying for the pages which
+         *          are only displayed for a single frame.
+         * @param index - the index of the widget to activate.
+         */
         void
         setActiveWidget(int index);
 
@@ -62,8 +76,60 @@ namespace sdl {
         int
         getActiveItem();
 
+        /**
+         * @brief - Defines the maximum number of snapshots of pages kept by this widget.
+         *          Whenever a page is hidden because another one is activated the content
+         *          it displayed is kept in a snapshot: if the page is activated again the
+         *          snapshot is displayed right away in place of the page. Only the most
+         *          recently displayed pages are kept. A value of `0` disables the snapshots.
+         * @param count - the maximum number of snapshots to keep.
+         */
+        void
+        setSnapshotsCount(int count);
+
       protected:
 
+        /**
+         * @brief - Reimplementation of the base `core::SdlWidget` method in order to forget
+         *          about the content displayed by the canvas if its size changes: it cannot
+         *          be used to create a snapshot anymore.
+         * @param window - the available size to perform the update.
+         */
+        void
+        updatePrivate(const utils::Boxf& window) override;
+
+        /**
+         * @brief - Reimplementation of the base `core::SdlWidget` method. Repaints requested
+         *          by a page invalidate its snapshot as its content changed. This is also
+         *          where the active page is displayed again once its snapshot was drawn.
+         * @param e - the paint event to process.
+         * @return - `true` if the event was recognized and `false` otherwise.
+         */
+        bool
+        repaintEvent(const core::engine::PaintEvent& e) override;
+
+        /**
+         * @brief - Reimplementation of the base `core::SdlWidget` method. In case the active
+         *          page was switched since the last frame, the canvas still displays the page
+         *          previously active: it is saved in a snapshot before being cleared.
+         * @param uuid - the identifier of the canvas to clear.
+         * @param area - the area of the canvas to clear.
+         */
+        void
+        clearContentPrivate(const utils::Uuid& uuid,
+                            const utils::Boxf& area) override;
+
+        /**
+         * @brief - Reimplementation of the base `core::SdlWidget` method. In case the active
+         *          page is deferred its snapshot is drawn in its place and the page will be
+         *          displayed after the frame.
+         * @param uuid - the identifier of the canvas which we can use to draw the snapshot.
+         * @param area - the area of the canvas to update.
+         */
+        void
+        drawContentPrivate(const utils::Uuid& uuid,
+                           const utils::Boxf& area) override;
+
         /**
          * @brief - Redefinition of the base `SdlWidget` method to provide a custom behavior
          *          upon clicking on any child of this widget. Basically when the user clicks
@@ -105,8 +171,109 @@ namespace sdl {
         SelectorLayout&
         getLayout();
 
+        /**
+         * @brief - Used to retrieve the default number of snapshots kept by a selector.
+         * @return - the default number of snapshots.
+         */
+        static
+        int
+        getDefaultSnapshotsCount() noexcept;
+
+        /**
+         * @brief - Retrieves the page which is currently active or `null` if there are no
+         *          pages in this widget.
+         *          Assumes that the locker is already acquired.
+         * @return - the active page.
+         */
+        core::SdlWidget*
+        getActivePage() const noexcept;
+
+        /**
+         * @brief - Called whenever the active item of the layout might have changed: if it
+         *          does not correspond to the page displayed by the canvas a switch is marked
+         *          as pending. The display of the page is deferred in case a snapshot of the
+         *          page can be drawn instead.
+         *          Assumes that the locker is already acquired.
+         */
+        void
+        onActiveItemChanged();
+
+        /**
+         * @brief - Used to find a snapshot of the input page which can be drawn on the canvas,
+         *          i.e. which is still valid and has the size of the canvas.
+         *          Assumes that the locker is already acquired.
+         * @param page - the page for which a snapshot should be found.
+         * @return - the index of the snapshot or a negative value if none can be used.
+         */
+        int
+        findSnapshot(core::SdlWidget* page) const;
+
+        /**
+         * @brief - Used to save the content of the canvas in the snapshot of the page which
+         *          is currently displayed. The snapshot becomes the most recently used one and
+         *          the least recently used ones are discarded if needed.
+         *          Assumes that the locker is already acquired.
+         * @param canvas - the canvas holding the content of the displayed page.
+         */
+        void
+        captureSnapshot(const utils::Uuid& canvas);
+
+        /**
+         * @brief - Destroys the snapshot of the input page if any.
+         *          Assumes that the locker is already acquired.
+         * @param page - the page for which the snapshot should be destroyed.
+         */
+        void
+        discardSnapshot(core::SdlWidget* page);
+
+        /**
+         * @brief - Destroys the least recently used snapshots so that no more than the
+         *          maximum count of snapshots are kept.
+         *          Assumes that the locker is already acquired.
+         */
+        void
+        trimSnapshots();
+
+        /**
+         * @brief - Destroys all the snapshots.
+         *          Assumes that the locker is already acquired.
+         */
+        void
+        clearSnapshots();
+
+        /**
+         * @brief - Registers the snapshots currently held by this widget in the texture budget.
+         *          Assumes that the locker is already acquired.
+         */
+        void
+        chargeSnapshots();
+
+        /**
+         * @brief - Used by the texture budget to release the snapshots held by this widget
+         *          when it was not drawn for a while. The active page is displayed in case it
+         *          was deferred.
+         *          Acquires the locker if possible.
+         * @return - `true` if the snapshots could be released and `false` if the widget is
+         *           currently busy.
+         */
+        bool
+        evictSnapshots();
+
       private:
 
+        /**
+         * @brief - Describes the snapshot of a page: the snapshot can only be used if it is
+         *          still valid and if it has the same size as the canvas.
+         */
+        struct Snapshot {
+          core::SdlWidget* page;
+          utils::Uuid texture;
+          utils::Sizef size;
+          bool valid;
+        };
+
+        using Snapshots = std::vector<Snapshot>;
+
         /**
          * @brief - Protects this widget from concurrent accesses.
          */
@@ -125,6 +292,36 @@ namespace sdl {
          *          there's not much to be gain from this info.
          */
         int m_activeItem;
+
+        /**
+         * @brief - The pages registered in this widget in the order of the layout. This is
+         *          used to associate the snapshots to the pages independently of their index
+         *          which changes when pages are inserted or removed.
+         */
+        std::vector<core::SdlWidget*> m_pages;
+
+        /**
+         * @brief - The snapshots of the pages which were displayed most recently, from the
+         *          most recent to the least recent one, along with their maximum count.
+         */
+        Snapshots m_snapshots;
+        int m_snapshotsCount;
+
+        /**
+         * @brief - The page displayed by the canvas of this widget and the size of the canvas.
+         *          A `null` page indicates that the content of the canvas is not known. The
+         *          switch pending boolean indicates that the active page changed since the
+         *          last frame.
+         */
+        core::SdlWidget* m_displayed;
+        utils::Sizef m_canvasSize;
+        bool m_switchPending;
+
+        /**
+         * @brief - Used to be notified after the snapshot of the active page has been drawn
+         *          to display the page itself.
+         */
+        DeferredNotifier m_frameNotifier;
     };
 
     using SelectorWidgetShPtr = std::shared_ptr<SelectorWidget>;
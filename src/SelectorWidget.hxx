@@ -12,6 +12,7 @@ namespace sdl {
       Guard guard(m_propsLocker);
 
       m_activeItem = getLayout().setActiveItem(name);
+      onActiveItemChanged();
     }
 
     inline
@@ -20,6 +21,7 @@ namespace sdl {
       Guard guard(m_propsLocker);
 
       m_activeItem = getLayout().setActiveItem(index);
+      onActiveItemChanged();
     }
 
     inline
@@ -99,6 +101,21 @@ namespace sdl {
     void
     SelectorWidget::switchToNext() {
       m_activeItem = getLayout().switchToNext();
+      onActiveItemChanged();
+    }
+
+    inline
+    void
+    SelectorWidget::setSnapshotsCount(int count) {
+      Guard guard(m_propsLocker);
+
+      m_snapshotsCount = std::max(0, count);
+
+      trimSnapshots();
+      chargeSnapshots();
+
+      // The snapshot of the active page may not be available anymore.
+      onActiveItemChanged();
     }
 
     inline
@@ -125,6 +142,58 @@ namespace sdl {
       return *layout;
     }
 
+    inline
+    int
+    SelectorWidget::getDefaultSnapshotsCount() noexcept {
+      return 3;
+    }
+
+    inline
+    core::SdlWidget*
+    SelectorWidget::getActivePage() const noexcept {
+      if (m_activeItem < 0 || m_activeItem >= static_cast<int>(m_pages.size())) {
+        return nullptr;
+      }
+
+      return m_pages[m_activeItem];
+    }
+
+    inline
+    void
+    SelectorWidget::onActiveItemChanged() {
+      core::SdlWidget* page = getActivePage();
+
+      m_switchPending = (page != m_displayed);
+
+      // Defer the display of the new active page if a snapshot can be drawn
+      // instead: the page will be displayed after the snapshot.
+      getLayout().setActiveItemDeferred(m_switchPending && findSnapshot(page) >= 0);
+    }
+
+    inline
+    int
+    SelectorWidget::findSnapshot(core::SdlWidget* page) const {
+      for (unsigned id = 0u ; id < m_snapshots.size() ; ++id) {
+        const Snapshot& snapshot = m_snapshots[id];
+
+        if (snapshot.page == page) {
+          const bool fits = snapshot.size.compareWithTolerance(m_canvasSize, 0.5f);
+          return (snapshot.valid && fits ? static_cast<int>(id) : -1);
+        }
+      }
+
+      return -1;
+    }
+
+    inline
+    void
+    SelectorWidget::trimSnapshots() {
+      while (static_cast<int>(m_snapshots.size()) > m_snapshotsCount) {
+        getEngine().destroyTexture(m_snapshots.back().texture);
+        m_snapshots.pop_back();
+      }
+    }
+
   }
 }
 
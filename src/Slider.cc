@@ -36,11 +36,27 @@ namespace sdl {
       m_sliderItem(nullptr),
       m_rulerLine(),
       m_mobileArea(),
+      m_mobileAreaHighlight(),
+      m_highlighted(false),
+
+      m_valueItem(nullptr),
+
+      m_fontName(font),
+      m_fontSize(size),
+      m_font(),
+
+      m_glyphs(),
+
+      m_text(),
+      m_textValue(-1),
+
+      m_notifyPending(false),
+      m_notifier(),
 
       onValueChanged()
     {
       // Build the component.
-      build(font, size);
+      build();
 
       // Check whether the value could be assigned.
       if (std::abs(getValueFromRangeData(m_data) - value) > getStepRoundingThreshold()) {
@@ -61,6 +77,58 @@ namespace sdl {
       // Acquire the lock on the attributes of this widget.
       Guard guard(m_propsLocker);
 
+      drawSlider(uuid, area);
+    }
+
+    bool
+    Slider::repaintEvent(const core::engine::PaintEvent& e) {
+      bool notify = false;
+      float value = 0.0f;
+      DeferredNotifier::Reception reception = DeferredNotifier::Reception::None;
+
+      {
+        Guard guard(m_propsLocker);
+
+        // Only handle the event posted to notify the listeners.
+        reception = m_notifier.receive(e, this);
+
+        if (reception != DeferredNotifier::Reception::None) {
+          // Retrieve the pending notification if any: the listeners are
+          // notified once the lock is released so that they can query the
+          // slider.
+          if (m_notifyPending) {
+            notify = true;
+            value = getValueFromRangeData(m_data);
+
+            m_notifyPending = false;
+          }
+        }
+      }
+
+      if (notify) {
+        log(
+          "Emitting on value changed for " + getName() + " with value " + std::to_string(value),
+          utils::Level::Verbose
+        );
+
+        onValueChanged.safeEmit(
+          std::string("onValueChanged(") + std::to_string(value) + ")",
+          value
+        );
+      }
+
+      // The notification event does not require a repaint on its own.
+      if (reception == DeferredNotifier::Reception::Alone) {
+        return true;
+      }
+
+      return core::SdlWidget::repaintEvent(e);
+    }
+
+    void
+    Slider::drawSlider(const utils::Uuid& uuid,
+                       const utils::Boxf& area)
+    {
       // Load the slider's visuals if needed.
       if (sliderChanged()) {
         loadSlider();
@@ -68,6 +136,9 @@ namespace sdl {
         m_sliderChanged = false;
       }
 
+      // Draw the current value.
+      drawValue(uuid, area);
+
       // Repaint mobile parts to their specified position. We need to
       // only consider the input `area` to be repainted: if the visuals
       // do not intersect with it we don't need to repaint it.
@@ -96,7 +167,8 @@ namespace sdl {
         getEngine().drawTexture(m_rulerLine, &sRLEngine, &uuid, &dRLEngine);
       }
       if (sMAEngine.valid() && dMAEngine.valid()) {
-        getEngine().drawTexture(m_mobileArea, &sMAEngine, &uuid, &dMAEngine);
+        const utils::Uuid& ma = (m_highlighted ? m_mobileAreaHighlight : m_mobileArea);
+        getEngine().drawTexture(ma, &sMAEngine, &uuid, &dMAEngine);
       }
     }
 
@@ -153,8 +225,21 @@ namespace sdl {
       // will use the position of the button when it was released and
       // compare it to the internal position saved for each element.
       // Also we don't want to handle events where the mouse button
-      // release event was actually issued after a drag event.
+      // release event was actually issued after a drag event. In this
+      // case the mobile area is only highlighted if the mouse is still
+      // over it.
       if (e.wasDragged()) {
+        utils::Vector2f local = mapFromGlobal(e.getMousePosition());
+
+        Guard guard(m_propsLocker);
+
+        bool highlighted = m_data.maBox.contains(local);
+
+        if (highlighted != m_highlighted) {
+          m_highlighted = highlighted;
+          requestRepaint();
+        }
+
         return core::SdlWidget::mouseButtonReleaseEvent(e);
       }
 
@@ -263,6 +348,12 @@ namespace sdl {
       // Assign the value and request a repaint if needed.
       bool update = performAction(Action::Move, desired);
 
+      // The mobile area stays highlighted while being dragged.
+      if (!m_highlighted) {
+        m_highlighted = true;
+        update = true;
+      }
+
       if (update) {
         requestRepaint();
       }
@@ -271,10 +362,45 @@ namespace sdl {
       return core::SdlWidget::mouseDragEvent(e);
     }
 
+    bool
+    Slider::mouseMoveEvent(const core::engine::MouseEvent& e) {
+      // Highlight the mobile area if the mouse is over it. Note that this does
+      // not modify any texture: the highlighted version of the mobile area is
+      // already available.
+      utils::Vector2f local = mapFromGlobal(e.getMousePosition());
+
+      // Acquire the lock on the data contained in this widget.
+      Guard guard(m_propsLocker);
+
+      bool highlighted = m_data.maBox.contains(local);
+
+      if (highlighted != m_highlighted) {
+        m_highlighted = highlighted;
+        requestRepaint();
+      }
+
+      // Use the base handler to provide a return value.
+      return core::SdlWidget::mouseMoveEvent(e);
+    }
+
     void
-    Slider::build(const std::string& font,
-                  unsigned size)
+    Slider::stateUpdatedFromFocus(const core::FocusState& state,
+                                  bool gainedFocus)
     {
+      // Use the base handler.
+      core::SdlWidget::stateUpdatedFromFocus(state, gainedFocus);
+
+      // Reset the highlight of the mobile area upon losing focus.
+      Guard guard(m_propsLocker);
+
+      if (!state.hasFocus() && m_highlighted) {
+        m_highlighted = false;
+        requestRepaint();
+      }
+    }
+
+    void
+    Slider::build() {
       // Assign a linear layout which will allow positionning the slider's
       // elements along the label widget representing the current value.
       sdl::graphic::LinearLayoutShPtr layout = std::make_shared<sdl::graphic::LinearLayout>(
@@ -301,21 +427,20 @@ namespace sdl {
         );
       }
 
-      // Create the label indicating the current slider's value and set
-      // it to display the provided value.
-      LabelWidget* label = new LabelWidget(
-        getValueLabelName(),
-        stringifyValue(getValueFromRangeData(m_data), m_decimals),
-        font,
-        size,
-        LabelWidget::HorizontalAlignment::Left,
-        LabelWidget::VerticalAlignment::Center,
-        this
+      // Create the virtual item holding the space used to display the
+      // current slider's value. The value is drawn directly from glyphs
+      // rather than through a label widget: this avoids rendering a new
+      // texture each time the value changes.
+      m_valueItem = std::make_shared<VirtualLayoutItem>(
+        std::string("vitem_for_value"),
+        utils::Sizef(),
+        utils::Sizef(),
+        utils::Sizef(getValueLabelMaxWidth(), std::numeric_limits<float>::max())
       );
-      if (label == nullptr) {
+      if (m_valueItem == nullptr) {
         error(
           std::string("Could not create slider \"") + getName() + "\"",
-          std::string("Could not allocate slider's value label")
+          std::string("Could not allocate slider's value area")
         );
       }
 
@@ -323,17 +448,12 @@ namespace sdl {
       m_sliderItem->setManageWidth(true);
       m_sliderItem->setManageHeight(true);
 
-      label->setMaxSize(
-        utils::Sizef(
-          getValueLabelMaxWidth(),
-          std::numeric_limits<float>::max()
-        )
-      );
-      label->setPalette(getPalette());
+      m_valueItem->setManageWidth(true);
+      m_valueItem->setManageHeight(true);
 
-      // Build up the layout with the slider's box and the value label.
+      // Build up the layout with the slider's box and the value area.
       layout->addItem(m_sliderItem.get());
-      layout->addItem(label);
+      layout->addItem(m_valueItem.get());
     }
 
     void
@@ -389,13 +509,28 @@ namespace sdl {
 
       m_mobileArea = getEngine().createTextureFromBrush(bMobileArea);
 
+      // Create the highlighted version of the mobile area: it uses the same
+      // brush settings with the highlight color.
+      core::engine::BrushShPtr bMobileAreaHighlight = std::make_shared<core::engine::Brush>(
+        std::string("mah_brush_for_") + getName(),
+        false
+      );
+
+      bMobileAreaHighlight->setClearColor(getPalette().getColorForRole(core::engine::Palette::ColorRole::Highlight));
+      bMobileAreaHighlight->create(
+        m_data.maBox.toSize(),
+        true
+      );
+
+      m_mobileAreaHighlight = getEngine().createTextureFromBrush(bMobileAreaHighlight);
+
       if (!m_rulerLine.valid()) {
         error(
           std::string("Could not load slider's visuals"),
           std::string("Invalid ruler line texture")
         );
       }
-      if (!m_mobileArea.valid()) {
+      if (!m_mobileArea.valid() || !m_mobileAreaHighlight.valid()) {
         error(
           std::string("Could not load slider's visuals"),
           std::string("Invalid mobile area texture")
@@ -408,6 +543,108 @@ namespace sdl {
       updateSliderPosFromValue();
     }
 
+    void
+    Slider::loadGlyphs() {
+      // Clear existing glyphs.
+      clearGlyphs();
+
+      // Borrow the font from the registry: sliders sharing the same font also
+      // share the glyphs through the text cache.
+      m_font = FontRegistry::getInstance().acquire(getEngine(), m_fontName, m_fontSize, getPalette());
+
+      if (!m_font.valid()) {
+        error(
+          std::string("Could not load slider's glyphs"),
+          std::string("Invalid null font")
+        );
+      }
+
+      const std::string chars(getGlyphsCharacters());
+
+      for (unsigned id = 0u ; id < chars.size() ; ++id) {
+        Glyph glyph{
+          TextCache::getInstance().acquireText(
+            getEngine(),
+            chars.substr(id, 1u),
+            m_font,
+            core::engine::Palette::ColorRole::WindowText
+          ),
+          utils::Sizef()
+        };
+
+        if (glyph.texture.valid()) {
+          glyph.size = getEngine().queryTexture(glyph.texture);
+        }
+
+        m_glyphs.push_back(glyph);
+      }
+    }
+
+    void
+    Slider::clearGlyphs() {
+      for (unsigned id = 0u ; id < m_glyphs.size() ; ++id) {
+        if (m_glyphs[id].texture.valid()) {
+          TextCache::getInstance().release(m_glyphs[id].texture);
+        }
+      }
+
+      m_glyphs.clear();
+
+      if (m_font.valid()) {
+        FontRegistry::getInstance().release(m_font);
+        m_font.invalidate();
+      }
+    }
+
+    void
+    Slider::drawValue(const utils::Uuid& uuid,
+                      const utils::Boxf& area)
+    {
+      // Load the glyphs if needed: this only happens once.
+      if (m_glyphs.empty()) {
+        loadGlyphs();
+      }
+
+      // Rebuild the text if the value changed since it was last drawn. This
+      // does not create any texture as the text is drawn from the glyphs.
+      if (m_textValue != m_data.value) {
+        stringifyValue(getValueFromRangeData(m_data), m_decimals, m_text);
+        m_textValue = m_data.value;
+      }
+
+      // The text is left aligned and vertically centered in the value area.
+      utils::Boxf valueArea = m_valueItem->getRenderingArea();
+
+      utils::Sizef sizeEnv = getEngine().queryTexture(uuid);
+      float x = valueArea.getLeftBound();
+
+      // Draw each glyph: only the part intersecting both the value area and
+      // the input `area` is drawn.
+      for (unsigned id = 0u ; id < m_text.size() && x < valueArea.getRightBound() ; ++id) {
+        int glyph = getGlyphIndex(m_text[id]);
+        if (glyph < 0 || !m_glyphs[glyph].texture.valid()) {
+          continue;
+        }
+
+        const Glyph& g = m_glyphs[glyph];
+
+        utils::Boxf whereTo(utils::Vector2f(x + g.size.w() / 2.0f, valueArea.getCenter().y()), g.size);
+        x += g.size.w();
+
+        utils::Boxf dstRect = whereTo.intersect(valueArea).intersect(area);
+        if (!dstRect.valid()) {
+          continue;
+        }
+
+        utils::Boxf srcRect = convertToLocal(dstRect, whereTo);
+
+        utils::Boxf srcEngine = convertToEngineFormat(srcRect, g.size);
+        utils::Boxf dstEngine = convertToEngineFormat(dstRect, sizeEnv);
+
+        getEngine().drawTexture(g.texture, &srcEngine, &uuid, &dstEngine);
+      }
+    }
+
     void
     Slider::updateSliderPosFromValue() {
       // Unlike some other scrollable components the slider only allows discrete
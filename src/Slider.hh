@@ -2,9 +2,13 @@
 # define   SLIDER_HH
 
 # include <memory>
+# include <string>
+# include <vector>
 # include <sdl_core/SdlWidget.hh>
 # include "VirtualLayoutItem.hh"
-# include "LabelWidget.hh"
+# include "FontRegistry.hh"
+# include "TextCache.hh"
+# include "DeferredNotifier.hh"
 # include <core_utils/Signal.hh>
 
 namespace sdl {
@@ -75,6 +79,18 @@ namespace sdl {
         drawContentPrivate(const utils::Uuid& uuid,
                            const utils::Boxf& area) override;
 
+        /**
+         * @brief - Reimplementation of the base `SdlWidget` method to notify the listeners
+         *          upon receiving the event posted when the value changed. The changes that
+         *          happened since this event was posted are reported at once with the latest
+         *          value, whether or not a frame is drawn in the meantime. This event does
+         *          not trigger a repaint on its own.
+         * @param e - the paint event to process.
+         * @return - `true` if the event was recognized and `false` otherwise.
+         */
+        bool
+        repaintEvent(const core::engine::PaintEvent& e) override;
+
         /**
          * @brief - Reimplementation of the base `EngineObject` method to provide
          *          specific behavior upon detecting a key event.
@@ -119,6 +135,28 @@ namespace sdl {
         bool
         mouseDragEvent(const core::engine::MouseEvent& e) override;
 
+        /**
+         * @brief - Reimplementation of the base `EngineObject` method to highlight the
+         *          mobile area when the mouse hovers over it.
+         * @param e - the event to be interpreted.
+         * @return - `true` if the event was recognized, `false` otherwise.
+         */
+        bool
+        mouseMoveEvent(const core::engine::MouseEvent& e) override;
+
+        /**
+         * @brief - Reimplementation of the base `core::SdlWidget` method in order to detect
+         *          when the focus is lost. This allows to reset the highlight of the mobile
+         *          area.
+         * @param state - the current internal state which we will use to detect complete
+         *                loss of focus.
+         * @param gainedFocus - `true` if this method was triggered from a gain focus event
+         *                      and `false` otherwise.
+         */
+        void
+        stateUpdatedFromFocus(const core::FocusState& state,
+                              bool gainedFocus) override;
+
       private:
 
         /**
@@ -179,17 +217,6 @@ namespace sdl {
         float
         getGlobalMargins() noexcept;
 
-        /**
-         * @brief - Used to retrieve a default name to assign to the label widget holding
-         *          the current value of the slider. Using the name provided by this method
-         *          allows for consistent naming all across the component.
-         * @return - a name suited to represent the label holding the current value of the
-         *           slider.
-         */
-        static
-        const char*
-        getValueLabelName() noexcept;
-
         /**
          * @brief - Used to provide a suitable maximum width for the value label. Indeed it
          *          should not benefit from growing too much as its main goal is only to be
@@ -276,37 +303,85 @@ namespace sdl {
 
         /**
          * @brief - Perform the conversion of the input `value` to a string with the specified
-         *          number of decimals.
+         *          number of decimals. The text is assigned to the `out` string so that its
+         *          storage can be reused.
          * @param value - the value to convert.
          * @param decimals - the number of decimals to use to represent the value.
-         * @return - the string representing the `value` with the specified number of decimals.
+         * @param out - the string receiving the text representing the `value` with the
+         *              specified number of decimals.
          */
         static
-        std::string
+        void
         stringifyValue(float value,
-                       unsigned decimals) noexcept;
+                       unsigned decimals,
+                       std::string& out);
+
+        /**
+         * @brief - Retrieves the characters which can be displayed in the value label. Each
+         *          one is rendered once in a glyph texture and the label is drawn by putting
+         *          these glyphs side by side.
+         * @return - the characters for which a glyph is created.
+         */
+        static
+        const char*
+        getGlyphsCharacters() noexcept;
+
+        /**
+         * @brief - Retrieves the index of the glyph representing the input character. A
+         *          negative value is returned if no glyph exists for this character.
+         * @param c - the character for which the glyph should be retrieved.
+         * @return - the index of the glyph or a negative value.
+         */
+        static
+        int
+        getGlyphIndex(char c) noexcept;
 
         /**
          * @brief - Used internally upon constructing the slider to initialize internal
          *          states.
-         * @param font - the font to use when creating the label displaying the current
-         *               slider's value.
-         * @param size - the size of the font to use.
          */
         void
-        build(const std::string& font,
-              unsigned size);
+        build();
 
         /**
-         * @brief - Used to retrieve the label widget displaying the current slider's value.
-         *          This method can be used in case the label should be fetched to update its
-         *          value for example.
-         *          This method is merely a wrapper around the `getChildAs` method and is
-         *          guaranteed to return a valid value if it returns.
-         * @return - the label widget holding the current slider's value.
+         * @brief - Performs the drawing of the slider's elements and of its value on the
+         *          canvas. Only the specified part is updated by this function.
+         *          Note that the locker is assumed to already be acquired.
+         * @param uuid - the identifier of the canvas onto which the slider is drawn.
+         * @param area - the area of the canvas to update.
          */
-        LabelWidget*
-        getValueLabel();
+        void
+        drawSlider(const utils::Uuid& uuid,
+                   const utils::Boxf& area);
+
+        /**
+         * @brief - Used to create the glyphs used to represent the value of the slider. The
+         *          glyphs are retrieved from the text cache so that sliders sharing the same
+         *          font also share them. Any existing glyph is released.
+         *          Note that the locker is assumed to already be acquired.
+         */
+        void
+        loadGlyphs();
+
+        /**
+         * @brief - Gives back the glyphs and the font used to represent the value of this
+         *          slider.
+         *          Note that the locker is assumed to already be acquired.
+         */
+        void
+        clearGlyphs();
+
+        /**
+         * @brief - Used to draw the text representing the current value of the slider from
+         *          the glyphs. Only the part of the text intersecting the input `area` is
+         *          drawn. Characters for which no glyph exist are skipped.
+         *          Note that the locker is assumed to already be acquired.
+         * @param uuid - the identifier of the canvas onto which the text is drawn.
+         * @param area - the area of the canvas to update.
+         */
+        void
+        drawValue(const utils::Uuid& uuid,
+                  const utils::Boxf& area);
 
         /**
          * @brief - Describes whether the slider's elements should be repainted. It usually
@@ -407,6 +482,10 @@ namespace sdl {
          *          defined by the object.
          *          If the value is different from the current one a `valueChanged`
          *          signal is emitted.
+         *          Note that the signal is not emitted right away: an event is posted
+         *          and several changes can happen before it is received (typically
+         *          when the slider is dragged). The listeners are only notified of
+         *          the last one.
          *          Note that this method assumes that the locker protecting this
          *          object from concurrent accesses is already locked.
          * @param value - the value to be assigned to this scroll bar's step. It
@@ -480,6 +559,52 @@ namespace sdl {
          */
         utils::Uuid m_mobileArea;
 
+        /**
+         * @brief - A version of the mobile area used when it is highlighted, i.e. when the
+         *          mouse hovers over it or drags it. Both textures are created from brushes
+         *          sharing the same settings so that highlighting the mobile area only changes
+         *          which one is drawn. The highlight is reset when a drag ends outside of the
+         *          mobile area.
+         */
+        utils::Uuid m_mobileAreaHighlight;
+        bool m_highlighted;
+
+        /**
+         * @brief - A virtual layout item representing the area where the current value of
+         *          the slider is displayed.
+         */
+        VirtualLayoutItemShPtr m_valueItem;
+
+        /**
+         * @brief - Describes a glyph used to represent the value of the slider.
+         */
+        struct Glyph {
+          utils::Uuid texture;
+          utils::Sizef size;
+        };
+
+        /**
+         * @brief - The properties of the font used to render the glyphs, the glyphs themselves
+         *          and the text currently displayed along with the step it represents. The text
+         *          is only rebuilt when the value changed since it was last drawn: this never
+         *          requires to create a texture.
+         */
+        std::string m_fontName;
+        unsigned m_fontSize;
+        utils::Uuid m_font;
+
+        std::vector<Glyph> m_glyphs;
+
+        std::string m_text;
+        int m_textValue;
+
+        /**
+         * @brief - Whether the value changed since the last notification of the listeners
+         *          and the notifier used to be called back to notify them.
+         */
+        bool m_notifyPending;
+        DeferredNotifier m_notifier;
+
       public:
 
         /**
@@ -2,8 +2,7 @@
 # define   SLIDER_HXX
 
 # include "Slider.hh"
-# include <sstream>
-# include <iomanip>
+# include "NumericText.hh"
 
 namespace sdl {
   namespace graphic {
@@ -14,6 +13,7 @@ namespace sdl {
       Guard guard(m_propsLocker);
 
       clearSlider();
+      clearGlyphs();
     }
 
     inline
@@ -58,12 +58,6 @@ namespace sdl {
       return 5.0f;
     }
 
-    inline
-    const char*
-    Slider::getValueLabelName() noexcept {
-      return "slider_value_label";
-    }
-
     inline
     float
     Slider::getValueLabelMaxWidth() noexcept {
@@ -117,20 +111,38 @@ namespace sdl {
     }
 
     inline
-    std::string
+    void
     Slider::stringifyValue(float value,
-                           unsigned decimals) noexcept
+                           unsigned decimals,
+                           std::string& out)
     {
-      std::stringstream ss;
-      ss << std::setprecision(decimals) << value;
+      // The value is always displayed with the requested number of decimals
+      // so that only digits, the sign and the decimal point are needed. The
+      // storage of the output string is reused across updates.
+      number::toFixed(value, decimals, out);
+    }
 
-      return ss.str();
+    inline
+    const char*
+    Slider::getGlyphsCharacters() noexcept {
+      return "0123456789-.";
     }
 
     inline
-    LabelWidget*
-    Slider::getValueLabel() {
-      return getChildAs<LabelWidget>(getValueLabelName());
+    int
+    Slider::getGlyphIndex(char c) noexcept {
+      if (c >= '0' && c <= '9') {
+        return c - '0';
+      }
+
+      switch (c) {
+        case '-':
+          return 10;
+        case '.':
+          return 11;
+        default:
+          return -1;
+      }
     }
 
     inline
@@ -162,6 +174,11 @@ namespace sdl {
         getEngine().destroyTexture(m_mobileArea);
         m_mobileArea.invalidate();
       }
+
+      if (m_mobileAreaHighlight.valid()) {
+        getEngine().destroyTexture(m_mobileAreaHighlight);
+        m_mobileAreaHighlight.invalidate();
+      }
     }
 
     inline
@@ -257,34 +274,23 @@ namespace sdl {
         if (old != m_data.value) {
           update = true;
 
-          // Fire the signal to indicate that the value has been changed
-          // after converting to percentage.
+          // The signal indicating that the value has been changed is
+          // fired when the notification event is received: all the
+          // changes happening until then are reported at once with
+          // the latest value.
           if (notify) {
-            float value = getValueFromRangeData(m_data);
+            m_notifyPending = true;
 
-            // Update the label's text.
-            LabelWidget* label = getValueLabel();
-            if (label != nullptr) {
-              label->setText(stringifyValue(value, m_decimals));
-            }
+            std::shared_ptr<core::engine::PaintEvent> pe = m_notifier.request(this);
 
-            log(
-              "Emitting on value changed for " + getName() + " with range " +
-              m_data.range.toString() + ", steps: " + std::to_string(m_data.steps) +
-              " (current: " + std::to_string(m_data.value) + ", page: " + std::to_string(m_data.pageStep) + ")" +
-              " value: " + std::to_string(value),
-              utils::Level::Verbose
-            );
-
-            onValueChanged.safeEmit(
-              std::string("onValueChanged(") + std::to_string(value) + ")",
-              value
-            );
+            if (pe != nullptr) {
+              postEvent(pe);
+            }
           }
 
           // Also request a repaint to indicate that the slider should
           // be updated: indeed it probably means that the mobile area
-          // should be updated.
+          // and the text should be updated.
           requestRepaint();
         }
       }
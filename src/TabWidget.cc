@@ -13,7 +13,13 @@ namespace sdl {
       m_tabLayout(tabLayout),
       m_titlesLayout(nullptr),
       m_tabCount(0u),
-      m_tabs()
+      m_tabs(),
+      m_titles(),
+      m_firstVisibleTab(0),
+      m_prebuildAdjacent(false),
+      m_prebuildPending(false),
+      m_titlesPending(false),
+      m_frameNotifier()
     {
       build();
     }
@@ -33,11 +39,6 @@ namespace sdl {
         );
       }
 
-      // We only need to insert a tab title if the tab to insert is
-      // not alone in the widget. Indeed if we only have one tab we
-      // want to maximize the area available for the content and thus
-      // we don't display any title.
-
       // Compute the tab's title: either the provided `text` or
       // the name of the widget.
       std::string title = text;
@@ -45,39 +46,74 @@ namespace sdl {
         title = item->getName();
       }
 
-      if (m_tabs.empty()) {
-        // Insert the tab into the internal `m_tabs` array but do not
-        // trigger the creation of a title widget.
-        m_tabs.push_back(
-          TabInfo{
-            item->getName(),
-            getTitleNameFromTabID(),
-            title
-          }
+      // Register the tab in the internal `m_tabs` array: the index
+      // is only a loose description of the position of the tab so
+      // we need to clamp it.
+      index = std::max(0, std::min(index, getTabsCount()));
+
+      m_tabs.insert(
+        m_tabs.begin() + index,
+        TabInfo{
+          item->getName(),
+          title,
+          TabFactory()
+        }
+      );
+
+      // Keep the titles currently displayed in place if the tab is
+      // inserted before them.
+      if (index < m_firstVisibleTab) {
+        ++m_firstVisibleTab;
+      }
+
+      // Insert the widget into the selector layout.
+      getSelector().insertWidget(item, index);
+
+      // Only the titles currently displayed need to be updated: this
+      // includes creating the title widgets if the tabs do not fill
+      // the titles bar yet. Note that we only need to display titles
+      // if the tab to insert is not alone in the widget. Indeed if we
+      // only have one tab we want to maximize the area available for
+      // the content and thus we don't display any title.
+      updateTitles();
+      ensureTitleVisible(getSelector().getActiveItem());
+    }
+
+    void
+    TabWidget::insertTab(int index,
+                         const TabFactory& factory,
+                         const std::string& text)
+    {
+      // Check trivial case where the factory is not valid.
+      if (!factory) {
+        error(
+          std::string("Cannot insert lazy tab \"") + text + "\" in tabwidget",
+          std::string("Invalid null factory")
         );
       }
-      else {
-        // Check whether we should create the first item title widget:
-        // this occurs when we are inserting the second tab into this
-        // widget.
-        if (m_tabs.size() == 1u) {
-          createTitleForWidget(0u, m_tabs[0].tabName, m_tabs[0].itemName, item->getPalette(), false);
-        }
 
-        // Use the dedicated handler to create the title widget for the
-        // input `index`.
-        createTitleForWidget(index, title, item->getName(), item->getPalette());
+      // Create the placeholder for the tab: it is an empty widget which will
+      // be replaced by the content of the tab once created.
+      core::SdlWidget* page = new core::SdlWidget(
+        getPageNameFromTabID(),
+        utils::Sizef(),
+        nullptr
+      );
+
+      // Insert the placeholder as a regular tab.
+      insertTab(index, page, text.empty() ? page->getName() : text);
 
-        // Activate the titles layout if needed (i.e. if at least two
-        // tabs have been registered into this widget).
-        if (m_tabs.size() > 1u) {
-          m_titlesLayout->setVisible(true);
-          invalidate();
+      // Register the factory for this tab.
+      for (unsigned id = 0u ; id < m_tabs.size() ; ++id) {
+        if (m_tabs[id].itemName == page->getName()) {
+          m_tabs[id].factory = factory;
         }
       }
 
-      // First insert the widget into the selector layout.
-      getSelector().insertWidget(item, index);
+      // In case the tab is the active one, build it right away.
+      if (buildTab(getSelector().getActiveItem())) {
+        m_prebuildPending = m_prebuildAdjacent;
+      }
     }
 
     void
@@ -92,10 +128,9 @@ namespace sdl {
 
       // In order to remove this item we need to do two things:
       // 1. remove the item from the children of this widget.
-      // 2. remove the title associated to this widget from the
-      //    titles bar.
-      // 3. update the internal `m_tabs` array to reflect the
+      // 2. update the internal `m_tabs` array to reflect the
       //    removed item.
+      // 3. update the titles displayed in the titles bar.
 
       // 1. Remove the item from the selector layout. To do so
       // we need first to retrieve the child associated to the
@@ -110,19 +145,35 @@ namespace sdl {
         );
       }
 
-      getSelector().removeItem(item);
+      // The placeholder of a tab which has not been built yet is owned by
+      // this widget: the caller never had access to it so we need to delete
+      // it once removed.
+      const bool placeholder = static_cast<bool>(m_tabs[index].factory);
 
-      // 2. Remove the item from the titles layout if needed.
-      // We will also make the titles layout hidden if the tabs
-      // count drop to less than 2.
-      m_titlesLayout->removeItemFromIndex(index);
+      getSelector().removeItem(item);
 
-      if (getTabsCount() == 1) {
-        m_titlesLayout->setVisible(false);
+      if (placeholder) {
+        delete item;
       }
 
-      // 3. Update the internal `m_tabs` array.
+      // 2. Update the internal `m_tabs` array. We also keep the
+      // titles currently displayed in place if the tab was before
+      // them.
       removeIndexFromInternal(index);
+
+      if (index < m_firstVisibleTab) {
+        --m_firstVisibleTab;
+      }
+
+      // 3. Update the titles: the titles bar will be hidden if the
+      // tabs count drops to less than 2.
+      m_firstVisibleTab = clampFirstVisibleTab(m_firstVisibleTab);
+
+      updateTitles();
+
+      if (getTabsCount() > 0) {
+        ensureTitleVisible(getSelector().getActiveItem());
+      }
     }
 
     void
@@ -294,97 +345,95 @@ namespace sdl {
     }
 
     void
-    TabWidget::createTitleForWidget(int index,
-                                    const std::string& text,
-                                    const std::string& item,
-                                    const core::engine::Palette& palette,
-                                    bool updateIDs)
-    {
-      // Create the label widget which will represent this widget in the
-      // title's bar. We need either to compute it or to retrieve it from
-      // the existing values in the case `updateIDs` is set to `false`.
-      std::string name;
-      if (updateIDs) {
-        name = getTitleNameFromTabID();
-      }
-      else {
-        name = m_tabs[index].titleWidgetName;
-      }
-
+    TabWidget::createTitle(int slot) {
+      // Create the label widget which will represent a tab in the title's
+      // bar. Its text is assigned when binding it to a tab.
       LabelWidget* titleWidget = new LabelWidget(
-        name,
-        text,
+        getTitleNameFromSlot(slot),
+        std::string(),
         std::string("data/fonts/times.ttf"),
         10,
         LabelWidget::HorizontalAlignment::Center,
         LabelWidget::VerticalAlignment::Center,
         this
       );
-      titleWidget->setPalette(palette);
 
       // Allow hover focus on titles.
       titleWidget->setFocusPolicy(core::FocusPolicy(core::focus::Type::Hover));
 
-      // In order to correctly insert the item into the tabwidget we need
-      // to both insert its representation into the selector layout but
-      // also to insert the corresponding title in the bar.
-      m_titlesLayout->addItem(titleWidget, index);
+      // Titles are always appended to the bar: their index in the layout
+      // is the index of the slot.
+      m_titlesLayout->addItem(titleWidget);
 
       // Register the click on the title widget so that we can update the
       // displayed widget in the internal selector.
       titleWidget->onClick.connect_member<TabWidget>(this, &TabWidget::onTitleClicked);
 
-      // We also need to update the internal array of associations between
-      // the names of the tab and their indices.
-      // Return early if none of this is needed.
-      if (!updateIDs) {
-        return;
+      m_titles.push_back(titleWidget);
+    }
+
+    void
+    TabWidget::updateTitles() {
+      const int count = getVisibleTitlesCount();
+
+      // Create the missing title widgets: this only happens until the
+      // titles bar is full, after which the existing ones are reused.
+      while (static_cast<int>(m_titles.size()) < count) {
+        createTitle(m_titles.size());
       }
 
-      // Create the new version of the tabs data.
-      Tabs newTabs(m_tabs.size() + 1u);
+      // Bind each title to the tab it should display: the titles which
+      // do not correspond to any tab are hidden.
+      for (int slot = 0 ; slot < static_cast<int>(m_titles.size()) ; ++slot) {
+        LabelWidget* title = m_titles[slot];
 
-      for (int i = 0u ; i < static_cast<int>(m_tabs.size()) ; ++i) {
-        // We need to keep the name of the tab at the same position if its
-        // index is smaller than the input `index` and move it one setp
-        // further if it is greater.
-        if (i < index) {
-          newTabs[i] = m_tabs[i];
+        if (slot >= count) {
+          title->setVisible(false);
+          continue;
         }
-        else {
-          newTabs[i + 1] = m_tabs[i];
+
+        const TabInfo& tab = m_tabs[m_firstVisibleTab + slot];
+
+        // Use the current palette of the tab: it may have changed since
+        // the tab was inserted.
+        core::SdlWidget* item = getChildOrNull<core::SdlWidget>(tab.itemName);
+        if (item != nullptr) {
+          title->setPalette(item->getPalette());
         }
+
+        title->setText(tab.tabName);
+        title->setVisible(true);
       }
-      newTabs[index] = TabInfo{
-        item,
-        name,
-        text
-      };
 
-      m_tabs.swap(newTabs);
+      // Activate the titles layout if needed (i.e. if at least two
+      // tabs have been registered into this widget).
+      const bool visible = (count > 0);
+
+      if (m_titlesLayout->isVisible() != visible) {
+        m_titlesLayout->setVisible(visible);
+        invalidate();
+      }
     }
 
     void
     TabWidget::onTitleClicked(const std::string& name) {
-      // Retrieve the index of the tab based on the name of the title widget which has
-      // been clicked.
-
-      int id = 0;
+      // Retrieve the slot of the title widget which has been clicked: the
+      // index of the tab can be deduced from it.
+      int slot = 0;
       bool found = false;
-      while (!found && id < getTabsCount()) {
-        log("Trying to activate \"" + name + "\", item " + std::to_string(id) + " has item name \"" + m_tabs[id].itemName + "\" and tab name \"" + m_tabs[id].tabName + "\" and title name \"" + m_tabs[id].titleWidgetName + "\"", utils::Level::Verbose);
-        if (m_tabs[id].titleWidgetName == name) {
+      while (!found && slot < static_cast<int>(m_titles.size())) {
+        if (m_titles[slot]->getName() == name) {
           found = true;
         }
         else {
-          ++id;
+          ++slot;
         }
       }
 
-      log("Clicked on tab " + name + " which is on id " + std::to_string(id));
+      const int id = m_firstVisibleTab + slot;
 
       // Check for errors.
-      if (!found) {
+      if (!found || id >= getTabsCount()) {
         log(
           std::string("Could not activate widget from clicked title \"") + name + "\"",
           utils::Level::Warning
@@ -392,8 +441,176 @@ namespace sdl {
         return;
       }
 
-      // Activate the item.
+      // Create the content of the tab if needed and activate it.
+      buildTab(id);
+
       getSelector().setActiveWidget(id);
+
+      log("Clicked on tab " + name + " which is on id " + std::to_string(id), utils::Level::Verbose);
+
+      // Keep the title of the active tab in view.
+      ensureTitleVisible(id);
+
+      // The adjacent tabs will be created once this one has been displayed.
+      if (m_prebuildAdjacent) {
+        m_prebuildPending = true;
+        requestRepaint();
+      }
+    }
+
+    void
+    TabWidget::drawContentPrivate(const utils::Uuid& /*uuid*/,
+                                  const utils::Boxf& /*area*/)
+    {
+      // Nothing to do if the adjacent tabs do not need to be created and
+      // the titles are up to date.
+      if (!m_prebuildPending && !m_titlesPending) {
+        return;
+      }
+
+      // The active tab is being displayed: the adjacent tabs can be created
+      // and the titles updated once the frame is over. This can't be done
+      // while drawing as it would modify the hierarchy of widgets.
+      std::shared_ptr<core::engine::PaintEvent> pe = m_frameNotifier.request(this);
+
+      if (pe != nullptr) {
+        postEvent(pe);
+      }
+    }
+
+    bool
+    TabWidget::repaintEvent(const core::engine::PaintEvent& e) {
+      // Only handle the event posted after a frame has been drawn.
+      const DeferredNotifier::Reception frame = m_frameNotifier.receive(e, this);
+
+      if (frame == DeferredNotifier::Reception::None) {
+        return core::SdlWidget::repaintEvent(e);
+      }
+
+      // Bind the titles to the number of slots now available in the bar.
+      if (m_titlesPending) {
+        m_titlesPending = false;
+
+        m_firstVisibleTab = clampFirstVisibleTab(m_firstVisibleTab);
+        updateTitles();
+
+        if (getTabsCount() > 0) {
+          ensureTitleVisible(getSelector().getActiveItem());
+        }
+      }
+
+      // Create one of the adjacent tabs: if one was indeed created there might
+      // be another one so we request a new frame.
+      m_prebuildPending = m_prebuildPending && buildAdjacentTab();
+
+      if (m_prebuildPending) {
+        requestRepaint();
+      }
+
+      if (frame == DeferredNotifier::Reception::Alone) {
+        return true;
+      }
+
+      return core::SdlWidget::repaintEvent(e);
+    }
+
+    void
+    TabWidget::updatePrivate(const utils::Boxf& window) {
+      core::SdlWidget::updatePrivate(window);
+
+      // The titles need to be updated if the number of titles displayed
+      // in the bar changes with the new size.
+      const int count = std::min(getTabsCount(), getMaximumVisibleTitles());
+      const int bound = static_cast<int>(
+        std::count_if(
+          m_titles.cbegin(),
+          m_titles.cend(),
+          [](const LabelWidget* title) {
+            return title->isVisible();
+          }
+        )
+      );
+
+      if (getTabsCount() >= 2 && count != bound) {
+        m_titlesPending = true;
+        requestRepaint();
+      }
+    }
+
+    bool
+    TabWidget::mouseWheelEvent(const core::engine::MouseEvent& e) {
+      // Scroll through the titles if the mouse is over the titles bar: the
+      // wheel event is otherwise meant for the content of the tabs or for
+      // another widget.
+      if (getVisibleTitlesCount() == 0 || !isMouseInside()) {
+        return core::SdlWidget::mouseWheelEvent(e);
+      }
+
+      utils::Vector2f local = mapFromGlobal(e.getMousePosition());
+
+      if (!m_titlesLayout->getRenderingArea().contains(local)) {
+        return core::SdlWidget::mouseWheelEvent(e);
+      }
+
+      // Positive scroll values correspond to the wheel being rolled up which
+      // should display the titles located before the first visible one. Both
+      // axes are considered so that horizontal scrolling is also possible.
+      utils::Vector2i scroll = e.getScroll();
+
+      scrollTitles(-scroll.x() - scroll.y());
+
+      // Use the base handler to provide a return value.
+      return core::SdlWidget::mouseWheelEvent(e);
+    }
+
+    bool
+    TabWidget::buildTab(int index) {
+      // Check whether the tab needs to be created.
+      if (index < 0 || index >= getTabsCount() || !m_tabs[index].factory) {
+        return false;
+      }
+
+      // Retrieve the placeholder for this tab.
+      core::SdlWidget* page = getChildAs<core::SdlWidget>(m_tabs[index].itemName);
+
+      // Create the content and release the factory: it will not be needed
+      // anymore.
+      TabFactory factory;
+      factory.swap(m_tabs[index].factory);
+
+      core::SdlWidget* content = factory();
+
+      if (content == nullptr) {
+        error(
+          std::string("Could not build tab \"") + m_tabs[index].tabName + "\"",
+          std::string("Factory returned a null widget")
+        );
+      }
+
+      log("Built content for tab \"" + m_tabs[index].tabName + "\"", utils::Level::Verbose);
+
+      // Replace the placeholder with the content in the selector. We need to
+      // preserve the active tab as the selector may update it.
+      SelectorWidget& selector = getSelector();
+      const int active = selector.getActiveItem();
+
+      selector.removeItem(page);
+      selector.insertWidget(content, index);
+      selector.setActiveWidget(active);
+
+      // The placeholder is not a child of this widget anymore.
+      delete page;
+
+      m_tabs[index].itemName = content->getName();
+
+      return true;
+    }
+
+    bool
+    TabWidget::buildAdjacentTab() {
+      const int active = getSelector().getActiveItem();
+
+      return buildTab(active + 1) || buildTab(active - 1);
     }
 
     void
@@ -1,11 +1,16 @@
 #ifndef    TAB_WIDGET_HH
 # define   TAB_WIDGET_HH
 
+# include <cmath>
 # include <memory>
 # include <vector>
+# include <algorithm>
+# include <functional>
 # include <sdl_core/SdlWidget.hh>
 # include "LinearLayout.hh"
+# include "LabelWidget.hh"
 # include "SelectorWidget.hh"
+# include "DeferredNotifier.hh"
 
 namespace sdl {
   namespace graphic {
@@ -24,6 +29,12 @@ namespace sdl {
           East   //<! - Tab indication will be displayed on the right of the content.
         };
 
+        /**
+         * @brief - Convenience define for a method allowing to create the content of a tab
+         *          only when it is needed. The returned widget should not be null.
+         */
+        using TabFactory = std::function<core::SdlWidget*()>;
+
       public:
 
         TabWidget(const std::string& name,
@@ -59,9 +70,38 @@ namespace sdl {
                   core::SdlWidget* item,
                   const std::string& text = std::string());
 
+        /**
+         * @brief - Similar to the above method but the content of the tab is not created
+         *          right away: the `factory` is only called the first time the tab gets
+         *          activated. Until then a lightweight placeholder is used so that the
+         *          tab can be referenced like any other.
+         *          This allows to only pay for the construction of the tabs the user
+         *          actually looks at.
+         * @param index - the position where the tab widget should be inserted.
+         * @param factory - the method to use to create the content of the tab.
+         * @param text - a string representing the name under which the tab should be
+         *               referenced in the title bar.
+         */
+        void
+        insertTab(int index,
+                  const TabFactory& factory,
+                  const std::string& text);
+
+        /**
+         * @brief - Defines whether the tabs adjacent to the active one should be created
+         *          ahead of time. If this is the case they are built after the active tab
+         *          has been displayed, one per frame and outside of the rendering, so that
+         *          switching to them does not incur any delay.
+         * @param prebuild - `true` to create the adjacent tabs ahead of time.
+         */
+        void
+        setAdjacentPrebuild(bool prebuild) noexcept;
+
         /**
          * @brief - Used to remove the tab widget located at index `index`. If no such
          *          index exists in this component an error is raised.
+         *          In case the tab was inserted with a factory and has not been built yet
+         *          its placeholder is deleted.
          * @param index - the position of the tab widget to remove from this layout.
          */
         void
@@ -77,6 +117,49 @@ namespace sdl {
         void
         removeTab(core::SdlWidget* widget);
 
+      protected:
+
+        /**
+         * @brief - Reimplementation of the base `SdlWidget` method: this widget does not draw
+         *          anything by itself but uses the opportunity to detect that the active tab
+         *          has been displayed. In case the adjacent tabs should be created an event
+         *          is posted so that this happens after the frame, outside of the rendering.
+         * @param uuid - the identifier of the canvas which we can use to draw the overlay.
+         * @param area - the area of the canvas to update.
+         */
+        void
+        drawContentPrivate(const utils::Uuid& uuid,
+                           const utils::Boxf& area) override;
+
+        /**
+         * @brief - Reimplementation of the base `SdlWidget` method to create one of the tabs
+         *          adjacent to the active one upon receiving the event posted when drawing a
+         *          frame. This event does not trigger a repaint on its own.
+         * @param e - the paint event to process.
+         * @return - `true` if the event was recognized and `false` otherwise.
+         */
+        bool
+        repaintEvent(const core::engine::PaintEvent& e) override;
+
+        /**
+         * @brief - Reimplementation of the base `SdlWidget` method to detect that the number of
+         *          titles fitting in the titles bar changed. The titles are updated after the next
+         *          frame as this can create new title widgets.
+         * @param window - the available size to perform the update.
+         */
+        void
+        updatePrivate(const utils::Boxf& window) override;
+
+        /**
+         * @brief - Reimplementation of the base `SdlWidget` method to allow scrolling through the
+         *          titles of the tabs when the mouse is over the titles bar. Only the titles which
+         *          are currently displayed are updated to represent the new visible tabs.
+         * @param e - the mouse event describing the wheel motion.
+         * @return - `true` if the event was recognized, `false` otherwise.
+         */
+        bool
+        mouseWheelEvent(const core::engine::MouseEvent& e) override;
+
       private:
 
         /**
@@ -92,6 +175,28 @@ namespace sdl {
         float
         getMaximumSizeForTitle() noexcept;
 
+        /**
+         * @brief - Used to define the minimum length of a title along the titles bar. This is
+         *          used to determine how many titles fit in the bar: like the maximum size it
+         *          applies either to the width or height of each title based on the orientation
+         *          of the tab widget.
+         * @return - the minimum length of a title along the titles bar.
+         */
+        static
+        float
+        getMinimumLengthForTitle() noexcept;
+
+        /**
+         * @brief - Used to compute the maximum number of titles displayed at once in the titles
+         *          bar based on its current length and on the minimum length of a title. At least
+         *          one title can always be displayed. Only this many title widgets are created:
+         *          when the tab widget holds more tabs the titles bar can be scrolled to reach the
+         *          other ones.
+         * @return - the maximum number of titles visible at once.
+         */
+        int
+        getMaximumVisibleTitles() const;
+
         /**
          * @brief - Used to build this component by creating the adequate layout and the component
          *          to use to represent each item of the tab widget.
@@ -100,25 +205,63 @@ namespace sdl {
         build();
 
         /**
-         * @brief - Used to create a title widget from the input `text` and insert it
-         *          at the desired `index` in the internal titles layout.
-         *          One can specify whether this method should update the internal array
-         *          registering all tabs `m_tabs`. This is useful because of the way wa
-         *          handle the non-creation of the title layout for the first tab widget.
-         * @param index - the index at which the title should be inserted inside the
-         *                internal titles layout.
-         * @param text - the text which should be displayed for this title.
-         * @param item - the name of the widget associated with this title.
-         * @param palette - the palette to assign to the widget representing the title.
-         * @param updateIDs - true if the internal `m_tabs` array should be updated, false
-         *                    otherwise.
+         * @brief - Used to create the title widget representing the slot at the specified
+         *          index in the titles bar and to append it to the internal titles layout.
+         *          The title is connected so that a click on it activates the tab which it
+         *          currently represents.
+         * @param slot - the index of the slot to create.
          */
         void
-        createTitleForWidget(int index,
-                             const std::string& text,
-                             const std::string& item,
-                             const core::engine::Palette& palette,
-                             bool updateIDs = true);
+        createTitle(int slot);
+
+        /**
+         * @brief - Used to update the titles displayed in the titles bar. The titles bar only
+         *          holds a fixed pool of title widgets (at most `getMaximumVisibleTitles`) each
+         *          one being bound to the tab located at `m_firstVisibleTab` plus its index. The
+         *          title widgets which do not correspond to any tab are hidden. Each title uses
+         *          the palette of the widget of its tab at the time of the update.
+         *          This means that the cost of this method only depends on the number of visible
+         *          titles and not on the total number of tabs: in particular the titles layout is
+         *          only updated when the number of visible titles changes.
+         */
+        void
+        updateTitles();
+
+        /**
+         * @brief - Retrieves the number of titles which should currently be displayed in the
+         *          titles bar. No titles are displayed when the tab widget has less than two
+         *          tabs.
+         * @return - the number of visible titles.
+         */
+        int
+        getVisibleTitlesCount() const noexcept;
+
+        /**
+         * @brief - Used to clamp the index of the first visible tab so that the titles always
+         *          represent existing tabs: the last title should not be scrolled past the last
+         *          tab of the widget.
+         * @param first - the desired index of the first visible tab.
+         * @return - the index of the first visible tab to use.
+         */
+        int
+        clampFirstVisibleTab(int first) const noexcept;
+
+        /**
+         * @brief - Used to scroll the titles bar by the specified amount of titles. Positive
+         *          values display tabs further in the list. The titles are updated if the scroll
+         *          actually changed the first visible tab.
+         * @param delta - the number of titles to scroll by.
+         */
+        void
+        scrollTitles(int delta);
+
+        /**
+         * @brief - Used to scroll the titles bar so that the title of the tab at `index` is
+         *          visible. Nothing happens if it is already the case.
+         * @param index - the index of the tab which should be visible.
+         */
+        void
+        ensureTitleVisible(int index);
 
         /**
          * @brief - Wrapper around the parent `getChildAs` method for better convenience.
@@ -138,12 +281,13 @@ namespace sdl {
         onTitleClicked(const std::string& name);
 
         /**
-         * @brief - Used to retrieve the name of the title widget representing the tab from
-         *          the internal tab id.
+         * @brief - Used to retrieve the name of the title widget representing the slot at
+         *          the specified index in the titles bar.
+         * @param slot - the index of the slot.
          * @return - a string representing the name of the title widget.
          */
         std::string
-        getTitleNameFromTabID();
+        getTitleNameFromSlot(int slot) const noexcept;
 
         /**
          * @brief - Retrieves the name of the selector to use either to create it or retrieve
@@ -161,6 +305,33 @@ namespace sdl {
         void
         removeIndexFromInternal(int index);
 
+        /**
+         * @brief - Used to retrieve the name of the placeholder widget used for a tab which
+         *          content is created lazily.
+         * @return - a string representing the name of the placeholder.
+         */
+        std::string
+        getPageNameFromTabID();
+
+        /**
+         * @brief - Used to create the content of the tab at `index` in case it was inserted
+         *          with a factory and has not been created yet. The content is inserted in
+         *          place of the placeholder of the tab. Does nothing if the index is invalid.
+         * @param index - the index of the tab to build.
+         * @return - `true` if the content of the tab was created.
+         */
+        bool
+        buildTab(int index);
+
+        /**
+         * @brief - Used to create the content of one of the tabs adjacent to the active one if
+         *          it is not created yet. Only a single tab is created to keep the cost of this
+         *          operation low.
+         * @return - `true` if a tab was created.
+         */
+        bool
+        buildAdjacentTab();
+
       private:
 
         /**
@@ -168,8 +339,8 @@ namespace sdl {
          */
         struct TabInfo {
           std::string itemName;
-          std::string titleWidgetName;
           std::string tabName;
+          TabFactory factory;
         };
 
         using Tabs = std::vector<TabInfo>;
@@ -202,6 +373,33 @@ namespace sdl {
          *          the user).
          */
         Tabs m_tabs;
+
+        /**
+         * @brief - The pool of title widgets displayed in the titles bar along with the index
+         *          of the tab represented by the first one. The pool never holds more than the
+         *          maximum number of visible titles, whatever the number of tabs.
+         */
+        std::vector<LabelWidget*> m_titles;
+        int m_firstVisibleTab;
+
+        /**
+         * @brief - Whether the tabs adjacent to the active one should be created ahead of time
+         *          and whether some of them may still need to be created.
+         */
+        bool m_prebuildAdjacent;
+        bool m_prebuildPending;
+
+        /**
+         * @brief - Whether the number of titles fitting in the titles bar changed since the
+         *          titles were last updated.
+         */
+        bool m_titlesPending;
+
+        /**
+         * @brief - Used to be notified after a frame has been drawn to create the next adjacent
+         *          tab or to update the titles.
+         */
+        DeferredNotifier m_frameNotifier;
     };
 
     using TabWidgetShPtr = std::shared_ptr<TabWidget>;
@@ -18,6 +18,27 @@ namespace sdl {
       return 70.0f;
     }
 
+    inline
+    float
+    TabWidget::getMinimumLengthForTitle() noexcept {
+      return 60.0f;
+    }
+
+    inline
+    int
+    TabWidget::getMaximumVisibleTitles() const {
+      // The titles bar spans the whole width of the widget when the titles
+      // are displayed horizontally and its whole height otherwise.
+      const utils::Boxf area = LayoutItem::getRenderingArea();
+
+      float length = area.w();
+      if (m_tabLayout == TabPosition::West || m_tabLayout == TabPosition::East) {
+        length = area.h();
+      }
+
+      return std::max(1, static_cast<int>(std::floor(length / getMinimumLengthForTitle())));
+    }
+
     inline
     SelectorWidget&
     TabWidget::getSelector() {
@@ -35,12 +56,67 @@ namespace sdl {
 
     inline
     std::string
-    TabWidget::getTitleNameFromTabID() {
-      // Retrieve an identifier for the tab.
+    TabWidget::getTitleNameFromSlot(int slot) const noexcept {
+      return getName() + "_title_for_" + std::to_string(slot);
+    }
+
+    inline
+    int
+    TabWidget::getVisibleTitlesCount() const noexcept {
+      // No titles are displayed for a single tab: this maximizes the area
+      // available for its content.
+      if (getTabsCount() < 2) {
+        return 0;
+      }
+
+      return std::min(getTabsCount(), getMaximumVisibleTitles());
+    }
+
+    inline
+    int
+    TabWidget::clampFirstVisibleTab(int first) const noexcept {
+      return std::max(0, std::min(first, getTabsCount() - getVisibleTitlesCount()));
+    }
+
+    inline
+    void
+    TabWidget::scrollTitles(int delta) {
+      const int first = clampFirstVisibleTab(m_firstVisibleTab + delta);
+
+      if (first == m_firstVisibleTab) {
+        return;
+      }
+
+      m_firstVisibleTab = first;
+
+      updateTitles();
+    }
+
+    inline
+    void
+    TabWidget::ensureTitleVisible(int index) {
+      if (index < m_firstVisibleTab) {
+        scrollTitles(index - m_firstVisibleTab);
+      }
+      else if (index >= m_firstVisibleTab + getVisibleTitlesCount()) {
+        scrollTitles(index - m_firstVisibleTab - getVisibleTitlesCount() + 1);
+      }
+    }
+
+    inline
+    void
+    TabWidget::setAdjacentPrebuild(bool prebuild) noexcept {
+      m_prebuildAdjacent = prebuild;
+    }
+
+    inline
+    std::string
+    TabWidget::getPageNameFromTabID() {
+      // Retrieve an identifier for the page.
       const int id = m_tabCount;
       ++m_tabCount;
 
-      return std::string("title_for_") + std::to_string(id);
+      return getName() + "_page_for_" + std::to_string(id);
     }
 
     inline
@@ -11,6 +11,8 @@ namespace sdl {
                      SdlWidget* parent,
                      const utils::Sizef& area):
       core::SdlWidget(name, area, parent),
+      TextEditing(false),
+
       m_text(text),
       m_cursorIndex(0u),
       m_cursorVisible(false),
@@ -50,9 +52,9 @@ namespace sdl {
       // Clear cursor.
       clearCursor();
 
-      // Clear font.
+      // Give back the font to the registry.
       if (m_font.valid()) {
-        getEngine().destroyColoredFont(m_font);
+        FontRegistry::getInstance().release(m_font);
       }
     }
 
@@ -61,92 +63,11 @@ namespace sdl {
       // Lock this object.
       Guard guard(m_propsLocker);
 
-      // Depending on the type of key pressed by the user we might:
-      // - add a new character to the text displayed.
-      // - move the position of the cursor.
-      // - remove a character from the text displayed.
-      // - stop processing selection.
-      // - do nothing if the key is not handled.
+      // The interpretation of the key is shared with the other text widgets:
+      // see the `TextEditing` class for more details.
       const bool toReturn = core::SdlWidget::keyPressEvent(e);
 
-      // We will handle first the motion of the cursor. It is triggered by using
-      // the left and right arrows. The position is updated until no more move is
-      // possible in the corresponding direction.
-      if (canTriggerCursorMotion(e.getRawKey())) {
-        // Assume left motion and change if needed.
-        CursorMotion motion = CursorMotion::Left;
-        if (e.getRawKey() == core::engine::RawKey::Right || e.getRawKey() == core::engine::RawKey::End) {
-          motion = CursorMotion::Right;
-        }
-        CursorMotionMode mode = CursorMotionMode::SingleChar;
-        if (core::engine::ctrlEnabled(e.getModifiers())) {
-          mode = CursorMotionMode::ToWord;
-        }
-        if (e.getRawKey() == core::engine::RawKey::Home || e.getRawKey() == core::engine::RawKey::End) {
-          mode = CursorMotionMode::ToEnd;
-        }
-
-        // Before updating the cursor position we need to detect when the user
-        // starts a selection: this is triggered by using the shift modifier and
-        // then moving the cursor. We only want to start a selection if we're not
-        // already in the process of selected some text.
-        if (core::engine::shiftEnabled(e.getModifiers()) && !selectionStarted()) {
-          startSelection();
-        }
-
-        // We should also stop the selection in case a motion key is pressed while
-        // the shift modifier is not pressed. This actually cancels the update of
-        // the cursor position.
-        if (!core::engine::shiftEnabled(e.getModifiers()) && selectionStarted()) {
-          stopSelection();
-        }
-        else {
-          updateCursorPosition(motion, mode);
-        }
-
-        // Use the base handler to provide the return value.
-        return toReturn;
-      }
-
-      // Handle the removal of a character.
-      if (e.getRawKey() == core::engine::RawKey::BackSpace || e.getRawKey() == core::engine::RawKey::Delete) {
-        // Perform the character removal.
-        removeCharFromText(e.getRawKey() == core::engine::RawKey::Delete);
-
-        // Handle the end of the selection if needed: we only want to handle it after
-        // performing the deletion of the character(s) because that's how most of the
-        // other tools handle it.
-        if (!core::engine::shiftEnabled(e.getModifiers()) && selectionStarted()) {
-          stopSelection();
-        }
-
-        // Return the value provided by the base handler.
-        return toReturn;
-      }
-
-      // Check whether the key is authorized: in a first approach we will rely on
-      // the fact that the character should be printable. If this is not the case
-      // there's no point in trying to display it.
-      // The validator is used later on when the user wants to retrieve the value
-      // that is stored in this textbox.
-      if (!e.isPrintable()) {
-        // Use the return value provided by the base handler.
-        return toReturn;
-      }
-
-      // We should stop the selection if any and remove the characters selected so far.
-      if (selectionStarted()) {
-        // Given that we have a selection active it does not really matter whether we use
-        // the `forward` suppression. For good measure though we will do as if we pressed
-        // the `Delete` key.
-        removeCharFromText(true);
-
-        // Stop the selection.
-        stopSelection();
-      }
-
-      // Add the corresponding char to the internal text.
-      addCharToText(e.getChar());
+      handleKeyPress(e);
 
       return toReturn;
     }
@@ -183,16 +104,9 @@ namespace sdl {
       // Get the local position of the click.
       utils::Vector2f localClick = mapFromGlobal(e.getMousePosition());
 
-      // Determine the index of the character closest to the click position.
-      unsigned idChar = closestCharacterFrom(localClick);
-
-      // Stop selection if any.
-      if (selectionStarted()) {
-        stopSelection();
-      }
-
-      // Move the cursor to the specified index.
-      updateCursorToPosition(idChar);
+      // Move the cursor to the character closest to the click position: this
+      // stops the selection if any.
+      handleClick(closestCharacterFrom(localClick));
 
       // Use the base handler to provide the return value.
       return toReturn;
@@ -205,9 +119,7 @@ namespace sdl {
 
       // Perform a selection of the entirety of the text inserted in the textbox. We will
       // also move the cursor to the end of the displayed text.
-      updateCursorPosition(CursorMotion::Left, CursorMotionMode::ToWordOrSpace);
-      startSelection();
-      updateCursorPosition(CursorMotion::Right, CursorMotionMode::ToWordOrSpace);
+      handleDoubleClick();
 
       // Use the base handler to provide a return value.
       return core::SdlWidget::mouseDoubleClickEvent(e);
@@ -241,42 +153,9 @@ namespace sdl {
       unsigned idStart = closestCharacterFrom(start);
       unsigned idCur = closestCharacterFrom(cur);
 
-      // We now need to update the selected text based on the above values. As
-      // a drag event is something rather long, we might not update the text
-      // selected each time so we should be careful not to request too many
-      // repaints.
-      if (!selectionStarted()) {
-        // The selection has not started: we need to ensure that the cursor is
-        // at the character targeted by the drag event before starting the
-        // selection.
-        updateCursorToPosition(idStart);
-
-        // Now start the selection.
-        startSelection();
-
-        // And move the cursor to the current position.
-        updateCursorToPosition(idCur);
-      }
-      else {
-        // The selection already started: we can verify that he starting index
-        // is still relevant compared to the local start of the selection.
-        if (m_selectionStart != idStart) {
-          // This is weird.
-          log(
-            std::string("Drag event references beginning at character ") + std::to_string(idStart) +
-            " but internal registered value was " + std::to_string(m_selectionStart),
-            utils::Level::Warning
-          );
-
-          m_selectionStart = idStart;
-        }
-
-        // Move the cursor to the desired index.
-        updateCursorToPosition(idCur);
-      }
-
-      // Also set the cursor to visible if it is not already the case.
-      updateCursorState(true);
+      // Update the selection based on the above values: this also updates the
+      // cursor's position and makes it visible.
+      handleDrag(idStart, idCur);
 
       // Use the base handler to provide a return value.
       return core::SdlWidget::mouseDragEvent(e);
@@ -468,7 +347,8 @@ namespace sdl {
       //    last character completely beyond the input `pos`.
       // In order to determine this index, we will use the dedicated `SDL TTF API`
       // method which allows to compute the dimension of a string as if it was
-      // rendered for display. We will loop through the text displayed in this box
+      // rendered for display (through the text cache so that repeated clicks do
+      // not measure the same prefixes again). We will loop through the text displayed in this box
       // and pick the character fitting the above conditions.
       // Note that to provide the most exact detection of the character we actually
       // account for intra-character selection, meaning that if the user clicks on
@@ -495,7 +375,8 @@ namespace sdl {
 
       while (!valid && id <= m_text.size()) {
         // Render the string containing the characters until `id` and check whether
-        // the click is now on the left side of the rendered string.
+        // the click is now on the left side of the rendered string. The prefixes are
+        // not worth caching as they are hardly ever measured twice.
         textSize = getEngine().getTextSize(m_text.substr(0u, id), m_font, false);
 
         // Check whether the size of the text is now encompassing the input position.
@@ -625,7 +506,7 @@ namespace sdl {
       utils::Sizef text = getEngine().getTextSize(m_text.substr(0u, m_cursorIndex), m_font, false);
 
       // The cursor should be positionned right after that.
-      utils::Sizef sizeCursor = getEngine().getTextSize("|", m_font, true);
+      utils::Sizef sizeCursor = TextCache::getInstance().getTextSize(getEngine(), std::string("|"), m_font, true);
 
       return utils::Boxf(
         -env.w() / 2.0f + text.w() + sizeCursor.w() / 2.0f,
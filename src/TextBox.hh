@@ -7,11 +7,14 @@
 # include <core_utils/Signal.hh>
 # include <sdl_core/SdlWidget.hh>
 # include "Validator.hh"
+# include "FontRegistry.hh"
+# include "TextCache.hh"
+# include "TextEditing.hh"
 
 namespace sdl {
   namespace graphic {
 
-    class TextBox: public core::SdlWidget {
+    class TextBox: public core::SdlWidget, private TextEditing {
       public:
 
         /**
@@ -159,28 +162,6 @@ namespace sdl {
 
       private:
 
-        /**
-         * @brief - Used to specify the direction of a cursor motion. The directions allow to
-         *          move the position of the cursor in the text displayed in the textbox.
-         */
-        enum class CursorMotion {
-          Left,  //<!- A motion of the cursor on the left of its current position.
-          Right  //<!- A motion of the cursor on the right of its current position.
-        };
-
-        /**
-         * @brief - Used to specify the type of motion to apply to the cursor. Typical values
-         *          allow to move directly to the begin or to the end of an element or until
-         *          the next word is found.
-         *          The basic mode corresponds to a motion of a single character.
-         */
-        enum class CursorMotionMode {
-          SingleChar,
-          ToWord,
-          ToWordOrSpace,
-          ToEnd
-        };
-
         /**
          * @brief - Used internally upon constructing the text box to initialize internal
          *          states.
@@ -189,15 +170,14 @@ namespace sdl {
         build();
 
         /**
-         * @brief - Used to determine whether the input key can trigger a cursor motion inside
-         *          the textbox. This is basically used to pin point keys which can update the
-         *          position of the cursor in the internal text.
-         * @param k - the key which should be checked for cursor motion trigger.
-         * @return - `true` if the input key triggers a cursor position update and `false` in
-         *           any other case.
+         * @brief - Reimplementation of the `TextEditing` hooks providing access to the text
+         *          displayed in this textbox.
          */
-        bool
-        canTriggerCursorMotion(const core::engine::RawKey& k) const noexcept;
+        std::size_t
+        getTextLength() const noexcept override;
+
+        char
+        getCharacterAt(std::size_t id) const noexcept override;
 
         /**
          * @brief - Used to trigger the needed events and internal states so that the cursor
@@ -207,7 +187,7 @@ namespace sdl {
          * @param visible - `true` if the cursor should be made visible, `false` otherwise.
          */
         void
-        updateCursorState(const bool visible);
+        updateCursorState(const bool visible) override;
 
         /**
          * @brief - Used to update the position of the cursor given the specified motion. This
@@ -224,7 +204,7 @@ namespace sdl {
          */
         void
         updateCursorPosition(const CursorMotion& motion,
-                             const CursorMotionMode& mode = CursorMotionMode::SingleChar);
+                             const CursorMotionMode& mode = CursorMotionMode::SingleChar) override;
 
         /**
          * @brief - Used to update the position of the cursor to the value specified in argument.
@@ -235,7 +215,7 @@ namespace sdl {
          * @param pos - the position to assign to the cursor.
          */
         void
-        updateCursorToPosition(unsigned pos);
+        updateCursorToPosition(std::size_t pos) override;
 
         /**
          * @brief - Add the specified character to the internal text at the position specified
@@ -244,7 +224,7 @@ namespace sdl {
          * @param c - the character to add to the internal text.
          */
         void
-        addCharToText(char c);
+        addCharToText(char c) override;
 
         /**
          * @brief - Remove a character from the internal text according to the position pointed
@@ -258,7 +238,7 @@ namespace sdl {
          *                  cursor's position.
          */
         void
-        removeCharFromText(bool forward);
+        removeCharFromText(bool forward) override;
 
         /**
          * @brief - Used to start a selection from the internal position of the cursor. This will
@@ -267,7 +247,7 @@ namespace sdl {
          *          selection.
          */
         void
-        startSelection() noexcept;
+        startSelection() noexcept override;
 
         /**
          * @brief - Used to stop the selection of a text in this box. Note that this will invalidate
@@ -277,7 +257,7 @@ namespace sdl {
          *          is requested only if the selection contained at least one character.
          */
         void
-        stopSelection() noexcept;
+        stopSelection() noexcept override;
 
         /**
          * @brief - Used to perform the loading of the font to use to render the text.
@@ -331,7 +311,7 @@ namespace sdl {
          * @return - `true` if a text selection operation is being performed and `false` otherwise.
          */
         bool
-        selectionStarted() const noexcept;
+        selectionStarted() const noexcept override;
 
         /**
          * @brief - Used to determine whether a left text part is active for this textbox. We
@@ -144,14 +144,15 @@ namespace sdl {
     }
 
     inline
-    bool
-    TextBox::canTriggerCursorMotion(const core::engine::RawKey& k) const noexcept {
-      return
-        k == core::engine::RawKey::Left ||
-        k == core::engine::RawKey::Right ||
-        k == core::engine::RawKey::Home ||
-        k == core::engine::RawKey::End
-      ;
+    std::size_t
+    TextBox::getTextLength() const noexcept {
+      return m_text.size();
+    }
+
+    inline
+    char
+    TextBox::getCharacterAt(std::size_t id) const noexcept {
+      return m_text[id];
     }
 
     inline
@@ -201,48 +202,14 @@ namespace sdl {
             updateCursorToPosition(0u);
             break;
           case CursorMotionMode::ToWord:
-            {
-              // Try to find the previous occurrence of a ' ' character. If we can
-              // find one we will move to reach it, otherwise we move to the start
-              // of the string.
-              // Also we want to skip all the ' ' characters to directly reach the
-              // next word in case we're standing right on the verge of a space gap.
-              std::size_t id = m_cursorIndex - 1u;
-              bool gap = (m_text[id] == ' ');
-
-              // Loop until either we reach a space or (if we started at a space)
-              // until we reach a real character.
-              while (id > 0u && (gap || (!gap && m_text[id] != ' '))) {
-                --id;
-                if (gap && m_text[id] != ' ') {
-                  gap = false;
-                }
-              }
-
-              // We don't want to move to whatever position we reached unless we did
-              // reach the beginning of the string. Indeed in any other case we don't
-              // want to move past the space character.
-              updateCursorToPosition(id == 0u ? id : id + 1u);
-            }
+            // Move to the beginning of the previous word: the space characters
+            // right before the cursor are skipped.
+            updateCursorToPosition(findPreviousWord(m_cursorIndex, false));
             break;
           case CursorMotionMode::ToWordOrSpace:
-            {
-              // This mode is similar to the `ToWord` one except we consider a space
-              // sequence to also be a `word`.
-              std::size_t id = m_cursorIndex - 1u;
-              bool gap = (m_text[id] == ' ');
-
-              // Loop until either we reach a space or (if we started at a space)
-              // until we reach a real character.
-              while (id > 0u && ((gap && m_text[id] == ' ') || (!gap && m_text[id] != ' '))) {
-                --id;
-              }
-
-              // We don't want to move to whatever position we reached unless we did
-              // reach the beginning of the string. Indeed in any other case we don't
-              // want to move past the space character.
-              updateCursorToPosition(id == 0u ? id : id + 1u);
-            }
+            // This mode is similar to the `ToWord` one except we consider a space
+            // sequence to also be a `word`.
+            updateCursorToPosition(findPreviousWord(m_cursorIndex, true));
             break;
           default:
             log("Could not move cursor given mode " + std::to_string(static_cast<int>(mode)), utils::Level::Warning);
@@ -266,47 +233,12 @@ namespace sdl {
             updateCursorToPosition(m_text.size());
             break;
           case CursorMotionMode::ToWord:
-            {
-              // Try to find the next occurrence of a ' ' character. If we can
-              // find one we will move to reach it, otherwise we move to the
-              // end of the string.
-              // Also we want to skip all the ' ' characters to directly reach the
-              // next word in case we're standing right on the verge of a space gap.
-              std::size_t id = m_cursorIndex;
-              bool gap = (m_text[id] == ' ');
-
-              // Loop until either we reach a space or (if we started at a space)
-              // until we reach a real character.
-              while (id < m_text.size() && (gap || (!gap && m_text[id] != ' '))) {
-                ++id;
-                if (gap && m_text[id] != ' ') {
-                  gap = false;
-                }
-              }
-
-              // We want to move to whatever position we reached.
-              updateCursorToPosition(id);
-            }
+            // Move to the end of the next word: the space characters right after
+            // the cursor are skipped.
+            updateCursorToPosition(findNextWord(m_cursorIndex, false));
             break;
           case CursorMotionMode::ToWordOrSpace:
-            {
-              // Try to find the next occurrence of a ' ' character. If we can
-              // find one we will move to reach it, otherwise we move to the
-              // end of the string.
-              // Also we want to skip all the ' ' characters to directly reach the
-              // next word in case we're standing right on the verge of a space gap.
-              std::size_t id = m_cursorIndex;
-              bool gap = (m_text[id] == ' ');
-
-              // Loop until either we reach a space or (if we started at a space)
-              // until we reach a real character.
-              while (id < m_text.size() && ((gap && m_text[id] == ' ') || (!gap && m_text[id] != ' '))) {
-                ++id;
-              }
-
-              // We want to move to whatever position we reached.
-              updateCursorToPosition(id);
-            }
+            updateCursorToPosition(findNextWord(m_cursorIndex, true));
             break;
           default:
             log("Could not move cursor given mode " + std::to_string(static_cast<int>(mode)), utils::Level::Warning);
@@ -317,12 +249,12 @@ namespace sdl {
 
     inline
     void
-    TextBox::updateCursorToPosition(unsigned pos) {
+    TextBox::updateCursorToPosition(std::size_t pos) {
       const unsigned old = m_cursorIndex;
 
       // Clamp the position when assigning to the internal value. This formula has
       // the advantage of taking care of empty text displayed.
-      m_cursorIndex = std::min(static_cast<unsigned>(m_text.size()), pos);
+      m_cursorIndex = static_cast<unsigned>(std::min(m_text.size(), pos));
 
       // Indicate that the text has changed if needed.
       if (old != m_cursorIndex) {
@@ -398,8 +330,8 @@ namespace sdl {
     TextBox::loadFont() {
       // Only load the font if it has not yet been done.
       if (!m_font.valid()) {
-        // Load the font.
-        m_font = getEngine().createColoredFont(m_fontName, getPalette(), m_fontSize);
+        // Borrow the font from the registry.
+        m_font = FontRegistry::getInstance().acquire(getEngine(), m_fontName, m_fontSize, getPalette());
 
         if (!m_font.valid()) {
           error(
@@ -443,7 +375,7 @@ namespace sdl {
             );
           }
 
-          m_leftText = getEngine().createTextureFromText(getLeftText(), m_font, m_textRole);
+          m_leftText = TextCache::getInstance().acquireText(getEngine(), getLeftText(), m_font, m_textRole);
         }
 
         if (hasSelectedTextPart()) {
@@ -457,7 +389,8 @@ namespace sdl {
           }
 
           // The role of the selected text is always `HighlightedText`.
-          m_selectedText = getEngine().createTextureFromText(
+          m_selectedText = TextCache::getInstance().acquireText(
+            getEngine(),
             getSelectedText(),
             m_font,
             core::engine::Palette::ColorRole::HighlightedText
@@ -494,7 +427,7 @@ namespace sdl {
             );
           }
 
-          m_rightText = getEngine().createTextureFromText(getRightText(), m_font, m_textRole);
+          m_rightText = TextCache::getInstance().acquireText(getEngine(), getRightText(), m_font, m_textRole);
         }
       }
     }
@@ -519,24 +452,26 @@ namespace sdl {
         m_textRole
       );
 
-      m_cursor = getEngine().createTextureFromText(std::string("|"), m_font, role);
+      m_cursor = TextCache::getInstance().acquireText(getEngine(), std::string("|"), m_font, role);
     }
 
     inline
     void
     TextBox::clearText() {
+      // The text textures are shared through the cache: give them back. The
+      // selection background is owned by this widget.
       if (m_leftText.valid()) {
-        getEngine().destroyTexture(m_leftText);
+        TextCache::getInstance().release(m_leftText);
         m_leftText.invalidate();
       }
 
       if (m_rightText.valid()) {
-        getEngine().destroyTexture(m_rightText);
+        TextCache::getInstance().release(m_rightText);
         m_rightText.invalidate();
       }
 
       if (m_selectedText.valid()) {
-        getEngine().destroyTexture(m_selectedText);
+        TextCache::getInstance().release(m_selectedText);
         m_selectedText.invalidate();
       }
 
@@ -550,7 +485,7 @@ namespace sdl {
     void
     TextBox::clearCursor() {
       if (m_cursor.valid()) {
-        getEngine().destroyTexture(m_cursor);
+        TextCache::getInstance().release(m_cursor);
         m_cursor.invalidate();
       }
     }
@@ -0,0 +1,189 @@
+# include "TextCache.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    TextCache::TextCache():
+      utils::CoreObject(std::string("text_cache")),
+
+      m_locker(),
+
+      m_entries(),
+      m_lru(),
+      m_textures(),
+
+      m_metrics(Metrics{0u, 0u, 0u, 0u, 0u, 0u, 0u, getDefaultBudget()})
+    {
+      setService(std::string("text"));
+    }
+
+    TextCache&
+    TextCache::getInstance() {
+      static TextCache cache;
+
+      return cache;
+    }
+
+    void
+    TextCache::release(const utils::Uuid& texture) {
+      // Nothing to do for invalid textures.
+      if (!texture.valid()) {
+        return;
+      }
+
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      TexturesMap::iterator it = m_textures.find(texture);
+
+      if (it == m_textures.end()) {
+        log(
+          std::string("Could not release text texture, texture is not registered"),
+          utils::Level::Warning
+        );
+
+        return;
+      }
+
+      Entry& entry = it->second->second;
+
+      if (entry.refs == 0u) {
+        log(
+          std::string("Releasing text texture \"") + it->second->first.text + "\" which is not used",
+          utils::Level::Warning
+        );
+
+        return;
+      }
+
+      --entry.refs;
+
+      // The texture can now be evicted if needed.
+      if (entry.refs == 0u) {
+        m_lru.touch(it->second->first);
+        evict();
+      }
+    }
+
+    void
+    TextCache::purgeFont(const utils::Uuid& font) {
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      EntriesMap::iterator it = m_entries.begin();
+
+      while (it != m_entries.end()) {
+        Entry& entry = it->second;
+
+        if (!(it->first.font == font) || entry.refs > 0u) {
+          ++it;
+          continue;
+        }
+
+        if (entry.texture.valid()) {
+          m_textures.erase(entry.texture);
+
+          if (entry.engine != nullptr) {
+            entry.engine->destroyTexture(entry.texture);
+          }
+        }
+
+        m_metrics.bytes -= entry.bytes;
+        --m_metrics.entries;
+        ++m_metrics.evictions;
+
+        m_lru.remove(it->first);
+        it = m_entries.erase(it);
+      }
+    }
+
+    void
+    TextCache::purge(EngineHandle& engine) {
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      EntriesMap::iterator it = m_entries.begin();
+
+      while (it != m_entries.end()) {
+        Entry& entry = it->second;
+
+        if (entry.engine.get() != &engine) {
+          ++it;
+          continue;
+        }
+
+        if (entry.refs > 0u) {
+          log(
+            std::string("Text texture \"") + it->first.text + "\" is still used while its engine is detached",
+            utils::Level::Warning
+          );
+
+          entry.engine.reset();
+          ++it;
+
+          continue;
+        }
+
+        m_textures.erase(entry.texture);
+        engine.destroyTexture(entry.texture);
+
+        m_metrics.bytes -= entry.bytes;
+        --m_metrics.entries;
+        ++m_metrics.evictions;
+
+        m_lru.remove(it->first);
+        it = m_entries.erase(it);
+      }
+    }
+
+    TextCache::EntriesMap::iterator
+    TextCache::insert(const Key& key,
+                      Entry entry)
+    {
+      EntriesMap::iterator it = m_entries.insert(std::make_pair(key, entry)).first;
+
+      m_metrics.bytes += entry.bytes;
+      ++m_metrics.entries;
+
+      evict();
+
+      // Register the entry as the most recently used one once the eviction
+      // is done: this guarantees that it is not evicted right away.
+      if (entry.refs == 0u) {
+        m_lru.touch(key);
+      }
+
+      return it;
+    }
+
+    void
+    TextCache::evict() {
+      // Release the least recently used entries which are not in use until
+      // we fit in the budget.
+      while (m_metrics.bytes > m_metrics.budget && !m_lru.empty()) {
+        EntriesMap::iterator entry = m_entries.find(m_lru.oldest());
+
+        if (entry == m_entries.end()) {
+          error(
+            std::string("Could not evict text cache entry \"") + m_lru.oldest().text + "\"",
+            std::string("Inconsistent cache")
+          );
+        }
+
+        m_lru.pop();
+
+        if (entry->second.texture.valid()) {
+          m_textures.erase(entry->second.texture);
+
+          if (entry->second.engine != nullptr) {
+            entry->second.engine->destroyTexture(entry->second.texture);
+          }
+        }
+
+        m_metrics.bytes -= entry->second.bytes;
+        --m_metrics.entries;
+        ++m_metrics.evictions;
+
+        m_entries.erase(entry);
+      }
+    }
+
+  }
+}
@@ -0,0 +1,235 @@
+#ifndef    TEXT_CACHE_HH
+# define   TEXT_CACHE_HH
+
+# include <map>
+# include <mutex>
+# include <string>
+# include <maths_utils/Size.hh>
+# include <core_utils/Uuid.hh>
+# include <core_utils/CoreObject.hh>
+# include <sdl_engine/Palette.hh>
+# include "LruIndex.hh"
+# include "EngineHandle.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    class TextCache: public utils::CoreObject {
+      public:
+
+        /**
+         * @brief - Describes the counters maintained by the cache. Measurements and
+         *          rasterised texts are tracked separately as their hit rates are
+         *          usually quite different.
+         */
+        struct Metrics {
+          unsigned long measureHits;   //<!- Number of sizes served from the cache.
+          unsigned long measureMisses; //<!- Number of sizes computed by the engine.
+          unsigned long rasterHits;    //<!- Number of textures served from the cache.
+          unsigned long rasterMisses;  //<!- Number of textures rendered by the engine.
+          unsigned long evictions;     //<!- Number of entries evicted from the cache.
+          std::size_t entries;         //<!- Number of entries currently cached.
+          std::size_t bytes;           //<!- Estimated size of the cached data.
+          std::size_t budget;          //<!- Maximum size of the cached data.
+        };
+
+      public:
+
+        /**
+         * @brief - Retrieves the process-wide cache shared by all the widgets of the
+         *          library.
+         * @return - the text cache.
+         */
+        static
+        TextCache&
+        getInstance();
+
+        /**
+         * @brief - Similarly to the `FontRegistry` the textures still cached when the
+         *          cache is destroyed are not released as the engine may already be
+         *          gone by then. Use the `detach` method of the `EngineHandle` to
+         *          release them beforehand.
+         */
+        ~TextCache();
+
+        /**
+         * @brief - Retrieves the size of the input text when rendered with the font.
+         *          The result is cached so that measuring the same string again does
+         *          not involve the engine: this is meant for strings measured again
+         *          and again (such as the cursor) rather than transient ones (such as
+         *          prefixes of an edited text) which should be measured directly.
+         * @param engine - the engine to use to measure the text if needed.
+         * @param text - the text to measure.
+         * @param font - the font used to render the text.
+         * @param exact - `true` if the exact dimensions of the glyphs are needed.
+         * @return - the size of the rendered text.
+         */
+        template <typename Engine>
+        utils::Sizef
+        getTextSize(Engine& engine,
+                    const std::string& text,
+                    const utils::Uuid& font,
+                    bool exact);
+
+        /**
+         * @brief - Retrieves a texture representing the input text rendered with the
+         *          font and color role. The texture is shared with any other user of
+         *          the same text and should thus not be modified: it should also be
+         *          given back with `release` rather than destroyed.
+         *          The texture is destroyed through the handle of the engine when it
+         *          gets evicted so the engine should be detached before being
+         *          destroyed.
+         * @param engine - the engine to use to render the text if needed.
+         * @param text - the text to render.
+         * @param font - the font to use to render the text.
+         * @param role - the color role of the text.
+         * @return - the identifier of the texture.
+         */
+        template <typename Engine>
+        utils::Uuid
+        acquireText(Engine& engine,
+                    const std::string& text,
+                    const utils::Uuid& font,
+                    const core::engine::Palette::ColorRole& role);
+
+        /**
+         * @brief - Gives back a texture obtained through `acquireText`. The texture
+         *          stays in the cache until it gets evicted.
+         * @param texture - the texture to release.
+         */
+        void
+        release(const utils::Uuid& texture);
+
+        /**
+         * @brief - Defines the maximum amount of memory in bytes that the cache can
+         *          use. Reducing the budget may trigger evictions. Note that textures
+         *          in use cannot be evicted so the budget can be exceeded temporarily.
+         * @param bytes - the budget of the cache.
+         */
+        void
+        setBudget(std::size_t bytes);
+
+        /**
+         * @brief - Removes the entries (measurements and textures) computed with the
+         *          input font. This is used when the font is unloaded: its identifier
+         *          is not valid anymore so the entries could never be reused. Entries
+         *          still in use are kept until they are evicted.
+         * @param font - the font being unloaded.
+         */
+        void
+        purgeFont(const utils::Uuid& font);
+
+        /**
+         * @brief - Destroys the unused textures created through the input engine and
+         *          forgets about the engine for the textures still in use: they will
+         *          be discarded without being destroyed once released. This is used
+         *          when the engine is detached.
+         * @param engine - the handle of the engine being detached.
+         */
+        void
+        purge(EngineHandle& engine);
+
+        /**
+         * @brief - Retrieves the counters of this cache.
+         * @return - the metrics of the cache.
+         */
+        Metrics
+        getMetrics();
+
+      private:
+
+        /**
+         * @brief - Describes the type of data held by an entry.
+         */
+        enum class Kind {
+          Measure,
+          Raster
+        };
+
+        /**
+         * @brief - The key of an entry: measurements use the `exact` flag while the
+         *          textures use the role.
+         */
+        struct Key {
+          Kind kind;
+          utils::Uuid font;
+          bool exact;
+          core::engine::Palette::ColorRole role;
+          std::string text;
+
+          bool
+          operator<(const Key& rhs) const noexcept;
+        };
+
+        /**
+         * @brief - Only the entries which are not in use can be evicted: they are the
+         *          only ones registered in the usage index. The `engine` is used to
+         *          destroy the texture of the entry if any.
+         */
+        struct Entry {
+          utils::Sizef size;
+          utils::Uuid texture;
+          unsigned refs;
+          std::size_t bytes;
+          EngineHandleShPtr engine;
+        };
+
+        using EntriesMap = std::map<Key, Entry>;
+        using TexturesMap = std::map<utils::Uuid, EntriesMap::iterator>;
+
+        TextCache();
+
+        /**
+         * @brief - Defines the default budget of the cache in bytes.
+         * @return - the default budget of the cache.
+         */
+        static
+        std::size_t
+        getDefaultBudget() noexcept;
+
+        /**
+         * @brief - Inserts a new entry for the input key and evicts the least recently
+         *          used entries if the budget is exceeded. The new entry is never
+         *          evicted by this operation.
+         *          Assumes that the locker is already acquired.
+         * @param key - the key of the entry.
+         * @param entry - the data of the entry.
+         * @return - an iterator on the inserted entry.
+         */
+        EntriesMap::iterator
+        insert(const Key& key,
+               Entry entry);
+
+        /**
+         * @brief - Evicts the least recently used entries which are not in use until
+         *          the size of the cache fits in the budget.
+         *          Assumes that the locker is already acquired.
+         */
+        void
+        evict();
+
+      private:
+
+        /**
+         * @brief - Protects concurrent accesses to the cache.
+         */
+        std::mutex m_locker;
+
+        /**
+         * @brief - The cached entries along with the order of use of the ones which
+         *          can be evicted and an index of the textures to speed up the release
+         *          operation.
+         */
+        EntriesMap m_entries;
+        LruIndex<Key> m_lru;
+        TexturesMap m_textures;
+
+        Metrics m_metrics;
+    };
+
+  }
+}
+
+# include "TextCache.hxx"
+
+#endif    /* TEXT_CACHE_HH */
@@ -0,0 +1,133 @@
+#ifndef    TEXT_CACHE_HXX
+# define   TEXT_CACHE_HXX
+
+# include <tuple>
+# include "TextCache.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    inline
+    TextCache::~TextCache() {}
+
+    template <typename Engine>
+    inline
+    utils::Sizef
+    TextCache::getTextSize(Engine& engine,
+                           const std::string& text,
+                           const utils::Uuid& font,
+                           bool exact)
+    {
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      Key key{Kind::Measure, font, exact, core::engine::Palette::ColorRole::WindowText, text};
+
+      EntriesMap::iterator it = m_entries.find(key);
+      if (it != m_entries.end()) {
+        ++m_metrics.measureHits;
+        m_lru.touch(key);
+
+        return it->second.size;
+      }
+
+      ++m_metrics.measureMisses;
+
+      // Measure the text and register it: the footprint of such an entry is
+      // mostly due to the text itself.
+      utils::Sizef size = engine.getTextSize(text, font, exact);
+
+      insert(key, Entry{size, utils::Uuid(), 0u, sizeof(Entry) + 2u * text.size(), nullptr});
+
+      return size;
+    }
+
+    template <typename Engine>
+    inline
+    utils::Uuid
+    TextCache::acquireText(Engine& engine,
+                           const std::string& text,
+                           const utils::Uuid& font,
+                           const core::engine::Palette::ColorRole& role)
+    {
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      Key key{Kind::Raster, font, false, role, text};
+
+      EntriesMap::iterator it = m_entries.find(key);
+      if (it != m_entries.end()) {
+        ++m_metrics.rasterHits;
+
+        // The entry cannot be evicted while it is in use.
+        if (it->second.refs == 0u) {
+          m_lru.remove(key);
+        }
+        ++it->second.refs;
+
+        return it->second.texture;
+      }
+
+      ++m_metrics.rasterMisses;
+
+      // Render the text: if this fails we don't cache anything.
+      utils::Uuid tex = engine.createTextureFromText(text, font, role);
+      if (!tex.valid()) {
+        return tex;
+      }
+
+      // The footprint of such an entry is dominated by the pixels of the
+      // texture, assuming four bytes per pixel.
+      utils::Sizef size = engine.queryTexture(tex);
+      const std::size_t bytes = sizeof(Entry) + 2u * text.size() + static_cast<std::size_t>(size.w() * size.h() * 4.0f);
+
+      it = insert(
+        key,
+        Entry{
+          size,
+          tex,
+          1u,
+          bytes,
+          EngineHandle::attach(engine)
+        }
+      );
+
+      m_textures[tex] = it;
+
+      return tex;
+    }
+
+    inline
+    void
+    TextCache::setBudget(std::size_t bytes) {
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      m_metrics.budget = bytes;
+      evict();
+    }
+
+    inline
+    TextCache::Metrics
+    TextCache::getMetrics() {
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      return m_metrics;
+    }
+
+    inline
+    bool
+    TextCache::Key::operator<(const Key& rhs) const noexcept {
+      return
+        std::tie(kind, font, exact, role, text) <
+        std::tie(rhs.kind, rhs.font, rhs.exact, rhs.role, rhs.text)
+      ;
+    }
+
+    inline
+    std::size_t
+    TextCache::getDefaultBudget() noexcept {
+      return 8u * 1024u * 1024u;
+    }
+
+  }
+}
+
+#endif    /* TEXT_CACHE_HXX */
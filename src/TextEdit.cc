@@ -0,0 +1,676 @@
+# include "TextEdit.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    TextEdit::TextEdit(const std::string& name,
+                       const std::string& font,
+                       const std::string& text,
+                       unsigned size,
+                       core::SdlWidget* parent,
+                       const utils::Sizef& area):
+      ScrollableWidget(name, parent, area),
+      TextEditing(true),
+
+      m_document(text),
+
+      m_cursorIndex(0u),
+      m_cursorVisible(false),
+      m_cursorChanged(true),
+
+      m_selectionStart(m_cursorIndex),
+      m_selectionStarted(false),
+
+      m_fontName(font),
+      m_fontSize(size),
+      m_font(),
+      m_lineHeight(0.0f),
+
+      m_textRole(core::engine::Palette::ColorRole::WindowText),
+
+      m_firstLine(0u),
+
+      m_horizontalOffset(0.0f),
+      m_visibleWidth(0.0f),
+
+      m_textChanged(true),
+      m_edited(false),
+
+      m_lines(),
+
+      m_cursor(),
+
+      m_propsLocker(),
+
+      onValueChanged()
+    {
+      // Build the internal state of this editor.
+      build();
+    }
+
+    TextEdit::~TextEdit() {
+      // Clear text.
+      clearText();
+
+      // Clear cursor.
+      clearCursor();
+
+      // Give back the font to the registry.
+      if (m_font.valid()) {
+        FontRegistry::getInstance().release(m_font);
+      }
+    }
+
+    void
+    TextEdit::updatePrivate(const utils::Boxf& window) {
+      {
+        // Protect from concurrent accesses.
+        Guard guard(m_propsLocker);
+
+        // The number of visible lines depends on the height of the widget so
+        // we need to rebuild them.
+        setTextChanged();
+      }
+
+      // Use the base handler.
+      ScrollableWidget::updatePrivate(window);
+    }
+
+    bool
+    TextEdit::keyPressEvent(const core::engine::KeyEvent& e) {
+      // Lock this object.
+      Guard guard(m_propsLocker);
+
+      // The interpretation of the key is shared with the `TextBox`: the vertical
+      // motions and the insertion of line breaks are enabled for this editor.
+      const bool toReturn = core::SdlWidget::keyPressEvent(e);
+
+      handleKeyPress(e);
+
+      return toReturn;
+    }
+
+    bool
+    TextEdit::mouseButtonReleaseEvent(const core::engine::MouseEvent& e) {
+      // Lock this object.
+      Guard guard(m_propsLocker);
+
+      // Move the cursor to the character closest to the click: see the
+      // `TextBox` for more details.
+      bool toReturn = ScrollableWidget::mouseButtonReleaseEvent(e);
+
+      if (e.wasDragged()) {
+        return toReturn;
+      }
+
+      handleClick(closestCharacterFrom(mapFromGlobal(e.getMousePosition())));
+
+      return toReturn;
+    }
+
+    bool
+    TextEdit::mouseDoubleClickEvent(const core::engine::MouseEvent& e) {
+      // Lock this object.
+      Guard guard(m_propsLocker);
+
+      // Select the word under the cursor.
+      handleDoubleClick();
+
+      return ScrollableWidget::mouseDoubleClickEvent(e);
+    }
+
+    bool
+    TextEdit::mouseDragEvent(const core::engine::MouseEvent& e) {
+      // Lock this object.
+      Guard guard(m_propsLocker);
+
+      // We only want to react to the left mouse button: this is the button
+      // triggering the selection behavior. Note that we deliberately bypass
+      // the `ScrollableWidget` handler which would scroll the content.
+      core::engine::mouse::Button sensitive = core::engine::mouse::Button::Left;
+
+      if (!e.getButtons().isSet(sensitive)) {
+        return core::SdlWidget::mouseDragEvent(e);
+      }
+
+      // Select the text between the start of the drag and the current mouse
+      // position. Moving the cursor also scrolls the content if the mouse is
+      // outside of the widget.
+      std::size_t idStart = closestCharacterFrom(mapFromGlobal(e.getInitMousePosition(sensitive)));
+      std::size_t idCur = closestCharacterFrom(mapFromGlobal(e.getMousePosition()));
+
+      handleDrag(idStart, idCur);
+
+      return core::SdlWidget::mouseDragEvent(e);
+    }
+
+    bool
+    TextEdit::mouseWheelEvent(const core::engine::MouseEvent& e) {
+      // Only react if the mouse is inside this widget.
+      if (!isMouseInside()) {
+        return ScrollableWidget::mouseWheelEvent(e);
+      }
+
+      // A positive scroll corresponds to a motion towards the beginning of
+      // the document (or of the lines for the horizontal axis).
+      const utils::Vector2i steps = e.getScroll();
+
+      if (steps.x() == 0 && steps.y() == 0) {
+        return ScrollableWidget::mouseWheelEvent(e);
+      }
+
+      Guard guard(m_propsLocker);
+
+      if (steps.y() != 0) {
+        const std::size_t delta = static_cast<std::size_t>(std::abs(steps.y())) * getLinesPerWheelStep();
+        std::size_t line = m_firstLine + delta;
+
+        if (steps.y() > 0) {
+          line = m_firstLine - std::min(m_firstLine, delta);
+        }
+
+        scrollToLinePrivate(line);
+      }
+
+      if (steps.x() != 0) {
+        scrollHorizontallyPrivate(m_horizontalOffset - static_cast<float>(steps.x()) * getLinesPerWheelStep() * m_lineHeight);
+      }
+
+      // The event is fully handled here: forwarding it to the base class would
+      // scroll the content a second time.
+      return true;
+    }
+
+    void
+    TextEdit::drawContentPrivate(const utils::Uuid& uuid,
+                                 const utils::Boxf& area)
+    {
+      // Acquire the lock on the attributes of this widget.
+      Guard guard(m_propsLocker);
+
+      // Rebuild the visible lines and the cursor if needed.
+      if (textChanged()) {
+        loadText();
+
+        m_textChanged = false;
+      }
+
+      if (cursorChanged()) {
+        loadCursor();
+
+        m_cursorChanged = false;
+      }
+
+      utils::Sizef sizeEnv = getEngine().queryTexture(uuid);
+      utils::Boxf env = utils::Boxf::fromSize(sizeEnv, true);
+
+      // Render each visible line along with its selection background.
+      for (unsigned id = 0u ; id < m_lines.size() ; ++id) {
+        const LineDesc& line = m_lines[id];
+        const float y = computeLineOrdinate(id, sizeEnv);
+
+        if (line.selection.valid()) {
+          utils::Sizef s = getEngine().queryTexture(line.selection);
+          utils::Boxf box(-sizeEnv.w() / 2.0f - m_horizontalOffset + line.selectionOffset + s.w() / 2.0f, y, s);
+
+          drawPartOnCanvas(line.selection, box, uuid, env, area);
+        }
+
+        if (line.text.valid()) {
+          utils::Sizef s = getEngine().queryTexture(line.text);
+          utils::Boxf box(-sizeEnv.w() / 2.0f - m_horizontalOffset + s.w() / 2.0f, y, s);
+
+          drawPartOnCanvas(line.text, box, uuid, env, area);
+        }
+      }
+
+      // Render the cursor if it is visible and lies in the displayed lines.
+      if (!m_cursor.valid() || !isCursorVisible()) {
+        return;
+      }
+
+      const std::size_t cursorLine = m_document.lineFromOffset(m_cursorIndex);
+
+      if (cursorLine >= m_firstLine && cursorLine < m_firstLine + m_lines.size()) {
+        drawPartOnCanvas(m_cursor, computeCursorPosition(sizeEnv), uuid, env, area);
+      }
+    }
+
+    void
+    TextEdit::build() {
+      // Only allow click and tab focus, similarly to the `TextBox`.
+      core::FocusPolicy f(core::focus::Type::Click);
+      f.set(core::focus::Type::Tab);
+      setFocusPolicy(f);
+
+      // Use the same palette as the `TextBox`.
+      core::engine::Palette palette = core::engine::Palette::fromButtonColor(
+        core::engine::Color::NamedColor::White
+      );
+
+      palette.setColorForRole(core::engine::Palette::ColorRole::Dark, core::engine::Color::NamedColor::White);
+
+      setPalette(palette);
+    }
+
+    void
+    TextEdit::updateCursorPosition(const CursorMotion& motion,
+                                   const CursorMotionMode& mode)
+    {
+      const std::size_t size = m_document.size();
+
+      // Vertical motions preserve the column of the cursor as much as possible.
+      if (motion == CursorMotion::Up || motion == CursorMotion::Down) {
+        const std::size_t line = m_document.lineFromOffset(m_cursorIndex);
+        const std::size_t column = m_cursorIndex - m_document.lineStart(line);
+
+        std::size_t step = 1u;
+        if (mode == CursorMotionMode::Page) {
+          step = std::max(getVisibleLinesCount(), static_cast<std::size_t>(1u));
+        }
+
+        std::size_t target = line - std::min(line, step);
+        if (motion == CursorMotion::Down) {
+          target = std::min(line + step, m_document.lineCount() - 1u);
+        }
+
+        updateCursorToPosition(m_document.lineStart(target) + std::min(column, m_document.lineLength(target)));
+
+        return;
+      }
+
+      if (motion == CursorMotion::Left) {
+        if (m_cursorIndex == 0u) {
+          return;
+        }
+
+        switch (mode) {
+          case CursorMotionMode::SingleChar:
+            updateCursorToPosition(m_cursorIndex - 1u);
+            break;
+          case CursorMotionMode::ToEnd:
+            updateCursorToPosition(m_document.lineStart(m_document.lineFromOffset(m_cursorIndex)));
+            break;
+          case CursorMotionMode::ToWord:
+            updateCursorToPosition(findPreviousWord(m_cursorIndex, false));
+            break;
+          case CursorMotionMode::ToWordOrSpace:
+            updateCursorToPosition(findPreviousWord(m_cursorIndex, true));
+            break;
+          default:
+            log("Could not move cursor given mode " + std::to_string(static_cast<int>(mode)), utils::Level::Warning);
+            break;
+        }
+
+        return;
+      }
+
+      if (m_cursorIndex >= size) {
+        return;
+      }
+
+      switch (mode) {
+        case CursorMotionMode::SingleChar:
+          updateCursorToPosition(m_cursorIndex + 1u);
+          break;
+        case CursorMotionMode::ToEnd:
+          {
+            const std::size_t line = m_document.lineFromOffset(m_cursorIndex);
+            updateCursorToPosition(m_document.lineStart(line) + m_document.lineLength(line));
+          }
+          break;
+        case CursorMotionMode::ToWord:
+          updateCursorToPosition(findNextWord(m_cursorIndex, false));
+          break;
+        case CursorMotionMode::ToWordOrSpace:
+          updateCursorToPosition(findNextWord(m_cursorIndex, true));
+          break;
+        default:
+          log("Could not move cursor given mode " + std::to_string(static_cast<int>(mode)), utils::Level::Warning);
+          break;
+      }
+    }
+
+    void
+    TextEdit::updateCursorToPosition(std::size_t pos) {
+      const std::size_t old = m_cursorIndex;
+
+      m_cursorIndex = std::min(m_document.size(), pos);
+
+      if (old == m_cursorIndex) {
+        return;
+      }
+
+      // The cursor's texture depends on the selection, and so do the lines.
+      setCursorChanged();
+      if (selectionStarted()) {
+        setTextChanged();
+      }
+
+      ensureCursorVisible();
+    }
+
+    void
+    TextEdit::insertText(const std::string& text) {
+      // Insert the text in the document at the position of the cursor: this
+      // is a logarithmic operation no matter the size of the document.
+      m_document.insert(m_cursorIndex, text);
+
+      m_cursorIndex += text.size();
+      m_edited = true;
+
+      setTextChanged();
+      setCursorChanged();
+
+      ensureCursorVisible();
+    }
+
+    void
+    TextEdit::addCharToText(char c) {
+      insertText(std::string(1u, c));
+    }
+
+    void
+    TextEdit::removeCharFromText(bool forward) {
+      // Determine the range of characters to remove: it is either the current
+      // selection or the character before or after the cursor.
+      std::size_t toRemoveBegin = 0u;
+      std::size_t toRemoveEnd = 0u;
+
+      if (selectionStarted()) {
+        if (!getSelectionRange(toRemoveBegin, toRemoveEnd)) {
+          return;
+        }
+      }
+      else {
+        if (forward && m_cursorIndex >= m_document.size()) {
+          return;
+        }
+        if (!forward && m_cursorIndex == 0u) {
+          return;
+        }
+
+        toRemoveBegin = (forward ? m_cursorIndex : m_cursorIndex - 1u);
+        toRemoveEnd = toRemoveBegin + 1u;
+      }
+
+      m_document.erase(toRemoveBegin, toRemoveEnd - toRemoveBegin);
+      m_edited = true;
+
+      // Keep the cursor at the same logical position.
+      if (selectionStarted() || !forward) {
+        updateCursorToPosition(toRemoveBegin);
+      }
+
+      setTextChanged();
+    }
+
+    void
+    TextEdit::scrollToLinePrivate(std::size_t line,
+                                  bool notify)
+    {
+      const std::size_t total = m_document.lineCount();
+
+      line = std::min(line, total - 1u);
+
+      if (line == m_firstLine) {
+        return;
+      }
+
+      m_firstLine = line;
+
+      // Only the visible lines need to be rebuilt.
+      setTextChanged();
+      setCursorChanged();
+
+      if (!notify) {
+        return;
+      }
+
+      // Notify listeners with the range of the document now visible, in a
+      // similar way to what is done by the `ScrollableWidget`.
+      const float min = 1.0f * m_firstLine / total;
+      const float max = std::min(1.0f, 1.0f * (m_firstLine + getVisibleLinesCount()) / total);
+
+      onVerticalAxisChanged.safeEmit(
+        std::string("onVerticalAxisChanged::emit([") + std::to_string(min) + " - " + std::to_string(max) + "])",
+        min, max
+      );
+    }
+
+    void
+    TextEdit::ensureCursorVisible() {
+      // Nothing can be done while the font is not loaded.
+      if (m_lineHeight <= 0.0f) {
+        return;
+      }
+
+      // Only consider the lines which are fully visible.
+      const float height = LayoutItem::getRenderingArea().h();
+      const std::size_t full = std::max(static_cast<std::size_t>(height / m_lineHeight), static_cast<std::size_t>(1u));
+
+      const std::size_t line = m_document.lineFromOffset(m_cursorIndex);
+
+      if (line < m_firstLine) {
+        scrollToLinePrivate(line);
+      }
+      else if (line >= m_firstLine + full) {
+        scrollToLinePrivate(line + 1u - full);
+      }
+
+      // Scroll horizontally so that the cursor is displayed: the widest line
+      // may not be known yet so we don't clamp the offset here.
+      if (!m_font.valid()) {
+        return;
+      }
+
+      const std::size_t start = m_document.lineStart(line);
+      const float width = LayoutItem::getRenderingArea().w();
+
+      const float x = getEngine().getTextSize(m_document.substr(start, m_cursorIndex - start), m_font, false).w();
+      const float cursor = TextCache::getInstance().getTextSize(getEngine(), std::string("|"), m_font, true).w();
+
+      float offset = m_horizontalOffset;
+      if (x < offset) {
+        offset = x;
+      }
+      else if (x + cursor > offset + width) {
+        offset = x + cursor - width;
+      }
+
+      if (offset != m_horizontalOffset) {
+        m_horizontalOffset = std::max(0.0f, offset);
+        m_visibleWidth = std::max(m_visibleWidth, x + cursor);
+
+        requestRepaint();
+      }
+    }
+
+    void
+    TextEdit::scrollHorizontallyPrivate(float offset) {
+      const float width = LayoutItem::getRenderingArea().w();
+
+      offset = std::max(0.0f, std::min(offset, m_visibleWidth - width));
+
+      if (offset == m_horizontalOffset) {
+        return;
+      }
+
+      m_horizontalOffset = offset;
+
+      // The textures of the lines do not change: only their position does.
+      requestRepaint();
+    }
+
+    void
+    TextEdit::loadText() {
+      // Clear existing lines if any.
+      clearText();
+
+      // Load the font: it is needed to determine the number of visible lines.
+      loadFont();
+
+      std::size_t selBegin = 0u, selEnd = 0u;
+      const bool hasSelection = getSelectionRange(selBegin, selEnd);
+
+      const std::size_t visible = getVisibleLinesCount();
+      const std::size_t total = m_document.lineCount();
+
+      m_visibleWidth = 0.0f;
+
+      // Only render the lines which are visible: each lookup in the document
+      // is logarithmic so the total cost only depends on the size of the widget.
+      for (std::size_t id = 0u ; id < visible && m_firstLine + id < total ; ++id) {
+        const std::size_t start = m_document.lineStart(m_firstLine + id);
+        const std::string text = m_document.substr(start, m_document.lineLength(m_firstLine + id));
+
+        LineDesc desc{utils::Uuid(), utils::Uuid(), 0.0f};
+
+        if (!text.empty()) {
+          desc.text = TextCache::getInstance().acquireText(getEngine(), text, m_font, m_textRole);
+          m_visibleWidth = std::max(m_visibleWidth, getEngine().queryTexture(desc.text).w());
+        }
+
+        // Create the selection background if the selection spans this line.
+        if (hasSelection && selBegin < start + text.size() && selEnd > start) {
+          const std::size_t from = std::max(selBegin, start) - start;
+          const std::size_t to = std::min(selEnd, start + text.size()) - start;
+
+          desc.selectionOffset = getEngine().getTextSize(text.substr(0u, from), m_font, false).w();
+          const float width = getEngine().getTextSize(text.substr(from, to - from), m_font, false).w();
+
+          desc.selection = getEngine().createTexture(
+            utils::Sizef(width, m_lineHeight),
+            core::engine::Palette::ColorRole::Highlight
+          );
+
+          if (!desc.selection.valid()) {
+            error(
+              std::string("Could not create selection background texture"),
+              std::string("Engine returned invalid uuid")
+            );
+          }
+
+          getEngine().fillTexture(desc.selection, getPalette());
+        }
+
+        m_lines.push_back(desc);
+      }
+    }
+
+    std::size_t
+    TextEdit::closestCharacterFrom(const utils::Vector2f& pos) const {
+      // Handle the case where the font is not valid.
+      if (!m_font.valid() || m_lineHeight <= 0.0f) {
+        log(
+          std::string("Could not find closest character from position ") + pos.toString() + ", font not loaded",
+          utils::Level::Warning
+        );
+
+        return 0u;
+      }
+
+      utils::Sizef area = LayoutItem::getRenderingArea().toSize();
+
+      // The line is directly deduced from the vertical position. Positions
+      // above or below the widget select lines outside of the visible ones.
+      const float rows = std::floor((area.h() / 2.0f - pos.y()) / m_lineHeight);
+      const float line = std::max(0.0f, m_firstLine + rows);
+
+      const std::size_t id = std::min(static_cast<std::size_t>(line), m_document.lineCount() - 1u);
+      const std::size_t start = m_document.lineStart(id);
+      const std::string text = m_document.substr(start, m_document.lineLength(id));
+
+      // Find the first prefix of the line whose width reaches the position.
+      // The width of the prefixes is increasing with their length so we can
+      // use a binary search. The prefixes are measured by the engine directly:
+      // they are hardly ever measured twice and would only evict useful entries
+      // from the text cache.
+      const float x = pos.x() + area.w() / 2.0f + m_horizontalOffset;
+
+      std::size_t low = 0u, high = text.size();
+
+      while (low < high) {
+        const std::size_t mid = (low + high) / 2u;
+
+        if (getEngine().getTextSize(text.substr(0u, mid), m_font, false).w() >= x) {
+          high = mid;
+        }
+        else {
+          low = mid + 1u;
+        }
+      }
+
+      // Determine whether the position is on the left or right half of the
+      // character, similarly to the `TextBox`.
+      if (low == 0u) {
+        return start;
+      }
+
+      const float with = getEngine().getTextSize(text.substr(0u, low), m_font, false).w();
+      if (with < x) {
+        // The position is beyond the end of the line.
+        return start + text.size();
+      }
+
+      const float without = getEngine().getTextSize(text.substr(0u, low - 1u), m_font, false).w();
+
+      if (x - without <= (with - without) / 2.0f) {
+        --low;
+      }
+
+      return start + low;
+    }
+
+    utils::Boxf
+    TextEdit::computeCursorPosition(const utils::Sizef& env) const {
+      if (!m_cursor.valid() || !m_font.valid()) {
+        error(
+          std::string("Could not compute cursor position in text edit"),
+          std::string("Invalid cursor texture or font")
+        );
+      }
+
+      // Compute the width of the part of the line before the cursor.
+      const std::size_t line = m_document.lineFromOffset(m_cursorIndex);
+      const std::size_t start = m_document.lineStart(line);
+
+      utils::Sizef text = getEngine().getTextSize(m_document.substr(start, m_cursorIndex - start), m_font, false);
+      utils::Sizef sizeCursor = TextCache::getInstance().getTextSize(getEngine(), std::string("|"), m_font, true);
+
+      return utils::Boxf(
+        -env.w() / 2.0f - m_horizontalOffset + text.w() + sizeCursor.w() / 2.0f,
+        computeLineOrdinate(line - m_firstLine, env),
+        sizeCursor
+      );
+    }
+
+    void
+    TextEdit::drawPartOnCanvas(const utils::Uuid& uuid,
+                               const utils::Boxf& localDst,
+                               const utils::Uuid& canvas,
+                               const utils::Boxf& env,
+                               const utils::Boxf& toUpdate)
+    {
+      // Determine whether some part of the input `uuid` texture are spanned by the
+      // area to update.
+      utils::Boxf dstRectToUpdate = localDst.intersect(toUpdate);
+
+      if (!dstRectToUpdate.valid()) {
+        return;
+      }
+
+      utils::Sizef sizeText = getEngine().queryTexture(uuid);
+
+      // Convert the area to repaint to the local `uuid` coordinate frame and then
+      // to engine format.
+      utils::Boxf srcRect = convertToLocal(dstRectToUpdate, localDst);
+
+      utils::Boxf srcRectEngine = convertToEngineFormat(srcRect, sizeText);
+      utils::Boxf dstRectEngine = convertToEngineFormat(dstRectToUpdate, env);
+
+      getEngine().drawTexture(uuid, &srcRectEngine, &canvas, &dstRectEngine);
+    }
+
+  }
+}
@@ -0,0 +1,441 @@
+#ifndef    TEXT_EDIT_HH
+# define   TEXT_EDIT_HH
+
+# include <mutex>
+# include <memory>
+# include <string>
+# include <vector>
+# include <core_utils/Uuid.hh>
+# include <core_utils/Signal.hh>
+# include "ScrollableWidget.hh"
+# include "PieceTable.hh"
+# include "FontRegistry.hh"
+# include "TextCache.hh"
+# include "TextEditing.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    class TextEdit: public ScrollableWidget, private TextEditing {
+      public:
+
+        /**
+         * @brief - Creates a new multi-line text editor with the specified properties.
+         *          The text is stored in a piece table which allows edits and lines
+         *          lookups to be performed in logarithmic time no matter the size of
+         *          the document. Only the lines visible in the widget are rendered.
+         * @param name - the name of `this` text edit.
+         * @param font - the name of the font to use to render the text.
+         * @param text - the initial content of the editor.
+         * @param size - the size of the font to use to render the text.
+         * @param parent - a pointer to the parent widget for this text edit.
+         * @param area - the size hint for this text edit.
+         */
+        TextEdit(const std::string& name,
+                 const std::string& font,
+                 const std::string& text = std::string(),
+                 unsigned size = 15,
+                 core::SdlWidget* parent = nullptr,
+                 const utils::Sizef& area = utils::Sizef());
+
+        virtual ~TextEdit();
+
+        /**
+         * @brief - Used to retrieve the whole text currently displayed in this editor.
+         *          Note that this operation is linear in the size of the document.
+         * @return - the text of this editor.
+         */
+        std::string
+        getValue();
+
+        /**
+         * @brief - Replaces the content of this editor with the input text. The cursor
+         *          is moved to the beginning of the document.
+         * @param value - the new text to display.
+         */
+        void
+        setValue(const std::string& value);
+
+        /**
+         * @brief - Returns the number of lines of the document displayed in this editor.
+         * @return - the number of lines of the document.
+         */
+        std::size_t
+        getLinesCount();
+
+        /**
+         * @brief - Scrolls the content of the editor so that the input line is the first
+         *          one displayed. The line is clamped to the range of existing lines.
+         * @param line - the index of the line to display first.
+         */
+        void
+        scrollToLine(std::size_t line);
+
+      protected:
+
+        /**
+         * @brief - Reimplementation of the base `ScrollableWidget` method in order to
+         *          rebuild the visible lines: their number depends on the height of
+         *          the widget.
+         * @param window - the available size to perform the update.
+         */
+        void
+        updatePrivate(const utils::Boxf& window) override;
+
+        /**
+         * @brief - Reimplementation of the base `ScrollableWidget` method in order to
+         *          provide the size of the whole document rather than the one of a
+         *          support widget. The height is computed from the number of lines
+         *          which is available in constant time.
+         *          Assumes that the locker is already acquired.
+         * @return - the preferred size of this editor.
+         */
+        utils::Sizef
+        getPreferredSizePrivate() const noexcept override;
+
+        bool
+        keyboardGrabbedEvent(const core::engine::Event& e) override;
+
+        /**
+         * @brief - Reimplementation of the base `SdlWidget` method to hide the cursor.
+         *          Listeners of the `onValueChanged` signal are notified at this step
+         *          in case the text was modified while the editor had the focus.
+         * @param e - the event to process.
+         * @return - `true` if the event was recognized, `false` otherwise.
+         */
+        bool
+        keyboardReleasedEvent(const core::engine::Event& e) override;
+
+        /**
+         * @brief - Reimplementation of the base `SdlWidget` method. Follows the same
+         *          semantic as the `TextBox` with the additional vertical motions and
+         *          the insertion of line breaks with the `Return` key.
+         * @param e - the event to process.
+         * @return - `true` if the event was recognized, `false` otherwise.
+         */
+        bool
+        keyPressEvent(const core::engine::KeyEvent& e) override;
+
+        bool
+        mouseButtonReleaseEvent(const core::engine::MouseEvent& e) override;
+
+        bool
+        mouseDoubleClickEvent(const core::engine::MouseEvent& e) override;
+
+        /**
+         * @brief - Reimplementation of the base `ScrollableWidget` method. Unlike the
+         *          base class a drag event is used to select text rather than scroll
+         *          the content: scrolling is provided by the mouse wheel, the page
+         *          keys and the cursor motion.
+         * @param e - the event to process.
+         * @return - `true` if the event was recognized, `false` otherwise.
+         */
+        bool
+        mouseDragEvent(const core::engine::MouseEvent& e) override;
+
+        bool
+        mouseWheelEvent(const core::engine::MouseEvent& e) override;
+
+        /**
+         * @brief - Reimplementation of the base `SdlWidget` method. Only the lines which
+         *          are visible in the widget are rendered.
+         * @param uuid - the identifier of the canvas which we can use to draw the text.
+         * @param area - the area of the canvas to update.
+         */
+        void
+        drawContentPrivate(const utils::Uuid& uuid,
+                           const utils::Boxf& area) override;
+
+      private:
+
+        /**
+         * @brief - Describes the textures used to render a visible line: the text itself
+         *          and the background of the selection if it spans this line.
+         */
+        struct LineDesc {
+          utils::Uuid text;
+          utils::Uuid selection;
+          float selectionOffset;
+        };
+
+        /**
+         * @brief - Defines the number of lines scrolled by a single step of the wheel.
+         * @return - the number of lines scrolled by a wheel step.
+         */
+        static
+        std::size_t
+        getLinesPerWheelStep() noexcept;
+
+        void
+        build();
+
+        /**
+         * @brief - Reimplementation of the `TextEditing` hooks providing access to the text
+         *          of the document.
+         */
+        std::size_t
+        getTextLength() const noexcept override;
+
+        char
+        getCharacterAt(std::size_t id) const noexcept override;
+
+        void
+        updateCursorState(const bool visible) override;
+
+        /**
+         * @brief - Reimplementation of the `TextEditing` hook to move the cursor. Unlike the
+         *          `TextBox` the vertical motions are handled, and the horizontal motions to
+         *          the end of the text stop at the boundaries of the current line.
+         * @param motion - the direction into which the cursor should be moved.
+         * @param mode - the amplitude of the motion.
+         */
+        void
+        updateCursorPosition(const CursorMotion& motion,
+                             const CursorMotionMode& mode = CursorMotionMode::SingleChar) override;
+
+        /**
+         * @brief - Moves the cursor to the specified offset in the document. The offset
+         *          is clamped to the size of the document and the content is scrolled
+         *          if needed so that the cursor stays visible.
+         *          Assumes that the locker is already acquired.
+         * @param pos - the new offset of the cursor.
+         */
+        void
+        updateCursorToPosition(std::size_t pos) override;
+
+        /**
+         * @brief - Inserts the input text at the position of the cursor and moves the
+         *          cursor after it.
+         *          Assumes that the locker is already acquired.
+         * @param text - the text to insert.
+         */
+        void
+        insertText(const std::string& text);
+
+        /**
+         * @brief - Reimplementation of the `TextEditing` hook to insert a character at the
+         *          position of the cursor.
+         *          Assumes that the locker is already acquired.
+         * @param c - the character to insert.
+         */
+        void
+        addCharToText(char c) override;
+
+        void
+        removeCharFromText(bool forward) override;
+
+        void
+        startSelection() noexcept override;
+
+        void
+        stopSelection() noexcept override;
+
+        /**
+         * @brief - Retrieves the range of characters currently selected if any.
+         *          Assumes that the locker is already acquired.
+         * @param begin - output argument receiving the first selected character.
+         * @param end - output argument receiving the end of the selection.
+         * @return - `true` if at least a character is selected.
+         */
+        bool
+        getSelectionRange(std::size_t& begin,
+                          std::size_t& end) const noexcept;
+
+        /**
+         * @brief - Returns the number of lines which can be displayed given the
+         *          current size of the widget. In case the font is not loaded yet
+         *          the value returned is `0`.
+         *          Assumes that the locker is already acquired.
+         * @return - the number of lines visible in the widget.
+         */
+        std::size_t
+        getVisibleLinesCount() const noexcept;
+
+        /**
+         * @brief - Scrolls the content so that `line` is the first line displayed
+         *          and notifies listeners of the `onVerticalAxisChanged` signal if
+         *          requested.
+         *          Assumes that the locker is already acquired.
+         * @param line - the first line to display.
+         * @param notify - `true` if the listeners should be notified.
+         */
+        void
+        scrollToLinePrivate(std::size_t line,
+                            bool notify = true);
+
+        /**
+         * @brief - Scrolls the content horizontally so that the left border of the widget
+         *          displays the input abscissa of the lines. The offset is clamped so that
+         *          the content is not scrolled past the widest visible line.
+         *          Assumes that the locker is already acquired.
+         * @param offset - the abscissa of the lines to display on the left border.
+         */
+        void
+        scrollHorizontallyPrivate(float offset);
+
+        /**
+         * @brief - Scrolls the content if needed so that the line containing the cursor
+         *          is visible, and so that the cursor itself is horizontally visible in
+         *          case the line is wider than the widget.
+         *          Assumes that the locker is already acquired.
+         */
+        void
+        ensureCursorVisible();
+
+        void
+        loadFont();
+
+        void
+        loadText();
+
+        void
+        loadCursor();
+
+        void
+        clearText();
+
+        void
+        clearCursor();
+
+        bool
+        isCursorVisible() const noexcept;
+
+        bool
+        selectionStarted() const noexcept override;
+
+        /**
+         * @brief - Used to determine the offset of the character closest to the input
+         *          position. The line is deduced from the vertical position in constant
+         *          time while the character in the line is found through a binary
+         *          search on the width of the rendered prefixes.
+         * @param pos - a position expressed in local coordinate frame.
+         * @return - the offset of the closest character in the document.
+         */
+        std::size_t
+        closestCharacterFrom(const utils::Vector2f& pos) const;
+
+        bool
+        textChanged() const noexcept;
+
+        void
+        setTextChanged() noexcept;
+
+        bool
+        cursorChanged() const noexcept;
+
+        void
+        setCursorChanged() noexcept;
+
+        /**
+         * @brief - Computes the position of the line at index `visible` among the lines
+         *          displayed. The returned value corresponds to the vertical position
+         *          of the center of the line.
+         * @param visible - the index of the line among the visible ones.
+         * @param env - the dimensions of the canvas.
+         * @return - the vertical position of the center of the line.
+         */
+        float
+        computeLineOrdinate(std::size_t visible,
+                            const utils::Sizef& env) const noexcept;
+
+        utils::Boxf
+        computeCursorPosition(const utils::Sizef& env) const;
+
+        void
+        drawPartOnCanvas(const utils::Uuid& uuid,
+                         const utils::Boxf& localDst,
+                         const utils::Uuid& canvas,
+                         const utils::Boxf& env,
+                         const utils::Boxf& toUpdate);
+
+      private:
+
+        /**
+         * @brief - The document displayed by this editor. All the edits are performed
+         *          on the piece table which also provides the line index used to find
+         *          the lines to display.
+         */
+        PieceTable m_document;
+
+        /**
+         * @brief - Offset of the cursor in the document, along with its visibility
+         *          status and a dirty flag indicating that the texture representing
+         *          it should be rebuilt.
+         */
+        std::size_t m_cursorIndex;
+        bool m_cursorVisible;
+        bool m_cursorChanged;
+
+        /**
+         * @brief - Description of the selection: the selection spans the characters
+         *          between `m_selectionStart` and the cursor's position.
+         */
+        std::size_t m_selectionStart;
+        bool m_selectionStarted;
+
+        /**
+         * @brief - Information about the font used to render the text. The height of a
+         *          line is computed when the font is loaded.
+         */
+        std::string m_fontName;
+        unsigned m_fontSize;
+        utils::Uuid m_font;
+        float m_lineHeight;
+
+        core::engine::Palette::ColorRole m_textRole;
+
+        /**
+         * @brief - Index of the first line displayed in the widget.
+         */
+        std::size_t m_firstLine;
+
+        /**
+         * @brief - Horizontal scrolling of the lines: the offset is the abscissa of the
+         *          lines displayed on the left border of the widget while the width is the
+         *          one of the widest line currently visible.
+         */
+        float m_horizontalOffset;
+        float m_visibleWidth;
+
+        /**
+         * @brief - Indicates that the textures of the visible lines should be rebuilt:
+         *          this happens when the text, the selection or the visible lines are
+         *          modified.
+         */
+        bool m_textChanged;
+
+        /**
+         * @brief - Indicates that the text has been modified since the editor last grabbed
+         *          the keyboard focus.
+         */
+        bool m_edited;
+
+        /**
+         * @brief - The textures of the lines currently visible, ordered from the first
+         *          line displayed.
+         */
+        std::vector<LineDesc> m_lines;
+
+        utils::Uuid m_cursor;
+
+        /**
+         * @brief - Used to protect concurrent accesses to the internal data of this editor.
+         */
+        std::mutex m_propsLocker;
+
+      public:
+
+        /**
+         * @brief - Signal emitted whenever the editor loses the keyboard focus after its
+         *          content has been modified.
+         */
+        utils::Signal<const std::string&> onValueChanged;
+    };
+
+    using TextEditShPtr = std::shared_ptr<TextEdit>;
+  }
+}
+
+# include "TextEdit.hxx"
+
+#endif    /* TEXT_EDIT_HH */
@@ -0,0 +1,334 @@
+#ifndef    TEXT_EDIT_HXX
+# define   TEXT_EDIT_HXX
+
+# include <cmath>
+# include "TextEdit.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    inline
+    std::string
+    TextEdit::getValue() {
+      // Acquire the lock on the attributes of this widget.
+      Guard guard(m_propsLocker);
+
+      return m_document.toString();
+    }
+
+    inline
+    void
+    TextEdit::setValue(const std::string& value) {
+      // Acquire the lock on the attributes of this widget.
+      Guard guard(m_propsLocker);
+
+      // Stop any selection if needed.
+      if (m_selectionStarted) {
+        stopSelection();
+      }
+
+      // Replace the document and move back to its beginning.
+      m_document.reset(value);
+
+      m_cursorIndex = 0u;
+      scrollToLinePrivate(0u);
+
+      m_horizontalOffset = 0.0f;
+
+      setTextChanged();
+      setCursorChanged();
+    }
+
+    inline
+    std::size_t
+    TextEdit::getLinesCount() {
+      // Acquire the lock on the attributes of this widget.
+      Guard guard(m_propsLocker);
+
+      return m_document.lineCount();
+    }
+
+    inline
+    void
+    TextEdit::scrollToLine(std::size_t line) {
+      // Acquire the lock on the attributes of this widget.
+      Guard guard(m_propsLocker);
+
+      scrollToLinePrivate(line);
+    }
+
+    inline
+    utils::Sizef
+    TextEdit::getPreferredSizePrivate() const noexcept {
+      // The document spans the width of this widget and as many lines as
+      // needed vertically.
+      return utils::Sizef(
+        LayoutItem::getRenderingArea().w(),
+        m_lineHeight * m_document.lineCount()
+      );
+    }
+
+    inline
+    bool
+    TextEdit::keyboardGrabbedEvent(const core::engine::Event& e) {
+      // Acquire the lock on the attributes of this widget.
+      Guard guard(m_propsLocker);
+
+      // Display the cursor and start tracking modifications of the text.
+      updateCursorState(true);
+      m_edited = false;
+
+      // Use the base handler method to provide a return value.
+      return core::SdlWidget::keyboardGrabbedEvent(e);
+    }
+
+    inline
+    bool
+    TextEdit::keyboardReleasedEvent(const core::engine::Event& e) {
+      bool notify = false;
+      std::string value;
+
+      {
+        // Acquire the lock on the attributes of this widget.
+        Guard guard(m_propsLocker);
+
+        // Hide the cursor as the user does not want to edit the text anymore.
+        updateCursorState(false);
+
+        // Retrieve the value to notify if the text was modified: assembling the
+        // whole document is linear so we only want to do it when needed.
+        notify = m_edited;
+        if (m_edited) {
+          value = m_document.toString();
+          m_edited = false;
+        }
+      }
+
+      // Notify listeners outside of the locked section.
+      if (notify) {
+        onValueChanged.safeEmit(
+          std::string("onValueChanged(") + std::to_string(value.size()) + " character(s))",
+          value
+        );
+      }
+
+      // Use the base handler method to provide a return value.
+      return core::SdlWidget::keyboardReleasedEvent(e);
+    }
+
+    inline
+    std::size_t
+    TextEdit::getLinesPerWheelStep() noexcept {
+      return 3u;
+    }
+
+    inline
+    std::size_t
+    TextEdit::getTextLength() const noexcept {
+      return m_document.size();
+    }
+
+    inline
+    char
+    TextEdit::getCharacterAt(std::size_t id) const noexcept {
+      return m_document.at(id);
+    }
+
+    inline
+    void
+    TextEdit::updateCursorState(const bool visible) {
+      bool old = m_cursorVisible;
+
+      // Update the cursor's internal state.
+      m_cursorVisible = visible;
+
+      // Request a repaint event if needed.
+      if (old != m_cursorVisible) {
+        requestRepaint();
+      }
+    }
+
+    inline
+    void
+    TextEdit::startSelection() noexcept {
+      // Register the current cursor's index in order to perform the selection.
+      m_selectionStarted = true;
+      m_selectionStart = m_cursorIndex;
+    }
+
+    inline
+    void
+    TextEdit::stopSelection() noexcept {
+      // Detect cases where the selection was not active.
+      if (!m_selectionStarted) {
+        log(
+          std::string("Stopping selection while none has been started"),
+          utils::Level::Warning
+        );
+
+        return;
+      }
+
+      m_selectionStarted = false;
+
+      // The selection background should be removed if it contained at least
+      // one character.
+      if (m_selectionStart != m_cursorIndex) {
+        setTextChanged();
+        setCursorChanged();
+      }
+    }
+
+    inline
+    bool
+    TextEdit::getSelectionRange(std::size_t& begin,
+                                std::size_t& end) const noexcept
+    {
+      if (!selectionStarted()) {
+        return false;
+      }
+
+      begin = std::min(m_cursorIndex, m_selectionStart);
+      end = std::max(m_cursorIndex, m_selectionStart);
+
+      return begin != end;
+    }
+
+    inline
+    std::size_t
+    TextEdit::getVisibleLinesCount() const noexcept {
+      // We can't determine anything while the font is not loaded.
+      if (m_lineHeight <= 0.0f) {
+        return 0u;
+      }
+
+      // Account for partially visible lines at the bottom of the widget.
+      const float height = LayoutItem::getRenderingArea().h();
+
+      return static_cast<std::size_t>(std::ceil(height / m_lineHeight));
+    }
+
+    inline
+    void
+    TextEdit::loadFont() {
+      // Only load the font if it has not yet been done.
+      if (m_font.valid()) {
+        return;
+      }
+
+      // Borrow the font from the registry.
+      m_font = FontRegistry::getInstance().acquire(getEngine(), m_fontName, m_fontSize, getPalette());
+
+      if (!m_font.valid()) {
+        error(
+          std::string("Cannot load font \"") + m_fontName + "\" for text edit",
+          std::string("Invalid null font")
+        );
+      }
+
+      // The height of a line is the height of a character of the font. We use
+      // a character spanning the whole vertical extent of the glyphs.
+      m_lineHeight = TextCache::getInstance().getTextSize(getEngine(), std::string("|"), m_font, true).h();
+    }
+
+    inline
+    void
+    TextEdit::loadCursor() {
+      // Clear existing cursor if any.
+      clearCursor();
+
+      // Load the font.
+      loadFont();
+
+      // The cursor is represented with a '|' character. As for the `TextBox`
+      // we use a contrasted role when it is displayed over the selection.
+      core::engine::Palette::ColorRole role = (
+        selectionStarted() && m_cursorIndex < m_selectionStart ?
+        core::engine::Palette::ColorRole::HighlightedText :
+        m_textRole
+      );
+
+      m_cursor = TextCache::getInstance().acquireText(getEngine(), std::string("|"), m_font, role);
+    }
+
+    inline
+    void
+    TextEdit::clearText() {
+      for (unsigned id = 0u ; id < m_lines.size() ; ++id) {
+        if (m_lines[id].text.valid()) {
+          TextCache::getInstance().release(m_lines[id].text);
+        }
+
+        if (m_lines[id].selection.valid()) {
+          getEngine().destroyTexture(m_lines[id].selection);
+        }
+      }
+
+      m_lines.clear();
+    }
+
+    inline
+    void
+    TextEdit::clearCursor() {
+      if (m_cursor.valid()) {
+        TextCache::getInstance().release(m_cursor);
+        m_cursor.invalidate();
+      }
+    }
+
+    inline
+    bool
+    TextEdit::isCursorVisible() const noexcept {
+      return m_cursorVisible;
+    }
+
+    inline
+    bool
+    TextEdit::selectionStarted() const noexcept {
+      return m_selectionStarted;
+    }
+
+    inline
+    bool
+    TextEdit::textChanged() const noexcept {
+      return m_textChanged;
+    }
+
+    inline
+    void
+    TextEdit::setTextChanged() noexcept {
+      // Mark the text as dirty.
+      m_textChanged = true;
+
+      // Request a repaint.
+      requestRepaint();
+    }
+
+    inline
+    bool
+    TextEdit::cursorChanged() const noexcept {
+      return m_cursorChanged;
+    }
+
+    inline
+    void
+    TextEdit::setCursorChanged() noexcept {
+      // Follow a similar behavior to `setTextChanged`.
+      m_cursorChanged = true;
+
+      requestRepaint();
+    }
+
+    inline
+    float
+    TextEdit::computeLineOrdinate(std::size_t visible,
+                                  const utils::Sizef& env) const noexcept
+    {
+      // Lines are stacked from the top of the widget.
+      return env.h() / 2.0f - (visible + 0.5f) * m_lineHeight;
+    }
+
+  }
+}
+
+#endif    /* TEXT_EDIT_HXX */
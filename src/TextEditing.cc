@@ -0,0 +1,180 @@
+
+# include "TextEditing.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    bool
+    TextEditing::handleKeyPress(const core::engine::KeyEvent& e) {
+      // Depending on the type of key pressed by the user we might:
+      // - move the position of the cursor (and start or stop the selection).
+      // - remove a character from the text displayed.
+      // - add a new character to the text displayed.
+      // - do nothing if the key is not handled.
+      if (canTriggerCursorMotion(e.getRawKey())) {
+        // Determine the motion and its amplitude from the key.
+        CursorMotion motion = CursorMotion::Left;
+        CursorMotionMode mode = CursorMotionMode::SingleChar;
+
+        switch (e.getRawKey()) {
+          case core::engine::RawKey::Right:
+            motion = CursorMotion::Right;
+            break;
+          case core::engine::RawKey::Home:
+            mode = CursorMotionMode::ToEnd;
+            break;
+          case core::engine::RawKey::End:
+            motion = CursorMotion::Right;
+            mode = CursorMotionMode::ToEnd;
+            break;
+          case core::engine::RawKey::Up:
+            motion = CursorMotion::Up;
+            break;
+          case core::engine::RawKey::Down:
+            motion = CursorMotion::Down;
+            break;
+          case core::engine::RawKey::PageUp:
+            motion = CursorMotion::Up;
+            mode = CursorMotionMode::Page;
+            break;
+          case core::engine::RawKey::PageDown:
+            motion = CursorMotion::Down;
+            mode = CursorMotionMode::Page;
+            break;
+          case core::engine::RawKey::Left:
+          default:
+            break;
+        }
+
+        // Horizontal motions move from word to word when the control modifier
+        // is pressed.
+        if (mode == CursorMotionMode::SingleChar &&
+            (motion == CursorMotion::Left || motion == CursorMotion::Right) &&
+            core::engine::ctrlEnabled(e.getModifiers()))
+        {
+          mode = CursorMotionMode::ToWord;
+        }
+
+        // Before updating the cursor position we need to detect when the user
+        // starts a selection: this is triggered by using the shift modifier and
+        // then moving the cursor. We only want to start a selection if we're not
+        // already in the process of selected some text.
+        if (core::engine::shiftEnabled(e.getModifiers()) && !selectionStarted()) {
+          startSelection();
+        }
+
+        // We should also stop the selection in case a motion key is pressed while
+        // the shift modifier is not pressed. This actually cancels the update of
+        // the cursor position.
+        if (!core::engine::shiftEnabled(e.getModifiers()) && selectionStarted()) {
+          stopSelection();
+        }
+        else {
+          updateCursorPosition(motion, mode);
+        }
+
+        return true;
+      }
+
+      // Handle the removal of a character.
+      if (e.getRawKey() == core::engine::RawKey::BackSpace || e.getRawKey() == core::engine::RawKey::Delete) {
+        // Perform the character removal.
+        removeCharFromText(e.getRawKey() == core::engine::RawKey::Delete);
+
+        // Handle the end of the selection if needed: we only want to handle it after
+        // performing the deletion of the character(s) because that's how most of the
+        // other tools handle it.
+        if (!core::engine::shiftEnabled(e.getModifiers()) && selectionStarted()) {
+          stopSelection();
+        }
+
+        return true;
+      }
+
+      // The validation keys insert a line break in multi-line editors while any
+      // other key should be printable to be inserted.
+      const bool newLine = m_multiLine && (
+        e.getRawKey() == core::engine::RawKey::Return ||
+        e.getRawKey() == core::engine::RawKey::KPEnter
+      );
+
+      if (!newLine && !e.isPrintable()) {
+        return false;
+      }
+
+      // We should stop the selection if any and remove the characters selected so far.
+      if (selectionStarted()) {
+        // Given that we have a selection active it does not really matter whether we use
+        // the `forward` suppression. For good measure though we will do as if we pressed
+        // the `Delete` key.
+        removeCharFromText(true);
+
+        stopSelection();
+      }
+
+      // Add the corresponding char to the internal text.
+      addCharToText(newLine ? '\n' : e.getChar());
+
+      return true;
+    }
+
+    std::size_t
+    TextEditing::findPreviousWord(std::size_t cursor,
+                                  bool spaces) const noexcept
+    {
+      // Move backwards until we reach a blank character or (if we started in
+      // a blank sequence) until we reach a real character and then a blank.
+      // When space sequences are considered as words we stop as soon as the
+      // nature of the character changes.
+      std::size_t id = cursor - 1u;
+      bool gap = isBlank(getCharacterAt(id));
+
+      if (spaces) {
+        while (id > 0u && gap == isBlank(getCharacterAt(id))) {
+          --id;
+        }
+      }
+      else {
+        while (id > 0u && (gap || !isBlank(getCharacterAt(id)))) {
+          --id;
+          if (gap && !isBlank(getCharacterAt(id))) {
+            gap = false;
+          }
+        }
+      }
+
+      // We don't want to move past the blank character unless we reached the
+      // beginning of the text.
+      return (id == 0u ? id : id + 1u);
+    }
+
+    std::size_t
+    TextEditing::findNextWord(std::size_t cursor,
+                              bool spaces) const noexcept
+    {
+      // Same algorithm as `findPreviousWord` but moving forward: we stop
+      // right on the blank character ending the word.
+      const std::size_t size = getTextLength();
+
+      std::size_t id = cursor;
+      bool gap = isBlank(getCharacterAt(id));
+
+      if (spaces) {
+        while (id < size && gap == isBlank(getCharacterAt(id))) {
+          ++id;
+        }
+      }
+      else {
+        while (id < size && (gap || !isBlank(getCharacterAt(id)))) {
+          ++id;
+          if (gap && id < size && !isBlank(getCharacterAt(id))) {
+            gap = false;
+          }
+        }
+      }
+
+      return id;
+    }
+
+  }
+}
@@ -0,0 +1,186 @@
+#ifndef    TEXT_EDITING_HH
+# define   TEXT_EDITING_HH
+
+# include <string>
+# include <sdl_core/SdlWidget.hh>
+
+namespace sdl {
+  namespace graphic {
+
+    class TextEditing {
+      public:
+
+        virtual ~TextEditing();
+
+      protected:
+
+        /**
+         * @brief - Used to specify the direction of a cursor motion. Vertical motions are
+         *          only meaningful for editors displaying several lines.
+         */
+        enum class CursorMotion {
+          Left,  //<!- A motion of the cursor to the previous character.
+          Right, //<!- A motion of the cursor to the next character.
+          Up,    //<!- A motion of the cursor to the previous line.
+          Down   //<!- A motion of the cursor to the next line.
+        };
+
+        /**
+         * @brief - Used to specify the amplitude of a motion of the cursor. The basic mode
+         *          corresponds to a motion of a single character (or line). Horizontal and
+         *          vertical motions do not interpret all the modes.
+         */
+        enum class CursorMotionMode {
+          SingleChar,    //<!- Move by a single character or line.
+          ToWord,        //<!- Move to the next word (horizontal only).
+          ToWordOrSpace, //<!- Move to the next word or space sequence (horizontal only).
+          ToEnd,         //<!- Move to the boundary of the text or line (horizontal only).
+          Page           //<!- Move by a page of lines (vertical only).
+        };
+
+        /**
+         * @brief - Creates the editing behavior shared by the widgets displaying editable
+         *          text. The behavior relies on the hooks defined below to access the text
+         *          and to move the cursor.
+         * @param multiLine - `true` if the text can span several lines: in this case the
+         *                    vertical motion keys move the cursor and the validation keys
+         *                    insert a line break.
+         */
+        TextEditing(bool multiLine);
+
+        /**
+         * @brief - Interprets the input key event: depending on the key the cursor is moved,
+         *          the selection is updated, characters are removed or inserted. This follows
+         *          the semantic of common text editors.
+         *          Assumes that the locker of the widget is already acquired.
+         * @param e - the key event to process.
+         * @return - `true` if the key was interpreted.
+         */
+        bool
+        handleKeyPress(const core::engine::KeyEvent& e);
+
+        /**
+         * @brief - Moves the cursor to the input character after a click: this resets any
+         *          active selection.
+         *          Assumes that the locker of the widget is already acquired.
+         * @param id - the index of the character closest to the click.
+         */
+        void
+        handleClick(std::size_t id);
+
+        /**
+         * @brief - Selects the word (or space sequence) under the cursor after a double
+         *          click.
+         *          Assumes that the locker of the widget is already acquired.
+         */
+        void
+        handleDoubleClick();
+
+        /**
+         * @brief - Selects the text between the character where a drag started and the one
+         *          closest to the current position of the mouse. The cursor is placed on the
+         *          latter and made visible.
+         *          Assumes that the locker of the widget is already acquired.
+         * @param start - the index of the character where the drag started.
+         * @param current - the index of the character closest to the mouse.
+         */
+        void
+        handleDrag(std::size_t start,
+                   std::size_t current);
+
+        /**
+         * @brief - Used to determine whether the input key can trigger a cursor motion. The
+         *          vertical keys are only considered for multi-line editors.
+         * @param k - the key which should be checked for cursor motion trigger.
+         * @return - `true` if the input key triggers a cursor position update.
+         */
+        bool
+        canTriggerCursorMotion(const core::engine::RawKey& k) const noexcept;
+
+        /**
+         * @brief - Finds the position reached by moving the cursor to the previous word from
+         *          the input position. Spaces and line breaks separate words.
+         * @param cursor - the position from which the motion starts. Should be larger than
+         *                 `0`.
+         * @param spaces - `true` if space sequences should be considered as words.
+         * @return - the position of the start of the previous word.
+         */
+        std::size_t
+        findPreviousWord(std::size_t cursor,
+                         bool spaces) const noexcept;
+
+        /**
+         * @brief - Finds the position reached by moving the cursor to the next word from the
+         *          input position. Spaces and line breaks separate words.
+         * @param cursor - the position from which the motion starts. Should be smaller than
+         *                 the length of the text.
+         * @param spaces - `true` if space sequences should be considered as words.
+         * @return - the position of the end of the next word.
+         */
+        std::size_t
+        findNextWord(std::size_t cursor,
+                     bool spaces) const noexcept;
+
+        /**
+         * @brief - Hooks used by the editing behavior to access the text of the widget.
+         */
+        virtual std::size_t
+        getTextLength() const noexcept = 0;
+
+        virtual char
+        getCharacterAt(std::size_t id) const noexcept = 0;
+
+        /**
+         * @brief - Hooks used by the editing behavior to modify the widget. They are called
+         *          with the locker of the widget already acquired.
+         */
+        virtual void
+        updateCursorState(const bool visible) = 0;
+
+        virtual void
+        updateCursorPosition(const CursorMotion& motion,
+                             const CursorMotionMode& mode = CursorMotionMode::SingleChar) = 0;
+
+        virtual void
+        updateCursorToPosition(std::size_t pos) = 0;
+
+        virtual void
+        addCharToText(char c) = 0;
+
+        virtual void
+        removeCharFromText(bool forward) = 0;
+
+        virtual void
+        startSelection() noexcept = 0;
+
+        virtual void
+        stopSelection() noexcept = 0;
+
+        virtual bool
+        selectionStarted() const noexcept = 0;
+
+      private:
+
+        /**
+         * @brief - Used to determine whether the input character separates words.
+         * @param c - the character to check.
+         * @return - `true` if the character is a space or a line break.
+         */
+        static
+        bool
+        isBlank(char c) noexcept;
+
+      private:
+
+        /**
+         * @brief - Whether the edited text can span several lines.
+         */
+        bool m_multiLine;
+    };
+
+  }
+}
+
+# include "TextEditing.hxx"
+
+#endif    /* TEXT_EDITING_HH */
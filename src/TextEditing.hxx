@@ -0,0 +1,85 @@
+#ifndef    TEXT_EDITING_HXX
+# define   TEXT_EDITING_HXX
+
+# include "TextEditing.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    inline
+    TextEditing::TextEditing(bool multiLine):
+      m_multiLine(multiLine)
+    {}
+
+    inline
+    TextEditing::~TextEditing() {}
+
+    inline
+    void
+    TextEditing::handleClick(std::size_t id) {
+      // A click resets any active selection but does not modify the text.
+      if (selectionStarted()) {
+        stopSelection();
+      }
+
+      updateCursorToPosition(id);
+    }
+
+    inline
+    void
+    TextEditing::handleDoubleClick() {
+      // Select the word under the cursor: the cursor ends up at its end.
+      updateCursorPosition(CursorMotion::Left, CursorMotionMode::ToWordOrSpace);
+      startSelection();
+      updateCursorPosition(CursorMotion::Right, CursorMotionMode::ToWordOrSpace);
+    }
+
+    inline
+    void
+    TextEditing::handleDrag(std::size_t start,
+                            std::size_t current)
+    {
+      // In case the selection did not start yet we need to move the cursor
+      // to the character where the drag started before starting it. Once
+      // started the anchor of the selection does not change anymore.
+      if (!selectionStarted()) {
+        updateCursorToPosition(start);
+        startSelection();
+      }
+
+      updateCursorToPosition(current);
+
+      // Also set the cursor to visible if it is not already the case.
+      updateCursorState(true);
+    }
+
+    inline
+    bool
+    TextEditing::canTriggerCursorMotion(const core::engine::RawKey& k) const noexcept {
+      const bool horizontal =
+        k == core::engine::RawKey::Left ||
+        k == core::engine::RawKey::Right ||
+        k == core::engine::RawKey::Home ||
+        k == core::engine::RawKey::End
+      ;
+
+      const bool vertical =
+        k == core::engine::RawKey::Up ||
+        k == core::engine::RawKey::Down ||
+        k == core::engine::RawKey::PageUp ||
+        k == core::engine::RawKey::PageDown
+      ;
+
+      return horizontal || (m_multiLine && vertical);
+    }
+
+    inline
+    bool
+    TextEditing::isBlank(char c) noexcept {
+      return c == ' ' || c == '\n';
+    }
+
+  }
+}
+
+#endif    /* TEXT_EDITING_HXX */
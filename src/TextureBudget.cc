@@ -0,0 +1,242 @@
+# include "TextureBudget.hh"
+# include <algorithm>
+
+namespace sdl {
+  namespace graphic {
+
+    TextureBudget::TextureBudget():
+      utils::CoreObject(std::string("texture_budget")),
+
+      m_locker(),
+      m_evictionDone(),
+
+      m_clients(),
+      m_evicted(),
+
+      m_metrics(Metrics{0ul, 0ul, 0ul, 0u, 0u, 0u})
+    {
+      setService(std::string("textures"));
+    }
+
+    TextureBudget&
+    TextureBudget::getInstance() {
+      static TextureBudget budget;
+
+      return budget;
+    }
+
+    void
+    TextureBudget::charge(const void* client,
+                          std::size_t bytes,
+                          const Releaser& release)
+    {
+      Victims victims;
+
+      {
+        std::unique_lock<std::mutex> guard(m_locker);
+
+        // The new textures can't be registered while the previous ones are
+        // being released: they would be accounted for by the eviction.
+        if (waitForEviction(guard, client)) {
+          return;
+        }
+
+        // Count the rebuild if the client was evicted before.
+        if (m_evicted.erase(client) > 0u) {
+          ++m_metrics.rebuilds;
+        }
+
+        // Update the size of the textures of the client: it may already have
+        // been charged for previous textures.
+        Clients::iterator it = m_clients.find(client);
+        if (it != m_clients.end()) {
+          m_metrics.bytes -= it->second.bytes;
+          m_clients.erase(it);
+        }
+
+        if (bytes == 0u) {
+          return;
+        }
+
+        m_clients[client] = Client{bytes, Clock::now(), release, false, false, std::thread::id()};
+        m_metrics.bytes += bytes;
+
+        victims = selectVictims(client);
+      }
+
+      evict(victims);
+    }
+
+    void
+    TextureBudget::discharge(const void* client) {
+      std::unique_lock<std::mutex> guard(m_locker);
+
+      // Make sure the releaser of the client is not running anymore. If it
+      // is the one discharging the client, the eviction handles it.
+      if (waitForEviction(guard, client)) {
+        return;
+      }
+
+      m_evicted.erase(client);
+
+      Clients::iterator it = m_clients.find(client);
+      if (it == m_clients.end()) {
+        return;
+      }
+
+      m_metrics.bytes -= it->second.bytes;
+      m_clients.erase(it);
+    }
+
+    void
+    TextureBudget::setBudget(std::size_t bytes) {
+      Victims victims;
+      {
+        std::lock_guard<std::mutex> guard(m_locker);
+
+        m_metrics.budget = bytes;
+
+        victims = selectVictims(nullptr);
+      }
+
+      evict(victims);
+    }
+
+    TextureBudget::Victims
+    TextureBudget::selectVictims(const void* keep) {
+      Victims victims;
+
+      // Nothing to do if the budget is disabled or not exceeded.
+      if (m_metrics.budget == 0u || m_metrics.bytes <= m_metrics.budget) {
+        return victims;
+      }
+
+      // Gather the clients which were not used recently: the others are
+      // probably displayed and should not be evicted.
+      const TimeStamp now = Clock::now();
+      const std::chrono::duration<float> idle(getMinimumIdleDuration());
+
+      std::vector<Clients::iterator> candidates;
+
+      for (Clients::iterator it = m_clients.begin() ; it != m_clients.end() ; ++it) {
+        if (it->first != keep && !it->second.evicting && now - it->second.lastUse >= idle) {
+          candidates.push_back(it);
+        }
+      }
+
+      // Evict the least recently used clients first.
+      std::sort(
+        candidates.begin(),
+        candidates.end(),
+        [](const Clients::iterator& lhs, const Clients::iterator& rhs) {
+          return lhs->second.lastUse < rhs->second.lastUse;
+        }
+      );
+
+      // The selected clients stay registered until their releaser returns so
+      // that they can't be discharged in the meantime.
+      for (unsigned id = 0u ; id < candidates.size() && m_metrics.bytes > m_metrics.budget ; ++id) {
+        Client& c = candidates[id]->second;
+
+        m_metrics.bytes -= c.bytes;
+
+        c.evicting = true;
+        c.evictor = std::this_thread::get_id();
+
+        victims.push_back(std::make_pair(candidates[id]->first, c.release));
+      }
+
+      return victims;
+    }
+
+    void
+    TextureBudget::evict(Victims& victims) {
+      if (victims.empty()) {
+        return;
+      }
+
+      // Release the textures without holding the locker: the clients
+      // may need to call `discharge` or to lock their own properties.
+      std::vector<bool> released(victims.size(), false);
+
+      for (unsigned id = 0u ; id < victims.size() ; ++id) {
+        released[id] = victims[id].second();
+      }
+
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      unsigned count = 0u;
+
+      for (unsigned id = 0u ; id < victims.size() ; ++id) {
+        Clients::iterator it = m_clients.find(victims[id].first);
+
+        if (it == m_clients.end() || !it->second.evicting) {
+          continue;
+        }
+
+        // The client discharged itself from its releaser: it should not be
+        // registered again.
+        if (it->second.discharged) {
+          m_evicted.erase(it->first);
+          m_clients.erase(it);
+          continue;
+        }
+
+        if (released[id]) {
+          ++m_metrics.evictions;
+          ++count;
+
+          m_evicted.insert(it->first);
+          m_clients.erase(it);
+
+          continue;
+        }
+
+        // The client was busy: its textures are still there.
+        ++m_metrics.skipped;
+
+        it->second.evicting = false;
+        it->second.evictor = std::thread::id();
+        m_metrics.bytes += it->second.bytes;
+      }
+
+      // Wake up the threads waiting for these clients.
+      m_evictionDone.notify_all();
+
+      log(
+        std::string("Evicted textures of ") + std::to_string(count) +
+        " widget(s), " + std::to_string(m_metrics.bytes) + " byte(s) still used",
+        utils::Level::Verbose
+      );
+    }
+
+    bool
+    TextureBudget::waitForEviction(std::unique_lock<std::mutex>& lock,
+                                   const void* client)
+    {
+      Clients::iterator it = m_clients.find(client);
+
+      if (it == m_clients.end() || !it->second.evicting) {
+        return false;
+      }
+
+      // Called from the releaser of the client.
+      if (it->second.evictor == std::this_thread::get_id()) {
+        it->second.discharged = true;
+        return true;
+      }
+
+      // Releasers never block on the widgets so the wait is short.
+      m_evictionDone.wait(
+        lock,
+        [this, client]() {
+          Clients::const_iterator c = m_clients.find(client);
+          return c == m_clients.cend() || !c->second.evicting;
+        }
+      );
+
+      return false;
+    }
+
+  }
+}
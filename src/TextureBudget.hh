@@ -0,0 +1,217 @@
+#ifndef    TEXTURE_BUDGET_HH
+# define   TEXTURE_BUDGET_HH
+
+# include <mutex>
+# include <chrono>
+# include <thread>
+# include <vector>
+# include <condition_variable>
+# include <functional>
+# include <unordered_map>
+# include <unordered_set>
+# include <maths_utils/Size.hh>
+# include <core_utils/Uuid.hh>
+# include <core_utils/CoreObject.hh>
+
+namespace sdl {
+  namespace graphic {
+
+    class TextureBudget: public utils::CoreObject {
+      public:
+
+        /**
+         * @brief - Describes the counters maintained by the budget.
+         */
+        struct Metrics {
+          unsigned long evictions; //<!- Number of widgets which released their textures.
+          unsigned long rebuilds;  //<!- Number of widgets which rebuilt evicted textures.
+          unsigned long skipped;   //<!- Number of evictions skipped as the widget was busy.
+          std::size_t clients;     //<!- Number of widgets currently holding textures.
+          std::size_t bytes;       //<!- Estimated size of the textures held by widgets.
+          std::size_t budget;      //<!- Maximum size of the textures, `0` if unlimited.
+        };
+
+        /**
+         * @brief - Convenience define for the method used to release the textures of a
+         *          widget. It should return `false` if the textures could not be released
+         *          (typically because the widget is busy) and `true` otherwise. Released
+         *          textures are expected to be rebuilt lazily upon the next repaint.
+         */
+        using Releaser = std::function<bool()>;
+
+      public:
+
+        /**
+         * @brief - Retrieves the process-wide budget shared by all the widgets of the
+         *          library.
+         * @return - the texture budget.
+         */
+        static
+        TextureBudget&
+        getInstance();
+
+        ~TextureBudget();
+
+        /**
+         * @brief - Registers the amount of memory used by the textures of a widget. This
+         *          should be called each time the widget (re)creates its textures. If it
+         *          makes the total exceed the budget, the textures of the widgets which
+         *          were not drawn for the longest time are released.
+         *          Note that the releasers are called without holding any lock from the
+         *          budget: they can thus call `discharge`.
+         * @param client - the widget holding the textures.
+         * @param bytes - the estimated size of the textures of the widget.
+         * @param release - the method to use to release the textures of the widget.
+         */
+        void
+        charge(const void* client,
+               std::size_t bytes,
+               const Releaser& release);
+
+        /**
+         * @brief - Indicates that a widget just used its textures, typically because it
+         *          was drawn. Widgets which were recently used are not evicted.
+         * @param client - the widget using its textures.
+         */
+        void
+        touch(const void* client);
+
+        /**
+         * @brief - Indicates that a widget released its textures by itself, for example
+         *          because it is destroyed. In case the widget is being evicted by another
+         *          thread this method waits for its releaser to return: once it returns
+         *          the releaser is guaranteed not to be called anymore.
+         * @param client - the widget which released its textures.
+         */
+        void
+        discharge(const void* client);
+
+        /**
+         * @brief - Defines the maximum amount of memory in bytes that the textures of the
+         *          widgets can use. A value of `0` disables the budget. Reducing the budget
+         *          may trigger evictions. Note that recently used textures cannot be evicted
+         *          so the budget can be exceeded temporarily.
+         * @param bytes - the budget for the textures.
+         */
+        void
+        setBudget(std::size_t bytes);
+
+        /**
+         * @brief - Retrieves the counters of this budget.
+         * @return - the metrics of the budget.
+         */
+        Metrics
+        getMetrics();
+
+        /**
+         * @brief - Estimates the size in bytes of the input texture assuming four bytes
+         *          per pixel. Invalid textures have a size of `0`.
+         * @param engine - the engine to use to query the texture.
+         * @param texture - the texture for which the size should be estimated.
+         * @return - the estimated size of the texture.
+         */
+        template <typename Engine>
+        static
+        std::size_t
+        getTextureBytes(Engine& engine,
+                        const utils::Uuid& texture);
+
+      private:
+
+        using Clock = std::chrono::steady_clock;
+        using TimeStamp = Clock::time_point;
+
+        /**
+         * @brief - Describes the textures held by a widget along with the last time it
+         *          used them. While its releaser is being called the widget stays in
+         *          the clients with the `evicting` status: its size is not counted in
+         *          the total anymore and `evictor` is the thread calling the releaser.
+         *          The `discharged` status indicates that the widget was discharged by
+         *          its own releaser: it should not be registered again.
+         */
+        struct Client {
+          std::size_t bytes;
+          TimeStamp lastUse;
+          Releaser release;
+          bool evicting;
+          bool discharged;
+          std::thread::id evictor;
+        };
+
+        using Clients = std::unordered_map<const void*, Client>;
+        using Victims = std::vector<std::pair<const void*, Releaser>>;
+
+        TextureBudget();
+
+        /**
+         * @brief - Defines the duration in seconds during which textures which have been
+         *          used are protected from eviction. This prevents widgets displayed at
+         *          the same time from evicting each other.
+         * @return - the minimum idle duration before a widget can be evicted.
+         */
+        static
+        float
+        getMinimumIdleDuration() noexcept;
+
+        /**
+         * @brief - Selects the widgets which should release their textures so that the
+         *          total fits in the budget: the widgets which were not used for the
+         *          longest time are selected first. The selected widgets are marked as
+         *          being evicted by the calling thread.
+         *          Assumes that the locker is already acquired.
+         * @param keep - a widget which should not be selected.
+         * @return - the widgets selected for eviction.
+         */
+        Victims
+        selectVictims(const void* keep);
+
+        /**
+         * @brief - Calls the releasers of the input widgets. The widgets which could not
+         *          release their textures are counted again unless they were discharged
+         *          in the meantime. Threads waiting for the eviction to complete are then
+         *          notified.
+         *          Assumes that the locker is not acquired.
+         * @param victims - the widgets which should release their textures.
+         */
+        void
+        evict(Victims& victims);
+
+        /**
+         * @brief - Waits for the eviction of the input widget to complete if it is being
+         *          evicted by another thread. In case the eviction is performed by the
+         *          calling thread (i.e. this is called from the releaser of the widget)
+         *          the widget is marked as discharged instead.
+         *          Assumes that the locker is already acquired through `lock`.
+         * @param lock - the lock on the locker of the budget.
+         * @param client - the widget to wait for.
+         * @return - `true` if the widget is evicted by the calling thread.
+         */
+        bool
+        waitForEviction(std::unique_lock<std::mutex>& lock,
+                        const void* client);
+
+      private:
+
+        /**
+         * @brief - Protects concurrent accesses to the budget. The condition is notified
+         *          each time some evictions complete.
+         */
+        std::mutex m_locker;
+        std::condition_variable m_evictionDone;
+
+        /**
+         * @brief - The widgets currently holding textures, and the ones which released
+         *          them upon being evicted: it allows to count the rebuilds.
+         */
+        Clients m_clients;
+        std::unordered_set<const void*> m_evicted;
+
+        Metrics m_metrics;
+    };
+
+  }
+}
+
+# include "TextureBudget.hxx"
+
+#endif    /* TEXTURE_BUDGET_HH */
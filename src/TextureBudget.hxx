@@ -0,0 +1,58 @@
+#ifndef    TEXTURE_BUDGET_HXX
+# define   TEXTURE_BUDGET_HXX
+
+# include "TextureBudget.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    inline
+    TextureBudget::~TextureBudget() {}
+
+    inline
+    void
+    TextureBudget::touch(const void* client) {
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      Clients::iterator it = m_clients.find(client);
+
+      if (it != m_clients.end()) {
+        it->second.lastUse = Clock::now();
+      }
+    }
+
+    inline
+    TextureBudget::Metrics
+    TextureBudget::getMetrics() {
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      m_metrics.clients = m_clients.size();
+
+      return m_metrics;
+    }
+
+    template <typename Engine>
+    inline
+    std::size_t
+    TextureBudget::getTextureBytes(Engine& engine,
+                                   const utils::Uuid& texture)
+    {
+      if (!texture.valid()) {
+        return 0u;
+      }
+
+      utils::Sizef size = engine.queryTexture(texture);
+
+      return static_cast<std::size_t>(size.w() * size.h() * 4.0f);
+    }
+
+    inline
+    float
+    TextureBudget::getMinimumIdleDuration() noexcept {
+      return 2.0f;
+    }
+
+  }
+}
+
+#endif    /* TEXTURE_BUDGET_HXX */
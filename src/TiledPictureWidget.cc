@@ -0,0 +1,323 @@
+# include "TiledPictureWidget.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    TiledPictureWidget::TiledPictureWidget(const std::string& name,
+                                           const std::string& pattern,
+                                           const utils::Sizef& tile,
+                                           unsigned columns,
+                                           unsigned rows,
+                                           core::SdlWidget* parent,
+                                           const core::engine::Color& color):
+      core::SdlWidget(name, utils::Sizef(), parent, color),
+
+      m_propsLocker(),
+
+      m_pattern(pattern),
+      m_tile(tile),
+      m_columns(static_cast<int>(columns)),
+      m_rows(static_cast<int>(rows)),
+
+      m_ring(getDefaultPrefetchRing()),
+      m_maxTiles(getDefaultMaxTiles()),
+
+      m_hMin(0.0f),
+      m_hMax(1.0f),
+      m_vMin(0.0f),
+      m_vMax(1.0f),
+
+      m_motionX(0),
+      m_motionY(0),
+
+      m_tiles()
+    {
+      // The size of the picture is known from the grid: we use it as a size
+      // hint so that the widget can be scrolled in a `ScrollArea`.
+      setSizeHint(utils::Sizef(columns * tile.w(), rows * tile.h()));
+      setSizePolicy(
+        sdl::core::SizePolicy(
+          sdl::core::SizePolicy::Name::Preferred,
+          sdl::core::SizePolicy::Name::Preferred
+        )
+      );
+    }
+
+    TiledPictureWidget::~TiledPictureWidget() {
+      Guard guard(m_propsLocker);
+
+      // Cancel the pending decoding operations so that the decoding threads
+      // do not reference this widget anymore.
+      for (TilesMap::iterator it = m_tiles.begin() ; it != m_tiles.end() ; ++it) {
+        releaseTile(it->second);
+      }
+
+      m_tiles.clear();
+    }
+
+    void
+    TiledPictureWidget::drawContentPrivate(const utils::Uuid& uuid,
+                                           const utils::Boxf& area)
+    {
+      // Acquire the lock on the attributes of this widget.
+      Guard guard(m_propsLocker);
+
+      // Restrict the area to update to the area of this widget: if nothing
+      // remains there's nothing to draw.
+      utils::Boxf thisArea = LayoutItem::getRenderingArea().toOrigin();
+      utils::Boxf visible = thisArea.intersect(area);
+
+      if (!visible.valid() || m_columns <= 0 || m_rows <= 0 || !m_tile.valid()) {
+        return;
+      }
+
+      // Determine the tiles to draw: the tiles to load are determined from
+      // the displayed part of the picture rather than from the area to update.
+      Range shown = getTilesRange(visible, 0u);
+
+      utils::Sizef sizeEnv = getEngine().queryTexture(uuid);
+
+      for (int row = shown.rowMin ; row <= shown.rowMax ; ++row) {
+        for (int col = shown.colMin ; col <= shown.colMax ; ++col) {
+          TilesMap::iterator it = m_tiles.find(std::make_pair(col, row));
+
+          if (it == m_tiles.end()) {
+            continue;
+          }
+
+          Tile& tile = it->second;
+
+          // Create the texture for this tile if it has been decoded since the
+          // last repaint. The decoded image is given back to the image cache
+          // right away.
+          if (!tile.texture.valid() && tile.task != nullptr && tile.task->isDone()) {
+            core::engine::ImageShPtr img = tile.task->takeImage();
+
+            if (img != nullptr && img->hasData()) {
+              tile.texture = getEngine().createTextureFromFile(img, core::engine::Palette::ColorRole::Base);
+            }
+
+            ImageCache::getInstance().release(img);
+            tile.task.reset();
+          }
+
+          if (!tile.texture.valid()) {
+            continue;
+          }
+
+          // Only draw the part of the tile which intersects the area to update.
+          // The source area is expressed relatively to the center of the tile.
+          utils::Boxf tileArea = getTileArea(col, row);
+          utils::Boxf dst = tileArea.intersect(visible);
+
+          if (!dst.valid()) {
+            continue;
+          }
+
+          utils::Boxf src(dst.getCenter() - tileArea.getCenter(), dst.w(), dst.h());
+
+          utils::Boxf srcEngine = convertToEngineFormat(src, m_tile);
+          utils::Boxf dstEngine = convertToEngineFormat(dst, sizeEnv);
+
+          getEngine().drawTexture(tile.texture, &srcEngine, &uuid, &dstEngine);
+        }
+      }
+
+      // Schedule the decoding of the missing tiles.
+      streamTiles();
+    }
+
+    std::string
+    TiledPictureWidget::getTilePath(int col,
+                                    int row) const
+    {
+      std::string path = m_pattern;
+
+      const std::string xToken("{x}");
+      const std::string yToken("{y}");
+
+      std::size_t pos = path.find(xToken);
+      while (pos != std::string::npos) {
+        path.replace(pos, xToken.size(), std::to_string(col));
+        pos = path.find(xToken, pos);
+      }
+
+      pos = path.find(yToken);
+      while (pos != std::string::npos) {
+        path.replace(pos, yToken.size(), std::to_string(row));
+        pos = path.find(yToken, pos);
+      }
+
+      return path;
+    }
+
+    TiledPictureWidget::Range
+    TiledPictureWidget::getTilesRange(const utils::Boxf& area,
+                                      unsigned ring) const noexcept
+    {
+      // Convert the area to a frame where the origin is the top left corner
+      // of the picture and where the `y` axis points downwards.
+      const float w = m_columns * m_tile.w();
+      const float h = m_rows * m_tile.h();
+      const int extra = static_cast<int>(ring);
+
+      Range range{
+        static_cast<int>(std::floor((area.getLeftBound() + w / 2.0f) / m_tile.w())) - extra,
+        static_cast<int>(std::ceil((area.getRightBound() + w / 2.0f) / m_tile.w())) - 1 + extra,
+        static_cast<int>(std::floor((h / 2.0f - area.getTopBound()) / m_tile.h())) - extra,
+        static_cast<int>(std::ceil((h / 2.0f - area.getBottomBound()) / m_tile.h())) - 1 + extra
+      };
+
+      range.colMin = std::max(0, range.colMin);
+      range.colMax = std::min(m_columns - 1, range.colMax);
+      range.rowMin = std::max(0, range.rowMin);
+      range.rowMax = std::min(m_rows - 1, range.rowMax);
+
+      return range;
+    }
+
+    void
+    TiledPictureWidget::streamTiles() {
+      if (m_columns <= 0 || m_rows <= 0 || !m_tile.valid()) {
+        return;
+      }
+
+      utils::Boxf viewport = getViewport();
+      if (!viewport.valid()) {
+        return;
+      }
+
+      // The displayed tiles are always loaded. The prefetch ring is extended
+      // in the direction of the last motion so that tiles are streamed ahead
+      // of the view. Note that the rows are numbered from the top while the
+      // vertical motion is counted positively upwards.
+      Range shown = getTilesRange(viewport, 0u);
+      Range prefetch = getTilesRange(viewport, m_ring);
+
+      const int extra = static_cast<int>(m_ring);
+
+      if (m_motionX > 0) {
+        prefetch.colMax = std::min(m_columns - 1, prefetch.colMax + extra);
+      }
+      if (m_motionX < 0) {
+        prefetch.colMin = std::max(0, prefetch.colMin - extra);
+      }
+      if (m_motionY > 0) {
+        prefetch.rowMin = std::max(0, prefetch.rowMin - extra);
+      }
+      if (m_motionY < 0) {
+        prefetch.rowMax = std::min(m_rows - 1, prefetch.rowMax + extra);
+      }
+
+      TileKey center = std::make_pair((shown.colMin + shown.colMax) / 2, (shown.rowMin + shown.rowMax) / 2);
+
+      // Load the displayed tiles first, then make room for the prefetched ones
+      // which are only requested while the maximum number of tiles is not hit.
+      requestTiles(shown, center, true);
+      evictTiles(shown, prefetch, center);
+      requestTiles(prefetch, center, false);
+    }
+
+    void
+    TiledPictureWidget::requestTiles(const Range& range,
+                                     const TileKey& center,
+                                     bool force)
+    {
+      // Collect the missing tiles and sort them so that the closest to the
+      // center are requested first.
+      std::vector<TileKey> missing;
+
+      for (int row = range.rowMin ; row <= range.rowMax ; ++row) {
+        for (int col = range.colMin ; col <= range.colMax ; ++col) {
+          TileKey key = std::make_pair(col, row);
+
+          if (m_tiles.find(key) == m_tiles.end()) {
+            missing.push_back(key);
+          }
+        }
+      }
+
+      auto distance = [&center](const TileKey& key) {
+        return std::max(std::abs(key.first - center.first), std::abs(key.second - center.second));
+      };
+
+      std::stable_sort(
+        missing.begin(),
+        missing.end(),
+        [&distance](const TileKey& lhs, const TileKey& rhs) {
+          return distance(lhs) < distance(rhs);
+        }
+      );
+
+      for (unsigned id = 0u ; id < missing.size() ; ++id) {
+        if (!force && m_tiles.size() >= m_maxTiles) {
+          break;
+        }
+
+        // The decoding thread only notifies the widget: the texture is created
+        // when the tile is needed for display.
+        ImageDecoder::TaskShPtr task = ImageDecoder::getInstance().decode(
+          getTilePath(missing[id].first, missing[id].second),
+          [this](const core::engine::ImageShPtr& /*img*/) {
+            notifyTileDecoded();
+          }
+        );
+
+        m_tiles[missing[id]] = Tile{task, utils::Uuid()};
+      }
+    }
+
+    void
+    TiledPictureWidget::evictTiles(const Range& keep,
+                                   const Range& prefetch,
+                                   const TileKey& center)
+    {
+      // Release the tiles outside of the prefetch range first and then the
+      // prefetched ones, starting with the ones farthest from the center. The
+      // tiles of the range to keep are needed for display.
+      while (m_tiles.size() > m_maxTiles) {
+        TilesMap::iterator farthest = m_tiles.end();
+        bool outside = false;
+        int best = -1;
+
+        for (TilesMap::iterator it = m_tiles.begin() ; it != m_tiles.end() ; ++it) {
+          if (keep.contains(it->first.first, it->first.second)) {
+            continue;
+          }
+
+          const bool out = !prefetch.contains(it->first.first, it->first.second);
+          const int d = std::max(
+            std::abs(it->first.first - center.first),
+            std::abs(it->first.second - center.second)
+          );
+
+          if ((out && !outside) || (out == outside && d > best)) {
+            outside = out;
+            best = d;
+            farthest = it;
+          }
+        }
+
+        // All the remaining tiles are displayed.
+        if (farthest == m_tiles.end()) {
+          break;
+        }
+
+        releaseTile(farthest->second);
+        m_tiles.erase(farthest);
+      }
+    }
+
+    void
+    TiledPictureWidget::notifyTileDecoded() {
+      // This runs on the decoding thread: the widget is only notified through
+      // an event concerning the whole widget which is processed on the main
+      // thread.
+      std::shared_ptr<core::engine::PaintEvent> pe = std::make_shared<core::engine::PaintEvent>(this);
+      pe->setEmitter(this);
+
+      postEvent(pe);
+    }
+
+  }
+}
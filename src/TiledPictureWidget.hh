@@ -0,0 +1,296 @@
+#ifndef    TILED_PICTURE_WIDGET_HH
+# define   TILED_PICTURE_WIDGET_HH
+
+# include <map>
+# include <vector>
+# include <cmath>
+# include <cstdlib>
+# include <algorithm>
+# include <mutex>
+# include <memory>
+# include <string>
+# include <sdl_core/SdlWidget.hh>
+# include "ImageDecoder.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    class TiledPictureWidget: public core::SdlWidget {
+      public:
+
+        /**
+         * @brief - Creates a widget displaying a picture too large to be loaded as
+         *          a single texture. The picture is split into a grid of tiles each
+         *          one being stored in its own file: the path of a tile is obtained
+         *          by replacing the `{x}` and `{y}` tokens of the `pattern` with the
+         *          column and row of the tile (starting at `0` from the top left
+         *          corner of the picture).
+         *          Tiles are decoded on the decoding threads when they come close to
+         *          the displayed area and released when they go away from it, so the
+         *          memory used by this widget does not depend on the picture's size.
+         * @param name - the name of the widget.
+         * @param pattern - the pattern describing the path of each tile.
+         * @param tile - the size of a single tile in pixels.
+         * @param columns - the number of tiles along the horizontal axis.
+         * @param rows - the number of tiles along the vertical axis.
+         * @param parent - the parent widget of this widget.
+         * @param color - the background color of the widget, visible where tiles are
+         *                not available yet.
+         */
+        TiledPictureWidget(const std::string& name,
+                           const std::string& pattern,
+                           const utils::Sizef& tile,
+                           unsigned columns,
+                           unsigned rows,
+                           core::SdlWidget* parent = nullptr,
+                           const core::engine::Color& color = core::engine::Color());
+
+        virtual ~TiledPictureWidget();
+
+        /**
+         * @brief - Defines the number of tiles around the displayed area which should
+         *          be loaded ahead of time so that panning does not reveal empty tiles.
+         *          The ring is twice as wide in the direction of the last motion.
+         * @param ring - the width of the prefetch ring in tiles.
+         */
+        void
+        setPrefetchRing(unsigned ring);
+
+        /**
+         * @brief - Defines the maximum number of tiles kept in memory. The tiles which
+         *          are the farthest from the displayed area are released first. Note
+         *          that the tiles needed to display the visible area are always kept
+         *          even if this exceeds the maximum.
+         * @param count - the maximum number of resident tiles.
+         */
+        void
+        setMaxTiles(unsigned count);
+
+        /**
+         * @brief - Defines the part of the picture currently displayed along the horizontal
+         *          axis as percentages of the width of the widget. This matches the signal
+         *          `onHorizontalAxisChanged` of the `ScrollableWidget` displaying this widget
+         *          to which this method is meant to be connected. The tiles are streamed from
+         *          the displayed part of the picture, further ahead in the direction of the
+         *          motion. By default the whole picture is considered displayed.
+         * @param min - the left bound of the displayed part of the picture.
+         * @param max - the right bound of the displayed part of the picture.
+         */
+        void
+        setHorizontalRange(float min,
+                           float max);
+
+        /**
+         * @brief - Similar to `setHorizontalRange` but along the vertical axis. Following
+         *          the `onVerticalAxisChanged` signal the percentages start from the bottom
+         *          of the widget.
+         * @param min - the bottom bound of the displayed part of the picture.
+         * @param max - the top bound of the displayed part of the picture.
+         */
+        void
+        setVerticalRange(float min,
+                         float max);
+
+        /**
+         * @brief - Retrieves the number of tiles currently held by this widget, either
+         *          loaded or being decoded.
+         * @return - the number of resident tiles.
+         */
+        unsigned
+        getResidentTilesCount() const noexcept;
+
+      protected:
+
+        /**
+         * @brief - Reimplementation of the base `SdlWidget` method. The tiles spanning
+         *          the area to update are drawn if they are available, and the tiles of
+         *          the displayed part of the picture are then streamed.
+         * @param uuid - the identifier of the canvas which we can use to draw an image overlay.
+         * @param area - the area of the canvas to update.
+         */
+        void
+        drawContentPrivate(const utils::Uuid& uuid,
+                           const utils::Boxf& area) override;
+
+      private:
+
+        /**
+         * @brief - Describes a range of tiles, bounds included.
+         */
+        struct Range {
+          int colMin;
+          int colMax;
+          int rowMin;
+          int rowMax;
+
+          bool
+          contains(int col,
+                   int row) const noexcept;
+        };
+
+        /**
+         * @brief - A tile is first decoded and then converted into a texture upon the
+         *          next repaint.
+         */
+        struct Tile {
+          ImageDecoder::TaskShPtr task;
+          utils::Uuid texture;
+        };
+
+        using TileKey = std::pair<int, int>;
+        using TilesMap = std::map<TileKey, Tile>;
+
+        static
+        unsigned
+        getDefaultPrefetchRing() noexcept;
+
+        static
+        unsigned
+        getDefaultMaxTiles() noexcept;
+
+        /**
+         * @brief - Computes the path of the tile at the specified location from the
+         *          pattern of this widget.
+         * @param col - the column of the tile.
+         * @param row - the row of the tile.
+         * @return - the path of the tile.
+         */
+        std::string
+        getTilePath(int col,
+                    int row) const;
+
+        /**
+         * @brief - Computes the area spanned by the tile at the specified location in
+         *          local coordinate frame.
+         * @param col - the column of the tile.
+         * @param row - the row of the tile.
+         * @return - the area of the tile.
+         */
+        utils::Boxf
+        getTileArea(int col,
+                    int row) const noexcept;
+
+        /**
+         * @brief - Computes the range of tiles spanning the input area, extended by the
+         *          specified number of tiles in each direction and clamped to the grid.
+         * @param area - the area expressed in local coordinate frame.
+         * @param ring - the number of tiles to add around the area.
+         * @return - the range of tiles.
+         */
+        Range
+        getTilesRange(const utils::Boxf& area,
+                      unsigned ring) const noexcept;
+
+        /**
+         * @brief - Computes the part of the picture currently displayed in local coordinate
+         *          frame from the ranges provided to this widget.
+         * @return - the displayed part of the picture.
+         */
+        utils::Boxf
+        getViewport() const noexcept;
+
+        /**
+         * @brief - Schedules the decoding of the tiles of the displayed part of the picture
+         *          and of the tiles around it, favoring the direction of the last motion.
+         *          Tiles are released as needed to respect the maximum number of tiles.
+         *          Assumes that the locker is already acquired.
+         */
+        void
+        streamTiles();
+
+        /**
+         * @brief - Schedules the decoding of the tiles of the range which are not yet
+         *          resident, starting with the closest to the `center`. Unless `force`
+         *          is set no tile is requested once the maximum number of tiles has
+         *          been reached. Assumes that the locker is already acquired.
+         * @param range - the range of tiles to load.
+         * @param center - the tile from which distances are computed.
+         * @param force - `true` if the tiles should be requested even if this exceeds
+         *                the maximum number of tiles.
+         */
+        void
+        requestTiles(const Range& range,
+                     const TileKey& center,
+                     bool force);
+
+        /**
+         * @brief - Releases tiles until the number of tiles is below the maximum. The
+         *          tiles outside of the `prefetch` range are released first and then
+         *          the ones in the range, in both cases starting with the farthest from
+         *          the `center`. The tiles of the `keep` range are never released.
+         *          Assumes that the locker is already acquired.
+         * @param keep - the range of tiles which should not be released.
+         * @param prefetch - the range of tiles which should be released last.
+         * @param center - the tile around which tiles should be kept.
+         */
+        void
+        evictTiles(const Range& keep,
+                   const Range& prefetch,
+                   const TileKey& center);
+
+        /**
+         * @brief - Called by the decoding thread when a tile has been decoded. This
+         *          method does not access the properties of the widget: it only posts
+         *          a repaint event, the texture is created when the tile is drawn.
+         */
+        void
+        notifyTileDecoded();
+
+        /**
+         * @brief - Releases the resources of the tile: pending decoding is cancelled and
+         *          the texture is destroyed. Assumes that the locker is already acquired.
+         * @param tile - the tile to release.
+         */
+        void
+        releaseTile(Tile& tile);
+
+      private:
+
+        /**
+         * @brief - Used to protect concurrent accesses to the internal data of this widget.
+         */
+        mutable std::mutex m_propsLocker;
+
+        /**
+         * @brief - Description of the picture: the pattern of the path of each tile along
+         *          with the size of a tile and the dimensions of the grid.
+         */
+        std::string m_pattern;
+        utils::Sizef m_tile;
+        int m_columns;
+        int m_rows;
+
+        /**
+         * @brief - The width of the prefetch ring around the displayed area and the maximum
+         *          number of tiles kept in memory.
+         */
+        unsigned m_ring;
+        unsigned m_maxTiles;
+
+        /**
+         * @brief - The displayed part of the picture as percentages of the dimensions
+         *          of the widget (the vertical axis starting from the bottom) along with
+         *          the direction of the last motion of this part along each axis (`-1`,
+         *          `0` or `1`).
+         */
+        float m_hMin;
+        float m_hMax;
+        float m_vMin;
+        float m_vMax;
+
+        int m_motionX;
+        int m_motionY;
+
+        /**
+         * @brief - The tiles currently resident, either decoded or being decoded.
+         */
+        TilesMap m_tiles;
+    };
+
+    using TiledPictureWidgetShPtr = std::shared_ptr<TiledPictureWidget>;
+  }
+}
+
+# include "TiledPictureWidget.hxx"
+
+#endif    /* TILED_PICTURE_WIDGET_HH */
@@ -0,0 +1,140 @@
+#ifndef    TILED_PICTURE_WIDGET_HXX
+# define   TILED_PICTURE_WIDGET_HXX
+
+# include "TiledPictureWidget.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    inline
+    void
+    TiledPictureWidget::setPrefetchRing(unsigned ring) {
+      Guard guard(m_propsLocker);
+
+      m_ring = ring;
+      requestRepaint();
+    }
+
+    inline
+    void
+    TiledPictureWidget::setMaxTiles(unsigned count) {
+      Guard guard(m_propsLocker);
+
+      m_maxTiles = count;
+      requestRepaint();
+    }
+
+    inline
+    void
+    TiledPictureWidget::setHorizontalRange(float min,
+                                           float max)
+    {
+      Guard guard(m_propsLocker);
+
+      // Keep track of the direction of the motion to stream tiles ahead.
+      const float delta = (min + max) - (m_hMin + m_hMax);
+      m_motionX = (delta > 0.0f ? 1 : (delta < 0.0f ? -1 : 0));
+
+      m_hMin = min;
+      m_hMax = max;
+
+      streamTiles();
+    }
+
+    inline
+    void
+    TiledPictureWidget::setVerticalRange(float min,
+                                         float max)
+    {
+      Guard guard(m_propsLocker);
+
+      const float delta = (min + max) - (m_vMin + m_vMax);
+      m_motionY = (delta > 0.0f ? 1 : (delta < 0.0f ? -1 : 0));
+
+      m_vMin = min;
+      m_vMax = max;
+
+      streamTiles();
+    }
+
+    inline
+    unsigned
+    TiledPictureWidget::getResidentTilesCount() const noexcept {
+      Guard guard(m_propsLocker);
+
+      return m_tiles.size();
+    }
+
+    inline
+    bool
+    TiledPictureWidget::Range::contains(int col,
+                                        int row) const noexcept
+    {
+      return col >= colMin && col <= colMax && row >= rowMin && row <= rowMax;
+    }
+
+    inline
+    unsigned
+    TiledPictureWidget::getDefaultPrefetchRing() noexcept {
+      return 1u;
+    }
+
+    inline
+    unsigned
+    TiledPictureWidget::getDefaultMaxTiles() noexcept {
+      return 64u;
+    }
+
+    inline
+    utils::Boxf
+    TiledPictureWidget::getTileArea(int col,
+                                    int row) const noexcept
+    {
+      // The picture is centered on the widget with the first row at the top.
+      const float w = m_columns * m_tile.w();
+      const float h = m_rows * m_tile.h();
+
+      return utils::Boxf(
+        -w / 2.0f + (col + 0.5f) * m_tile.w(),
+        h / 2.0f - (row + 0.5f) * m_tile.h(),
+        m_tile.w(),
+        m_tile.h()
+      );
+    }
+
+    inline
+    utils::Boxf
+    TiledPictureWidget::getViewport() const noexcept {
+      utils::Boxf thisArea = LayoutItem::getRenderingArea().toOrigin();
+
+      const float left = thisArea.getLeftBound() + m_hMin * thisArea.w();
+      const float right = thisArea.getLeftBound() + m_hMax * thisArea.w();
+      const float bottom = thisArea.getBottomBound() + m_vMin * thisArea.h();
+      const float top = thisArea.getBottomBound() + m_vMax * thisArea.h();
+
+      return utils::Boxf(
+        (left + right) / 2.0f,
+        (bottom + top) / 2.0f,
+        right - left,
+        top - bottom
+      ).intersect(thisArea);
+    }
+
+    inline
+    void
+    TiledPictureWidget::releaseTile(Tile& tile) {
+      if (tile.task != nullptr) {
+        tile.task->cancel();
+        tile.task.reset();
+      }
+
+      if (tile.texture.valid()) {
+        getEngine().destroyTexture(tile.texture);
+        tile.texture.invalidate();
+      }
+    }
+
+  }
+}
+
+#endif    /* TILED_PICTURE_WIDGET_HXX */
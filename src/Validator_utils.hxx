@@ -2,10 +2,9 @@
 # define   VALIDATOR_UTILS_HXX
 
 # include <string>
-# include <sstream>
-# include <stdexcept>
-# include <core_utils/Conversion.hh>
+# include <algorithm>
 # include <core_utils/CoreException.hh>
+# include "NumericText.hh"
 
 namespace sdl {
   namespace graphic {
@@ -23,6 +22,45 @@ namespace sdl {
 
     }
 
+    /**
+     * @brief - Used to interpret a component of a number extracted by `extractComponents`.
+     *          An empty component or a component made of a single sign is interpreted as
+     *          `0`: the validators are called on each keystroke so texts such as "1.",
+     *          "1e" or "1e-" are expected while the user is typing. They used to raise an
+     *          error from `FloatValidator::validateScientificNotation` which is `noexcept`
+     *          and thus terminated the program instead of reporting an intermediate state.
+     *          An error is raised if the component is not a valid integer.
+     * @param input - the string containing the component.
+     * @param start - the index of the first character of the component.
+     * @param end - the index past the last character of the component.
+     * @param part - a description of the component, used in error messages.
+     * @return - the value of the component.
+     */
+    inline
+    int
+    convertComponent(const std::string& input,
+                     std::size_t start,
+                     std::size_t end,
+                     const char* part)
+    {
+      // The user might still be typing the number.
+      if (start >= end || (end - start == 1u && (input[start] == '-' || input[start] == '+'))) {
+        return 0;
+      }
+
+      int value = 0;
+      if (!number::parseInt(input.data() + start, end - start, value)) {
+        throw utils::CoreException(
+          std::string("Could not convert ") + part + " part of number \"" + input + "\"",
+          std::string("float"),
+          std::string("validator"),
+          std::string("Invalid conversion to integer")
+        );
+      }
+
+      return value;
+    }
+
     /**
      * @brief - Used to extract the components of a string suppsedly representing a
      *          number in scientific notation. Such a number looks like "1.2e3" and
@@ -32,8 +70,9 @@ namespace sdl {
      *          In case nothing is entered yet the returned value is `0` and the
      *          associated boolean is set to `false`.
      *          Note that the input string is assumed to be a *valid* number in the
-     *          scientific notation space: if this is not the case it causes undefined
-     *          behavior.
+     *          scientific notation space: if this is not the case an error is raised.
+     *          The components are interpreted in place: no temporary strings are
+     *          created.
      * @param input - the string representing a number in scientific notation to
      *                interpret.
      * @param leading - the leading digits of this number. Should be at most one digit
@@ -56,35 +95,31 @@ namespace sdl {
     {
       // The structure of a number in scientific notation should be something like `1.2e3`.
       // We will first try to determine whether each part is filled or if some are missing.
-      std::size_t indexDecSep = std::min(input.find('.'), input.find(','));
-      std::size_t indexExp = std::min(input.find('e'), input.find('E'));
+      // A single pass is enough to locate the separators.
+      std::size_t indexDecSep = std::string::npos;
+      std::size_t indexExp = std::string::npos;
+
+      for (std::size_t id = 0u ; id < input.size() ; ++id) {
+        const char c = input[id];
+
+        if ((c == '.' || c == ',') && indexDecSep == std::string::npos) {
+          indexDecSep = id;
+        }
+        if ((c == 'e' || c == 'E') && indexExp == std::string::npos) {
+          indexExp = id;
+        }
+      }
 
       bool leadExist = (std::min(indexDecSep, indexExp) > 0);
       bool decExist = (indexDecSep != std::string::npos);
       bool expExist = (indexExp != std::string::npos);
 
-      // Tokenize the string into the corresponding values. Note that we take full advantage
-      // of the fact that we know beforehand the structure of a number in scientific notation.
-
+      // Each part is delimited by the separators: we take full advantage of the fact that
+      // we know beforehand the structure of a number in scientific notation.
       // The leading part runs until we reach either the end of the string, the first decimals
       // or the exponent.
-      std::string strLead;
-      if (leadExist) {
-        strLead = input.substr(0, std::min(indexDecSep, indexExp));
-      }
-
-      std::string strDec;
-      if (decExist && indexDecSep < input.size() - 1) {
-        strDec = input.substr(indexDecSep + 1u, indexExp - (indexDecSep + 1u));
-      }
-
-      std::string strExp;
-      if (expExist && indexExp < input.size() - 1) {
-        strExp = input.substr(indexExp + 1u);
-      }
-
-      // Convert each component to an int.
-      bool ok = false;
+      const std::size_t endLead = std::min(std::min(indexDecSep, indexExp), input.size());
+      const std::size_t endDec = std::min(indexExp, input.size());
 
       // If the user wants to retrieve the leading part of the number.
       if (leading != nullptr) {
@@ -92,20 +127,7 @@ namespace sdl {
           *hasLeading = leadExist;
         }
 
-        if (!leadExist) {
-          *leading = 0;
-        }
-        else {
-          *leading = utils::convertToInt(strLead, &ok);
-          if (!ok) {
-            throw utils::CoreException(
-              std::string("Could not convert leading part of number \"") + input + "\"",
-              std::string("float"),
-              std::string("validator"),
-              std::string("Invalid conversion to integer")
-            );
-          }
-        }
+        *leading = (leadExist ? convertComponent(input, 0u, endLead, "leading") : 0);
       }
 
       // If the user wants to retrieve the decimal part of the number.
@@ -114,20 +136,7 @@ namespace sdl {
           *hasDecimals = decExist;
         }
 
-        if (!decExist) {
-          *decimals = 0;
-        }
-        else {
-          *decimals = utils::convertToInt(strDec, &ok);
-          if (!ok) {
-            throw utils::CoreException(
-              std::string("Could not convert decimals part of number \"") + input + "\"",
-              std::string("float"),
-              std::string("validator"),
-              std::string("Invalid conversion to integer")
-            );
-          }
-        }
+        *decimals = (decExist ? convertComponent(input, indexDecSep + 1u, endDec, "decimals") : 0);
       }
 
       // If the user wants to retrieve the exponent part of the number.
@@ -136,20 +145,7 @@ namespace sdl {
           *hasExponent = expExist;
         }
 
-        if (!expExist) {
-          *exponent = 0;
-        }
-        else {
-          *exponent = utils::convertToInt(strExp, &ok);
-          if (!ok) {
-            throw utils::CoreException(
-              std::string("Could not convert exponent part of number \"") + input + "\"",
-              std::string("float"),
-              std::string("validator"),
-              std::string("Invalid conversion to integer")
-            );
-          }
-        }
+        *exponent = (expExist ? convertComponent(input, indexExp + 1u, input.size(), "exponent") : 0);
       }
     }
 